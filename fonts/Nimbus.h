@@ -1,8 +1,8 @@
 
 #pragma once
 
-#include <inttypes.h>
-#include "fontServer.h"
+#include <cinttypes>
+#include "bdfFont.h"
 
 /****** Font Summary ********
 Tag			Nimbus28
@@ -25,7 +25,7 @@ Max Drop -6
 V Step	28
 ****************************/
 
-const BdfGlyph Nimbus28Glyphs[] {
+ inline constexpr BdfGlyph Nimbus28Glyphs[] {
 {0, 1, 1, 6, 0, 0},			// 0x20			space
 {1, 2, 20, 6, 2, 0},			// 0x21			exclam
 {21, 5, 7, 8, 2, 13},			// 0x22			quotedbl
@@ -124,7 +124,7 @@ const BdfGlyph Nimbus28Glyphs[] {
 };
 
 
-const uint8_t Nimbus28Bitmaps[] {
+inline constexpr uint8_t Nimbus28Bitmaps[] {
 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 
 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x40, 0x40, 0x00, 0x00, 
 0xC0, 0xC0, 0xC0, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 
@@ -455,9 +455,312 @@ const uint8_t Nimbus28Bitmaps[] {
 0x60, 0xC7, 0xC0, 0x03, 0xC0, };
 
 
+inline constexpr uint8_t Nimbus28Columns[] {
+0x00, 0xFF, 0xF8, 0x70, 0xFF, 0xFE, 0x70, 0xFE, 0x00, 
+0x00, 0xFE, 0xFE, 0x03, 0x0C, 0x00, 0x03, 0x0C, 0x10, 
+0x03, 0x7F, 0xF0, 0x7F, 0xFC, 0x00, 0xFB, 0x0C, 0x00, 
+0x03, 0x0C, 0x00, 0x03, 0x0F, 0xF0, 0x0F, 0xFF, 0xC0, 
+0xFF, 0x8C, 0x00, 0x03, 0x0C, 0x00, 0x03, 0x00, 0x00, 
+0x07, 0xC0, 0xF0, 0x00, 0x0F, 0xE0, 0xF8, 0x00, 0x1C, 
+0x70, 0x1C, 0x00, 0x38, 0x38, 0x0C, 0x00, 0x30, 0x38, 
+0x0C, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x30, 0x1C, 0x0E, 
+0x00, 0x18, 0x1C, 0x0C, 0x00, 0x1E, 0x0E, 0x1C, 0x00, 
+0x0E, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x3F, 
+0x00, 0x00, 0x77, 0x80, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 
+0xC0, 0x00, 0xC0, 0xC0, 0x20, 0x7F, 0x80, 0xE0, 0x1E, 
+0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x70, 0x00, 0x01, 
+0xC0, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 
+0x3F, 0xC0, 0xC0, 0x60, 0xE0, 0x00, 0x40, 0x60, 0x00, 
+0x40, 0x60, 0x00, 0x60, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 
+0x04, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0xE0, 0x3E, 
+0x38, 0xE0, 0x7F, 0x60, 0x70, 0xE3, 0xE0, 0x30, 0xC0, 
+0xE0, 0x30, 0xC1, 0xF8, 0x30, 0xF7, 0x3C, 0x60, 0x7E, 
+0x0F, 0xE0, 0x18, 0x07, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 
+0x3C, 0xF0, 0x00, 0x00, 0x30, 0xFE, 0xFE, 0x03, 0xFF, 
+0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3C, 0x00, 0x0F, 
+0x00, 0xE0, 0x00, 0x01, 0xC0, 0x80, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x00, 0x40, 0x78, 0x00, 0x03, 0xC0, 0x1F, 
+0x00, 0x3F, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x30, 0x13, 0x1E, 0xFC, 0x1E, 0x33, 0x30, 
+0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 
+0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0x03, 0x00, 0x03, 0x00, 
+0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xE2, 0xFC, 0xE0, 
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 
+0x70, 0x00, 0x07, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xF0, 
+0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x80, 0x00, 
+0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x78, 0x03, 
+0xC0, 0xE0, 0x00, 0xE0, 0xC0, 0x00, 0x60, 0xC0, 0x00, 
+0x60, 0xE0, 0x00, 0xE0, 0x60, 0x00, 0xC0, 0x7C, 0x07, 
+0xC0, 0x1F, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x0C, 0x00, 
+0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x1C, 0x00, 
+0x00, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x1E, 0x01, 
+0xE0, 0x3E, 0x07, 0xE0, 0x70, 0x0E, 0x60, 0xE0, 0x1C, 
+0x60, 0xC0, 0x18, 0x60, 0xC0, 0x38, 0x60, 0xC0, 0x70, 
+0x60, 0xE0, 0xE0, 0x60, 0x7F, 0xC0, 0x60, 0x3F, 0x80, 
+0x60, 0x0E, 0x00, 0x60, 0x0C, 0x07, 0x00, 0x3C, 0x07, 
+0xC0, 0x70, 0x01, 0xC0, 0xE0, 0x00, 0xE0, 0xC0, 0xC0, 
+0x60, 0xC0, 0xC0, 0x60, 0xC0, 0xC0, 0x60, 0xE1, 0xE0, 
+0xE0, 0x7F, 0xF1, 0xC0, 0x3F, 0x7F, 0x80, 0x00, 0x1F, 
+0x00, 0x00, 0x1E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xE6, 
+0x00, 0x03, 0x86, 0x00, 0x0F, 0x06, 0x00, 0x1C, 0x06, 
+0x00, 0x70, 0x06, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 
+0xF0, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0xC3, 
+0x00, 0xFF, 0xC3, 0xC0, 0xFD, 0x80, 0xC0, 0xC3, 0x80, 
+0xE0, 0xC3, 0x00, 0x60, 0xC3, 0x00, 0x60, 0xC3, 0x00, 
+0x60, 0xC3, 0x80, 0xC0, 0xC1, 0xE3, 0xC0, 0xC0, 0xFF, 
+0x80, 0x00, 0x3E, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 
+0x80, 0x78, 0xE1, 0xC0, 0x61, 0xC0, 0xE0, 0xE1, 0x80, 
+0x60, 0xC1, 0x80, 0x60, 0xC1, 0x80, 0x60, 0xE1, 0xC0, 
+0xE0, 0x78, 0xE1, 0xC0, 0x38, 0x7F, 0x80, 0x08, 0x3E, 
+0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 
+0x60, 0xC0, 0x07, 0xE0, 0xC0, 0x3F, 0xC0, 0xC0, 0xFC, 
+0x00, 0xC3, 0xE0, 0x00, 0xCF, 0x00, 0x00, 0xDC, 0x00, 
+0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0C, 0x1F, 
+0x00, 0x3F, 0x3F, 0xC0, 0x7F, 0xE1, 0xC0, 0xE1, 0xC0, 
+0xE0, 0xC0, 0xC0, 0x60, 0xC0, 0xC0, 0x60, 0xC0, 0xC0, 
+0x60, 0xE1, 0xE0, 0xE0, 0x7F, 0xF1, 0xC0, 0x3F, 0x3F, 
+0x80, 0x00, 0x1E, 0x00, 0x1F, 0x83, 0x00, 0x3F, 0xE3, 
+0xC0, 0x70, 0x71, 0xC0, 0xE0, 0x30, 0x60, 0xC0, 0x30, 
+0x60, 0xC0, 0x30, 0x60, 0xC0, 0x30, 0xE0, 0x60, 0x61, 
+0xC0, 0x7F, 0xCF, 0x80, 0x3F, 0xFF, 0x00, 0x07, 0xF0, 
+0x00, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0x40, 0xE0, 
+0x1F, 0x80, 0x06, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1B, 
+0x80, 0x19, 0x80, 0x31, 0xC0, 0x30, 0xC0, 0x60, 0x60, 
+0x60, 0x60, 0xC0, 0x30, 0xC0, 0x30, 0xC3, 0xC3, 0xC3, 
+0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 
+0xE0, 0x1C, 0x60, 0x18, 0x70, 0x30, 0x30, 0x30, 0x38, 
+0x60, 0x18, 0x60, 0x1C, 0xC0, 0x0C, 0xC0, 0x0F, 0x80, 
+0x07, 0x80, 0x07, 0x00, 0x0C, 0x00, 0x00, 0x3C, 0x00, 
+0x00, 0x78, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x0E, 
+0x70, 0xC0, 0x3E, 0x70, 0xC0, 0x70, 0x00, 0xE1, 0xE0, 
+0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF0, 
+0x00, 0x07, 0xFE, 0x00, 0x1E, 0x07, 0x80, 0x38, 0x01, 
+0xC0, 0x70, 0xFC, 0xC0, 0x63, 0xFE, 0x60, 0xC7, 0x03, 
+0x30, 0xCE, 0x03, 0x30, 0xCC, 0x03, 0x30, 0xCC, 0x06, 
+0x30, 0xCE, 0x1E, 0x30, 0xC3, 0xFF, 0x30, 0x6F, 0xC3, 
+0x60, 0x6C, 0x06, 0x60, 0x38, 0x0C, 0xC0, 0x1F, 0xF9, 
+0x80, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 
+0xF0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xFC, 
+0x00, 0x1F, 0xCC, 0x00, 0xFE, 0x0C, 0x00, 0xE0, 0x0C, 
+0x00, 0xFC, 0x0C, 0x00, 0x3F, 0x8C, 0x00, 0x07, 0xFC, 
+0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 
+0xF0, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 
+0xF0, 0xC0, 0x60, 0x30, 0xC0, 0x60, 0x30, 0xC0, 0x60, 
+0x30, 0xC0, 0x60, 0x30, 0xC0, 0x60, 0x30, 0xE0, 0x60, 
+0x30, 0xE0, 0xE0, 0x70, 0x7F, 0xF0, 0xE0, 0x3F, 0xBF, 
+0xE0, 0x0C, 0x1F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xFF, 
+0x80, 0x3F, 0x07, 0xC0, 0x78, 0x01, 0xE0, 0x70, 0x00, 
+0x60, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xC0, 0x00, 
+0x30, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0x60, 0x00, 
+0xE0, 0x70, 0x01, 0xE0, 0x3C, 0x0F, 0xC0, 0x1C, 0x0F, 
+0x00, 0x00, 0x08, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 
+0xF0, 0xC0, 0x00, 0x30, 0xC0, 0x00, 0x30, 0xC0, 0x00, 
+0x30, 0xC0, 0x00, 0x30, 0xC0, 0x00, 0x30, 0xE0, 0x00, 
+0x30, 0xE0, 0x00, 0x70, 0x70, 0x00, 0xE0, 0x7C, 0x03, 
+0xE0, 0x1F, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0xFF, 0xFF, 
+0xF0, 0xFF, 0xFF, 0xF0, 0xC0, 0x60, 0x30, 0xC0, 0x60, 
+0x30, 0xC0, 0x60, 0x30, 0xC0, 0x60, 0x30, 0xC0, 0x60, 
+0x30, 0xC0, 0x60, 0x30, 0xC0, 0x60, 0x30, 0xC0, 0x60, 
+0x30, 0xC0, 0x60, 0x30, 0xC0, 0x00, 0x30, 0xFF, 0xFF, 
+0xF0, 0xFF, 0xFF, 0xF0, 0xC0, 0x60, 0x00, 0xC0, 0x60, 
+0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 
+0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 
+0x00, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFF, 
+0x00, 0x3F, 0x0F, 0xC0, 0x78, 0x01, 0xE0, 0x70, 0x00, 
+0xE0, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x30, 0xC0, 0x00, 
+0x30, 0xE0, 0x60, 0x30, 0xE0, 0x60, 0x70, 0x60, 0x60, 
+0x60, 0x70, 0x60, 0xE0, 0x38, 0x61, 0xC0, 0x1C, 0x7F, 
+0xE0, 0x04, 0x7F, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 
+0xF0, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 
+0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 
+0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 
+0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 
+0xF0, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0x00, 0x00, 0x07, 
+0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 
+0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x01, 
+0xE0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 
+0xF0, 0xFF, 0xFF, 0xF0, 0x00, 0x70, 0x00, 0x00, 0xE0, 
+0x00, 0x01, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0x78, 
+0x00, 0x1E, 0x3E, 0x00, 0x38, 0x0F, 0x80, 0x70, 0x03, 
+0xE0, 0xE0, 0x01, 0xF0, 0xC0, 0x00, 0x70, 0x80, 0x00, 
+0x10, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 
+0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 
+0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 
+0x30, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 
+0xF0, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 
+0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 
+0x70, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xF8, 
+0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 
+0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 
+0xF0, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 
+0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 
+0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x00, 
+0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x03, 0xFC, 
+0x00, 0x0F, 0xFF, 0x00, 0x3E, 0x07, 0xC0, 0x78, 0x01, 
+0xE0, 0x70, 0x00, 0xE0, 0xE0, 0x00, 0x70, 0xE0, 0x00, 
+0x70, 0xC0, 0x00, 0x30, 0xC0, 0x00, 0x30, 0xE0, 0x00, 
+0x70, 0xE0, 0x00, 0x70, 0x70, 0x00, 0xE0, 0x38, 0x01, 
+0xC0, 0x1F, 0x0F, 0x80, 0x0F, 0xFF, 0x00, 0x01, 0xF8, 
+0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xC0, 0x60, 
+0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 
+0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00, 0xE0, 0x60, 
+0x00, 0xF0, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x80, 
+0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x3E, 0x07, 
+0xC0, 0x78, 0x01, 0xE0, 0x70, 0x00, 0xE0, 0xE0, 0x00, 
+0x70, 0xE0, 0x00, 0x70, 0xC0, 0x00, 0x30, 0xC0, 0x00, 
+0x30, 0xE0, 0x03, 0x70, 0xE0, 0x01, 0xF0, 0x70, 0x01, 
+0xE0, 0x38, 0x01, 0xE0, 0x1F, 0x0F, 0xF0, 0x0F, 0xFF, 
+0x38, 0x01, 0xFC, 0x10, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 
+0xF0, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 
+0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 
+0x00, 0xC0, 0x60, 0x00, 0xE0, 0xF0, 0x00, 0x71, 0xFC, 
+0x00, 0x7F, 0x9F, 0xF0, 0x1F, 0x0F, 0xF0, 0x00, 0x00, 
+0x10, 0x00, 0x07, 0x00, 0x1F, 0x87, 0xC0, 0x7F, 0xC1, 
+0xE0, 0x71, 0xC0, 0x60, 0xE0, 0xC0, 0x70, 0xC0, 0xE0, 
+0x70, 0xC0, 0xE0, 0x30, 0xE0, 0x60, 0x30, 0xE0, 0x60, 
+0x70, 0x60, 0x70, 0x70, 0x78, 0x38, 0xE0, 0x3C, 0x3F, 
+0xC0, 0x0C, 0x1F, 0x80, 0xC0, 0x00, 0x00, 0xC0, 0x00, 
+0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 
+0x00, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 
+0xF0, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 
+0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 
+0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 
+0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 
+0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 
+0x70, 0x00, 0x00, 0xE0, 0x00, 0x07, 0xC0, 0xFF, 0xFF, 
+0x80, 0xFF, 0xFE, 0x00, 0xF0, 0x00, 0x00, 0xFE, 0x00, 
+0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 
+0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x03, 
+0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x1F, 0xE0, 
+0x00, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x80, 0x00, 
+0x00, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 
+0xF0, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0xC0, 0x07, 0xF8, 
+0x00, 0xFF, 0x80, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 
+0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F, 
+0xF0, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 
+0x80, 0x3F, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0xF0, 0x00, 
+0x00, 0x80, 0x00, 0x30, 0xE0, 0x00, 0xF0, 0xF8, 0x01, 
+0xE0, 0x3E, 0x07, 0xC0, 0x1F, 0x1F, 0x00, 0x07, 0xFC, 
+0x00, 0x01, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xBE, 
+0x00, 0x1E, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0xF0, 0x00, 
+0xF0, 0xC0, 0x00, 0x30, 0x00, 0x00, 0x10, 0xC0, 0x00, 
+0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 
+0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7F, 
+0xF0, 0x00, 0xFF, 0xF0, 0x03, 0xE0, 0x00, 0x0F, 0x80, 
+0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xE0, 0x00, 
+0x00, 0x80, 0x00, 0x00, 0xC0, 0x00, 0xF0, 0xC0, 0x01, 
+0xF0, 0xC0, 0x07, 0xB0, 0xC0, 0x0F, 0x30, 0xC0, 0x3C, 
+0x30, 0xC0, 0x78, 0x30, 0xC1, 0xE0, 0x30, 0xC3, 0xC0, 
+0x30, 0xCF, 0x00, 0x30, 0xDE, 0x00, 0x30, 0xF8, 0x00, 
+0x30, 0xF0, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 
+0xFF, 0xFF, 0x80, 0xC0, 0x00, 0x01, 0x80, 0xC0, 0x00, 
+0x01, 0x80, 0xC0, 0x00, 0x01, 0x80, 0xE0, 0x00, 0x00, 
+0x7E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 
+0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 
+0xC0, 0x00, 0x01, 0x80, 0xC0, 0x00, 0x01, 0x80, 0xFF, 
+0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x30, 
+0x01, 0xF0, 0x07, 0x80, 0x3E, 0x00, 0xF0, 0x00, 0xC0, 
+0x00, 0xF8, 0x00, 0x1E, 0x00, 0x07, 0xC0, 0x00, 0xF0, 
+0x00, 0x30, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xE0, 0x70, 
+0x10, 0x08, 0xF8, 0x79, 0xFC, 0x71, 0x8E, 0xC3, 0x06, 
+0xC3, 0x06, 0xC3, 0x06, 0xC3, 0x0C, 0xE2, 0x18, 0x7F, 
+0xFC, 0x3F, 0xFE, 0x00, 0x06, 0xFF, 0xFF, 0xF0, 0xFF, 
+0xFF, 0xF0, 0x01, 0xC1, 0xC0, 0x03, 0x00, 0x60, 0x06, 
+0x00, 0x30, 0x06, 0x00, 0x30, 0x06, 0x00, 0x30, 0x07, 
+0x00, 0x70, 0x03, 0xC1, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 
+0x7E, 0x00, 0x1F, 0xF0, 0x3F, 0xF8, 0x70, 0x1C, 0xE0, 
+0x0E, 0xC0, 0x06, 0xC0, 0x06, 0xE0, 0x0E, 0xF0, 0x1C, 
+0x78, 0x38, 0x18, 0x30, 0x00, 0xFF, 0x00, 0x03, 0xFF, 
+0xC0, 0x03, 0x80, 0xE0, 0x07, 0x00, 0x70, 0x06, 0x00, 
+0x30, 0x06, 0x00, 0x30, 0x07, 0x00, 0x30, 0x03, 0x80, 
+0x60, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x0F, 0xE0, 
+0x3F, 0xF8, 0x73, 0x1C, 0xE3, 0x0E, 0xC3, 0x06, 0xC3, 
+0x06, 0xC3, 0x06, 0xE3, 0x0E, 0x7B, 0x3C, 0x3F, 0x38, 
+0x07, 0x20, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x7F, 
+0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xC6, 0x00, 0x00, 0xC6, 
+0x00, 0x00, 0x1F, 0xE0, 0xC0, 0x3F, 0xF8, 0xF0, 0x70, 
+0x1C, 0x70, 0xE0, 0x0E, 0x18, 0xC0, 0x06, 0x18, 0xC0, 
+0x06, 0x18, 0xE0, 0x06, 0x18, 0x60, 0x0C, 0x30, 0x3F, 
+0xFF, 0xF0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0, 0xFF, 
+0xFF, 0xF0, 0x01, 0xE0, 0x00, 0x03, 0x00, 0x00, 0x07, 
+0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 
+0x00, 0x00, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0xE7, 
+0xFF, 0xF0, 0xE7, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xC0, 
+0x00, 0x00, 0x03, 0xC0, 0xE7, 0xFF, 0xFF, 0x80, 0xE7, 
+0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1C, 0x00, 
+0x00, 0x38, 0x00, 0x00, 0x78, 0x00, 0x00, 0xFE, 0x00, 
+0x03, 0xCF, 0x80, 0x07, 0x03, 0xE0, 0x06, 0x00, 0xF0, 
+0x04, 0x00, 0x30, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 
+0xFF, 0xFE, 0xFF, 0xFE, 0x3C, 0x00, 0x60, 0x00, 0xE0, 
+0x00, 0xC0, 0x00, 0xC0, 0x00, 0xF0, 0x00, 0x7F, 0xFE, 
+0x3F, 0xFE, 0x60, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 
+0x00, 0xF0, 0x00, 0x7F, 0xFE, 0x1F, 0xFE, 0xFF, 0xFE, 
+0xFF, 0xFE, 0x3C, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xC0, 
+0x00, 0xC0, 0x00, 0xE0, 0x00, 0x7F, 0xFE, 0x3F, 0xFE, 
+0x0F, 0xE0, 0x3F, 0xF8, 0x70, 0x1C, 0xE0, 0x0E, 0xC0, 
+0x06, 0xC0, 0x06, 0xC0, 0x06, 0x60, 0x0E, 0x78, 0x3C, 
+0x3F, 0xF8, 0x0F, 0xE0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 
+0xF0, 0x38, 0x38, 0x00, 0xE0, 0x0C, 0x00, 0xC0, 0x06, 
+0x00, 0xC0, 0x06, 0x00, 0xC0, 0x06, 0x00, 0xE0, 0x0E, 
+0x00, 0x78, 0x3C, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xC0, 
+0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x70, 0x1C, 
+0x00, 0xE0, 0x0E, 0x00, 0xC0, 0x06, 0x00, 0xC0, 0x06, 
+0x00, 0xE0, 0x0E, 0x00, 0x70, 0x0C, 0x00, 0xFF, 0xFF, 
+0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFE, 0xFF, 0xFE, 0x70, 
+0x00, 0xE0, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x3C, 0x38, 
+0x7E, 0x3C, 0xE7, 0x0E, 0xC3, 0x06, 0xC3, 0x06, 0xC3, 
+0x86, 0xE1, 0x8E, 0x71, 0xDC, 0x30, 0xF8, 0x00, 0x60, 
+0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xE0, 0x0C, 0x00, 0x60, 0x0C, 0x00, 0x60, 
+0xFF, 0xFC, 0xFF, 0xFE, 0x00, 0x0E, 0x00, 0x06, 0x00, 
+0x06, 0x00, 0x0E, 0x00, 0x1C, 0xFF, 0xFE, 0xFF, 0xFE, 
+0x80, 0x00, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 
+0xFE, 0x00, 0x0E, 0x00, 0x7E, 0x03, 0xF0, 0x3F, 0x80, 
+0xFC, 0x00, 0xE0, 0x00, 0x80, 0x00, 0xF8, 0x00, 0xFF, 
+0xC0, 0x07, 0xFC, 0x00, 0x3E, 0x00, 0x7E, 0x1F, 0xF0, 
+0xFE, 0x00, 0xF8, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 
+0x3E, 0x00, 0xFE, 0x0F, 0xF0, 0xFF, 0x00, 0xE0, 0x00, 
+0xC0, 0x06, 0xF0, 0x1E, 0x7C, 0x7C, 0x1F, 0xF0, 0x07, 
+0xC0, 0x0F, 0xE0, 0x3C, 0xF8, 0xF8, 0x3E, 0xE0, 0x0E, 
+0x80, 0x02, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x18, 0xFF, 
+0x00, 0x18, 0x0F, 0xE0, 0x38, 0x00, 0xFE, 0xF0, 0x00, 
+0x1F, 0xE0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x3F, 
+0x80, 0x00, 0xFC, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 
+0x0E, 0xC0, 0x3E, 0xC0, 0x7E, 0xC1, 0xE6, 0xC3, 0xC6, 
+0xCF, 0x06, 0xDE, 0x06, 0xF8, 0x06, 0xF0, 0x06, 0xC0, 
+0x06, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 
+0x7F, 0xF3, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 0xC0, 
+0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 
+0xF0, 0xFF, 0xFF, 0xF0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 
+0x00, 0x00, 0xC0, 0xFF, 0xE1, 0xFF, 0x80, 0x3F, 0xFF, 
+0xFF, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0C, 0x00, 
+0x00, 0x20, 0x60, 0xC0, 0xC0, 0xC0, 0x60, 0x70, 0x30, 
+0x30, 0x70, 0x40, };
+
+
+inline constexpr uint16_t Nimbus28ColumnIndex[] {
+0, 1, 7, 12, 45, 89, 146, 185, 187, 207, 227, 234, 258, 260, 266, 268, 
+289, 322, 340, 373, 406, 439, 472, 505, 538, 571, 604, 608, 614, 636, 648, 670, 
+700, 751, 796, 832, 877, 916, 952, 985, 1030, 1069, 1075, 1105, 1144, 1174, 1219, 1258, 
+1306, 1342, 1390, 1432, 1471, 1513, 1552, 1594, 1657, 1699, 1741, 1777, 1797, 1818, 1834, 1856, 
+1869, 1873, 1895, 1928, 1948, 1978, 2000, 2018, 2048, 2078, 2084, 2100, 2127, 2133, 2167, 2187, 
+2209, 2242, 2272, 2284, 2304, 2322, 2340, 2362, 2394, 2414, 2447, 2467, 2491, 2497, 2521, };
+
+
+inline constexpr uint8_t Nimbus28Widths[] {
+6, 6, 8, 13, 13, 20, 15, 4, 8, 8, 9, 13, 6, 8, 6, 6, 
+13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 6, 6, 13, 13, 13, 13, 
+23, 15, 15, 17, 17, 15, 14, 18, 17, 6, 11, 15, 13, 19, 17, 18, 
+15, 18, 17, 15, 14, 17, 15, 22, 15, 15, 14, 6, 6, 6, 11, 13, 
+8, 13, 13, 11, 13, 13, 6, 13, 13, 5, 5, 11, 5, 19, 13, 13, 
+13, 13, 8, 11, 6, 13, 11, 17, 11, 11, 11, 8, 6, 8, 13, };
+
+
 /****** Font Definition ******/
 
-const BdfFont Nimbus28 
+inline const BdfFont Nimbus28 
 {
 	///Start address for bitmaps
 	Nimbus28Bitmaps,
@@ -468,8 +771,19 @@ const BdfFont Nimbus28
 	///Highest ASCII encoding
 	126,
 	/// Vertical step
-	28
+	28,
+	/// Start address for column-major bitmaps
+	Nimbus28Columns,
+	/// Start address for column-major glyph offsets
+	Nimbus28ColumnIndex,
+	/// Max rise above the baseline
+	22,
+	/// Max drop below the baseline (zero or negative)
+	-6,
+	/// Start address for the advance widths
+	Nimbus28Widths
 };
 
 /****************************/
 
+
@@ -1,8 +1,8 @@
 
 #pragma once
 
-#include <inttypes.h>
-#include "fontServer.h"
+#include <cinttypes>
+#include "bdfFont.h"
 
 /****** Font Summary ********
 Tag			Sans18
@@ -25,7 +25,7 @@ Max Drop -4
 V Step	18
 ****************************/
 
-const BdfGlyph Sans18Glyphs[] {
+ inline constexpr BdfGlyph Sans18Glyphs[] {
 {0, 1, 1, 5, 0, 0},			// 0x20			space
 {1, 2, 13, 6, 2, 0},			// 0x21			exclam
 {14, 4, 5, 6, 1, 8},			// 0x22			quotedbl
@@ -124,7 +124,7 @@ const BdfGlyph Sans18Glyphs[] {
 };
 
 
-const uint8_t Sans18Bitmaps[] {
+inline constexpr uint8_t Sans18Bitmaps[] {
 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 
 0x80, 0x00, 0x00, 0xC0, 0xC0, 0x90, 0x90, 0x90, 0x90, 
 0x90, 0x09, 0x80, 0x09, 0x80, 0x19, 0x00, 0x19, 0x00, 
@@ -300,9 +300,187 @@ const uint8_t Sans18Bitmaps[] {
 0x60, 0x60, 0x60, 0x60, 0xC0, 0xE0, 0xB2, 0x8E, };
 
 
+inline constexpr uint8_t Sans18Columns[] {
+0x00, 0xFF, 0x98, 0xFF, 0x18, 0xF8, 0x00, 0x00, 0xF8, 
+0x00, 0xC0, 0x08, 0xC0, 0x09, 0xF8, 0x3F, 0xC0, 0xF8, 
+0xC0, 0x08, 0xD8, 0x0F, 0xF8, 0xFE, 0xC0, 0xC8, 0xC0, 
+0x08, 0x00, 0x1E, 0x38, 0x37, 0x0C, 0x63, 0x04, 0xFF, 
+0xFF, 0x41, 0x04, 0x61, 0x84, 0x38, 0xCC, 0x18, 0xF8, 
+0x3C, 0x00, 0x46, 0x00, 0x42, 0x00, 0x46, 0x08, 0x7C, 
+0x38, 0x18, 0xE0, 0x01, 0x80, 0x06, 0x00, 0x18, 0x60, 
+0x60, 0xF8, 0x81, 0x88, 0x01, 0x08, 0x01, 0x88, 0x00, 
+0xF0, 0x00, 0xF0, 0x31, 0xB8, 0x7F, 0x08, 0xCE, 0x08, 
+0xC7, 0x08, 0xCD, 0x98, 0x78, 0xD0, 0x00, 0x70, 0x01, 
+0xD8, 0x00, 0x08, 0xF8, 0xE0, 0x03, 0xC0, 0x00, 0x1F, 
+0xFC, 0x00, 0x70, 0x07, 0x00, 0x80, 0x00, 0x80, 0x80, 
+0x01, 0x80, 0x70, 0x07, 0x00, 0x1F, 0xFC, 0x00, 0x01, 
+0xC0, 0x00, 0x40, 0x38, 0xE0, 0x38, 0x40, 0x08, 0x00, 
+0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0xFF, 0x80, 0x08, 
+0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0xF0, 0xC0, 
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x18, 0x00, 0xE0, 
+0x07, 0x00, 0x38, 0x00, 0xC0, 0x00, 0x1F, 0xE0, 0x78, 
+0x78, 0x40, 0x08, 0xC0, 0x08, 0xC0, 0x08, 0x40, 0x18, 
+0x7F, 0xF0, 0x1F, 0xE0, 0x10, 0x00, 0x30, 0x00, 0x30, 
+0x00, 0xFF, 0xF8, 0x38, 0x38, 0x70, 0x78, 0xC0, 0xD8, 
+0xC1, 0x98, 0xC1, 0x18, 0xC3, 0x18, 0x66, 0x18, 0x3C, 
+0x18, 0x30, 0x70, 0x70, 0x18, 0xC0, 0x08, 0xC2, 0x08, 
+0xC2, 0x08, 0xC6, 0x08, 0x7D, 0xF8, 0x39, 0xF0, 0x00, 
+0xC0, 0x01, 0xC0, 0x07, 0x40, 0x0C, 0x40, 0x18, 0x40, 
+0x60, 0x40, 0xFF, 0xF8, 0x00, 0x40, 0x00, 0x40, 0x0E, 
+0x30, 0xFE, 0x18, 0xC4, 0x08, 0xC4, 0x08, 0xC4, 0x08, 
+0xC4, 0x08, 0xC7, 0x38, 0xC3, 0xF0, 0x1F, 0xE0, 0x7B, 
+0xF8, 0x46, 0x18, 0xC6, 0x08, 0xC6, 0x08, 0xC6, 0x08, 
+0x73, 0x38, 0x31, 0xF0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 
+0x78, 0xC1, 0xE0, 0xC7, 0x00, 0xCC, 0x00, 0xF0, 0x00, 
+0xE0, 0x00, 0x39, 0xF0, 0x7F, 0x18, 0xC6, 0x08, 0xC2, 
+0x08, 0xC2, 0x08, 0xC6, 0x08, 0x7D, 0xB8, 0x39, 0xF0, 
+0x3E, 0x30, 0x63, 0x38, 0xC1, 0x08, 0xC1, 0x88, 0xC1, 
+0x08, 0x41, 0x18, 0x7E, 0xF0, 0x1F, 0xE0, 0x81, 0x80, 
+0x81, 0x80, 0xC0, 0xC8, 0xC0, 0xF0, 0x18, 0x38, 0x2C, 
+0x24, 0x64, 0x46, 0xC2, 0x83, 0x81, 0x90, 0x90, 0x90, 
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x83, 0xC2, 0x42, 
+0x46, 0x64, 0x2C, 0x38, 0x18, 0x18, 0x10, 0x00, 0x70, 
+0x00, 0xC0, 0x00, 0x81, 0x98, 0x83, 0x98, 0x86, 0x00, 
+0xEC, 0x00, 0x78, 0x00, 0x07, 0xF0, 0x1C, 0x38, 0x30, 
+0x0C, 0x60, 0x04, 0x43, 0xE6, 0xC7, 0x72, 0x8C, 0x12, 
+0x88, 0x13, 0x88, 0x23, 0x88, 0x62, 0x87, 0xF2, 0xCE, 
+0x12, 0x60, 0x30, 0x70, 0x20, 0x3D, 0xE0, 0x0F, 0x80, 
+0x00, 0x08, 0x00, 0x38, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 
+0x80, 0xE0, 0x80, 0xE0, 0x80, 0x7C, 0x80, 0x0F, 0x80, 
+0x01, 0xF0, 0x00, 0x38, 0x00, 0x08, 0xFF, 0xF8, 0xFF, 
+0xF8, 0x82, 0x08, 0x82, 0x08, 0x82, 0x08, 0x82, 0x08, 
+0x86, 0x08, 0xC6, 0x18, 0x7F, 0xB0, 0x31, 0xF0, 0x1F, 
+0xC0, 0x78, 0xF0, 0x60, 0x38, 0xC0, 0x18, 0x80, 0x08, 
+0x80, 0x08, 0x80, 0x08, 0xC0, 0x08, 0xC0, 0x18, 0x70, 
+0xF0, 0x10, 0xC0, 0xFF, 0xF8, 0xFF, 0xF8, 0x80, 0x08, 
+0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0xC0, 0x18, 0xC0, 
+0x18, 0x60, 0x30, 0x3F, 0xE0, 0x0F, 0x80, 0xFF, 0xF8, 
+0xFF, 0xF8, 0x82, 0x08, 0x82, 0x08, 0x82, 0x08, 0x82, 
+0x08, 0x82, 0x08, 0x82, 0x08, 0x82, 0x08, 0x80, 0x08, 
+0xFF, 0xF8, 0xFF, 0xF8, 0x82, 0x00, 0x82, 0x00, 0x82, 
+0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x80, 0x00, 
+0x1F, 0xC0, 0x78, 0xF0, 0x60, 0x30, 0xC0, 0x18, 0x80, 
+0x08, 0x80, 0x08, 0x83, 0x08, 0x83, 0x08, 0xC3, 0x18, 
+0x63, 0x30, 0x33, 0xF8, 0x03, 0xF8, 0xFF, 0xF8, 0xFF, 
+0xF8, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 
+0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFF, 0xF8, 0xFF, 
+0xF8, 0xFF, 0xF8, 0x00, 0x70, 0x00, 0x18, 0x00, 0x08, 
+0x00, 0x08, 0x00, 0x08, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 
+0xF8, 0xFF, 0xF8, 0x03, 0x00, 0x06, 0x00, 0x0E, 0x00, 
+0x1F, 0x00, 0x31, 0xC0, 0x60, 0xE0, 0xC0, 0x30, 0x80, 
+0x18, 0x00, 0x08, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x08, 
+0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 
+0x08, 0x00, 0x08, 0xFF, 0xF8, 0xFF, 0xF8, 0xE0, 0x00, 
+0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x18, 0x00, 
+0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x00, 0xFF, 0xF8, 
+0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xE0, 0x00, 0x38, 
+0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0x80, 0x00, 0xE0, 
+0x00, 0x38, 0xFF, 0xF8, 0xFF, 0xF8, 0x1F, 0xC0, 0x38, 
+0xF0, 0x60, 0x30, 0xC0, 0x18, 0x80, 0x08, 0x80, 0x08, 
+0x80, 0x08, 0x80, 0x08, 0xC0, 0x18, 0x60, 0x30, 0x78, 
+0xF0, 0x1F, 0xC0, 0xFF, 0xF8, 0xFF, 0xF8, 0x82, 0x00, 
+0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0xC6, 
+0x00, 0x7E, 0x00, 0x3C, 0x00, 0x1F, 0xC0, 0x38, 0xF0, 
+0x60, 0x30, 0xC0, 0x18, 0x80, 0x08, 0x80, 0x08, 0x80, 
+0x08, 0x80, 0x28, 0xC0, 0x38, 0x60, 0x38, 0x78, 0xF8, 
+0x1F, 0xCC, 0xFF, 0xF8, 0xFF, 0xF8, 0x82, 0x00, 0x82, 
+0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0xC3, 0x00, 
+0xC5, 0x80, 0x7D, 0xF8, 0x00, 0x08, 0x38, 0x60, 0x7C, 
+0x70, 0xC4, 0x18, 0x86, 0x08, 0x86, 0x08, 0x82, 0x08, 
+0x83, 0x08, 0xC3, 0x18, 0x71, 0xF8, 0x31, 0xF0, 0x80, 
+0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xFF, 0xF8, 
+0xFF, 0xF8, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
+0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x18, 0x00, 0x08, 
+0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x18, 0x00, 
+0x18, 0xFF, 0xF0, 0xFF, 0xC0, 0x80, 0x00, 0xE0, 0x00, 
+0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x38, 0x00, 
+0x78, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x00, 0xC0, 0x00, 
+0x80, 0x00, 0xF8, 0x00, 0x7F, 0x80, 0x03, 0xF0, 0x00, 
+0x38, 0x01, 0xF8, 0x0F, 0x80, 0xFC, 0x00, 0xE0, 0x00, 
+0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x38, 0x07, 
+0xF0, 0x7F, 0x00, 0xF0, 0x00, 0x80, 0x18, 0xE0, 0x38, 
+0x70, 0xE0, 0x1D, 0xC0, 0x0F, 0x00, 0x0F, 0x00, 0x19, 
+0xC0, 0x70, 0x60, 0xE0, 0x38, 0x80, 0x18, 0xC0, 0x00, 
+0xE0, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x07, 0xF8, 0x03, 
+0xF8, 0x0E, 0x00, 0x38, 0x00, 0x70, 0x00, 0xC0, 0x00, 
+0x80, 0x00, 0x80, 0x38, 0x80, 0x78, 0x80, 0xC8, 0x83, 
+0x88, 0x87, 0x08, 0x8E, 0x08, 0x98, 0x08, 0xF0, 0x08, 
+0xE0, 0x08, 0x80, 0x08, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 
+0x80, 0x80, 0x00, 0x80, 0x80, 0x00, 0x80, 0xC0, 0x00, 
+0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x18, 0x80, 
+0x00, 0x80, 0x80, 0x00, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 
+0xFF, 0x80, 0x06, 0x1C, 0xE0, 0xC0, 0x38, 0x0E, 0x80, 
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+0x80, 0xC0, 0x40, 0x27, 0xC0, 0x66, 0x40, 0xC4, 0x40, 
+0xC4, 0x40, 0xCC, 0x40, 0x48, 0x80, 0x7F, 0xC0, 0x00, 
+0x40, 0xFF, 0xF8, 0xFF, 0xF0, 0x08, 0x18, 0x18, 0x08, 
+0x18, 0x08, 0x18, 0x08, 0x0C, 0x18, 0x07, 0xF0, 0x00, 
+0x80, 0x3F, 0x80, 0x60, 0xC0, 0xC0, 0x40, 0xC0, 0x40, 
+0xC0, 0x40, 0x60, 0xC0, 0x71, 0x80, 0x07, 0xF0, 0x0C, 
+0x38, 0x18, 0x08, 0x18, 0x08, 0x18, 0x08, 0x08, 0x18, 
+0xFF, 0xF0, 0xFF, 0xF8, 0x3F, 0x80, 0x64, 0xC0, 0xC4, 
+0x40, 0xC4, 0x40, 0xC4, 0x40, 0x44, 0xC0, 0x7D, 0xC0, 
+0x1D, 0x00, 0x08, 0x00, 0x08, 0x00, 0xFF, 0xF8, 0x88, 
+0x00, 0x88, 0x00, 0x3F, 0x98, 0x61, 0xC8, 0xC0, 0x4C, 
+0xC0, 0x44, 0xC0, 0x44, 0x60, 0xCC, 0x7F, 0xF8, 0x7F, 
+0xE0, 0xFF, 0xF8, 0xFF, 0xF8, 0x08, 0x00, 0x18, 0x00, 
+0x18, 0x00, 0x18, 0x00, 0x0F, 0xF8, 0x07, 0xF8, 0xCF, 
+0xF8, 0xCF, 0xF8, 0x00, 0x00, 0x80, 0x00, 0x01, 0x80, 
+0xCF, 0xFF, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x01, 0x00, 
+0x03, 0x80, 0x07, 0xC0, 0x0C, 0x70, 0x08, 0x38, 0x00, 
+0x08, 0xFF, 0xF8, 0xFF, 0xF8, 0x7F, 0xC0, 0x3F, 0xC0, 
+0x40, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x7F, 
+0xC0, 0x60, 0x00, 0x40, 0x00, 0xC0, 0x00, 0xC0, 0x00, 
+0x7F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x40, 
+0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x7F, 0xC0, 
+0x3F, 0xC0, 0x3F, 0x80, 0x61, 0xC0, 0xC0, 0x40, 0xC0, 
+0x40, 0xC0, 0x40, 0x40, 0xC0, 0x7F, 0xC0, 0x3F, 0x00, 
+0x7F, 0xFC, 0x3F, 0xFC, 0x40, 0xC0, 0xC0, 0x40, 0xC0, 
+0x40, 0xC0, 0x40, 0x60, 0xC0, 0x3F, 0x80, 0x04, 0x00, 
+0x3F, 0x80, 0x61, 0xC0, 0xC0, 0x40, 0xC0, 0x40, 0xC0, 
+0x40, 0x40, 0xC0, 0x3F, 0xFC, 0x7F, 0xFC, 0x7F, 0xC0, 
+0x3F, 0xC0, 0x40, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x79, 
+0xC0, 0x68, 0xC0, 0xCC, 0x40, 0xC4, 0x40, 0xC4, 0x40, 
+0x66, 0xC0, 0x23, 0x80, 0x10, 0x00, 0x10, 0x00, 0xFF, 
+0xF0, 0x10, 0x10, 0x10, 0x10, 0xFF, 0x00, 0xFF, 0x80, 
+0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0xFF, 
+0x80, 0xFF, 0x80, 0xE0, 0x00, 0x7C, 0x00, 0x07, 0x80, 
+0x01, 0x80, 0x0F, 0x00, 0x78, 0x00, 0xE0, 0x00, 0x80, 
+0x00, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0x80, 0x0F, 0x80, 
+0xF8, 0x00, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x03, 
+0x80, 0x3E, 0x00, 0xF0, 0x00, 0x80, 0x00, 0x81, 0x80, 
+0xE3, 0x00, 0x3E, 0x00, 0x1C, 0x00, 0x76, 0x00, 0xC3, 
+0x80, 0x80, 0x80, 0xE0, 0x18, 0x3C, 0x18, 0x07, 0xF0, 
+0x03, 0xC0, 0x1F, 0x00, 0xF8, 0x00, 0xC0, 0x00, 0x81, 
+0x80, 0x87, 0x80, 0x8C, 0x80, 0x98, 0x80, 0xB0, 0x80, 
+0xE0, 0x80, 0x80, 0x80, 0x01, 0x80, 0x00, 0x7F, 0x7F, 
+0x00, 0xFC, 0x3F, 0x80, 0x80, 0x00, 0x80, 0xFF, 0xFF, 
+0x80, 0x80, 0x00, 0x80, 0xFC, 0x1F, 0x80, 0x7F, 0x7F, 
+0x00, 0x01, 0x80, 0x00, 0xE0, 0x80, 0xC0, 0x40, 0x20, 
+0x20, 0x60, };
+
+
+inline constexpr uint16_t Sans18ColumnIndex[] {
+0, 1, 5, 9, 29, 45, 73, 93, 95, 107, 119, 124, 142, 143, 147, 149, 
+159, 175, 183, 199, 215, 233, 249, 265, 281, 297, 313, 317, 321, 330, 339, 348, 
+364, 396, 420, 440, 462, 484, 504, 522, 546, 568, 570, 584, 606, 624, 650, 672, 
+696, 716, 740, 762, 782, 802, 824, 846, 878, 898, 920, 940, 952, 962, 974, 980, 
+990, 993, 1009, 1027, 1041, 1057, 1073, 1083, 1099, 1115, 1119, 1128, 1144, 1148, 1174, 1190, 
+1206, 1224, 1240, 1250, 1264, 1274, 1290, 1304, 1330, 1344, 1358, 1372, 1384, 1387, 1399, };
+
+
+inline constexpr uint8_t Sans18Widths[] {
+5, 6, 6, 10, 10, 16, 12, 4, 6, 6, 7, 11, 5, 6, 5, 5, 
+10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5, 5, 11, 11, 11, 10, 
+18, 12, 12, 13, 13, 11, 11, 14, 13, 5, 10, 12, 10, 15, 13, 14, 
+12, 14, 13, 12, 11, 13, 12, 17, 12, 12, 11, 5, 5, 5, 8, 10, 
+5, 10, 10, 9, 10, 10, 5, 10, 10, 4, 4, 9, 4, 15, 10, 10, 
+10, 10, 6, 9, 5, 10, 9, 13, 9, 9, 9, 6, 5, 6, 9, };
+
+
 /****** Font Definition ******/
 
-const BdfFont Sans18 
+inline const BdfFont Sans18 
 {
 	///Start address for bitmaps
 	Sans18Bitmaps,
@@ -313,9 +491,19 @@ const BdfFont Sans18
 	///Highest ASCII encoding
 	126,
 	/// Vertical step
-	18
+	18,
+	/// Start address for column-major bitmaps
+	Sans18Columns,
+	/// Start address for column-major glyph offsets
+	Sans18ColumnIndex,
+	/// Max rise above the baseline
+	14,
+	/// Max drop below the baseline (zero or negative)
+	-4,
+	/// Start address for the advance widths
+	Sans18Widths
 };
 
 /****************************/
 
-#endif
+
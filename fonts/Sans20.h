@@ -1,8 +1,8 @@
 
 #pragma once
 
-#include <inttypes.h>
-#include "fontServer.h"
+#include <cinttypes>
+#include "bdfFont.h"
 
 /****** Font Summary ********
 Tag			Sans20
@@ -25,7 +25,7 @@ Max Drop -4
 V Step	19
 ****************************/
 
-const BdfGlyph Sans20Glyphs[] {
+ inline constexpr BdfGlyph Sans20Glyphs[] {
 {0, 1, 1, 5, 0, 0},			// 0x20			space
 {1, 2, 15, 7, 2, 0},			// 0x21			exclam
 {16, 5, 5, 7, 1, 9},			// 0x22			quotedbl
@@ -124,7 +124,7 @@ const BdfGlyph Sans20Glyphs[] {
 };
 
 
-const uint8_t Sans20Bitmaps[] {
+inline constexpr uint8_t Sans20Bitmaps[] {
 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x40, 
 0x40, 0x40, 0x40, 0x40, 0x00, 0xC0, 0xC0, 0xD8, 0xD8, 
 0xD8, 0x98, 0x80, 0x0C, 0xC0, 0x08, 0x80, 0x08, 0x80, 
@@ -356,9 +356,207 @@ const uint8_t Sans20Bitmaps[] {
 };
 
 
+inline constexpr uint8_t Sans20Columns[] {
+0x00, 0xFE, 0x06, 0xFF, 0xF6, 0xF8, 0xE0, 0x00, 0xF0, 
+0xF0, 0x00, 0x40, 0x08, 0x40, 0x08, 0x7C, 0x0F, 0xF0, 
+0xFE, 0x40, 0x88, 0x40, 0x08, 0x7C, 0x0F, 0xF0, 0xFE, 
+0x40, 0x88, 0x40, 0x08, 0x00, 0x3E, 0x1C, 0x00, 0x7F, 
+0x0E, 0x00, 0x63, 0x02, 0x00, 0x41, 0x82, 0x00, 0xFF, 
+0xFF, 0xC0, 0x41, 0x82, 0x00, 0x61, 0x82, 0x00, 0x38, 
+0xCE, 0x00, 0x18, 0x7C, 0x00, 0x7C, 0x00, 0x46, 0x00, 
+0xC2, 0x00, 0xC2, 0x00, 0x46, 0x0C, 0x7C, 0x38, 0x00, 
+0xE0, 0x01, 0x80, 0x06, 0x00, 0x18, 0x30, 0x70, 0xFC, 
+0xC0, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0xCC, 0x00, 
+0x78, 0x00, 0x70, 0x01, 0xFC, 0x79, 0x8C, 0xCF, 0x04, 
+0x87, 0x04, 0x87, 0x84, 0xCC, 0xCC, 0x78, 0x78, 0x00, 
+0x78, 0x01, 0xFC, 0x00, 0x0C, 0xF0, 0xF0, 0x00, 0x60, 
+0x00, 0x0F, 0xFE, 0x00, 0x3C, 0x03, 0x80, 0x60, 0x00, 
+0x60, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x20, 0x70, 0x00, 
+0xC0, 0x1F, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x20, 0x3C, 
+0xF8, 0x18, 0x24, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 
+0x00, 0x08, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x08, 0x00, 
+0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0xC8, 0xF0, 0x80, 
+0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0x00, 0x06, 0x00, 
+0x3C, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x00, 0x80, 0x00, 
+0x1F, 0xE0, 0x7F, 0xF8, 0xE0, 0x0C, 0xC0, 0x04, 0x80, 
+0x04, 0xC0, 0x04, 0xE0, 0x0C, 0x7F, 0xF8, 0x1F, 0xF0, 
+0x10, 0x00, 0x30, 0x00, 0x30, 0x00, 0x7F, 0xFC, 0xFF, 
+0xFC, 0x38, 0x1C, 0x78, 0x7C, 0xC0, 0x6C, 0xC0, 0xCC, 
+0x81, 0x8C, 0x81, 0x8C, 0xC3, 0x0C, 0x7E, 0x0C, 0x3C, 
+0x0C, 0x30, 0x38, 0x70, 0x1C, 0xC0, 0x0C, 0x83, 0x04, 
+0x82, 0x04, 0xC3, 0x04, 0xC7, 0x0C, 0x7D, 0xFC, 0x38, 
+0xF0, 0x01, 0xE0, 0x03, 0x60, 0x06, 0x60, 0x1C, 0x60, 
+0x30, 0x60, 0x60, 0x60, 0xFF, 0xFC, 0x00, 0x60, 0x00, 
+0x60, 0x07, 0x18, 0xFF, 0x1C, 0xC6, 0x0C, 0xC4, 0x04, 
+0xC4, 0x04, 0xC4, 0x04, 0xC6, 0x0C, 0xC3, 0xF8, 0xC1, 
+0xF0, 0x1F, 0xF0, 0x7F, 0xF8, 0xE3, 0x0C, 0xC6, 0x04, 
+0x86, 0x04, 0x86, 0x04, 0xC6, 0x0C, 0x73, 0xFC, 0x31, 
+0xF0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x1C, 0xC0, 0x7C, 
+0xC3, 0xC0, 0xC7, 0x00, 0xDC, 0x00, 0xF0, 0x00, 0xE0, 
+0x00, 0x38, 0xF8, 0x7D, 0xFC, 0xC7, 0x0C, 0xC2, 0x04, 
+0x82, 0x04, 0xC2, 0x04, 0xC7, 0x0C, 0x7D, 0xFC, 0x38, 
+0xF8, 0x3E, 0x10, 0x7F, 0x1C, 0xC1, 0x8C, 0x81, 0x84, 
+0x80, 0x84, 0xC1, 0x84, 0xC1, 0x0C, 0x7F, 0xF8, 0x3F, 
+0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC8, 0xC0, 0xF0, 
+0x18, 0x00, 0x1C, 0x00, 0x14, 0x00, 0x36, 0x00, 0x26, 
+0x00, 0x62, 0x00, 0x43, 0x00, 0xC1, 0x00, 0xC1, 0x80, 
+0x80, 0x80, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 
+0x98, 0x98, 0x98, 0x81, 0x80, 0xC1, 0x80, 0x41, 0x00, 
+0x63, 0x00, 0x62, 0x00, 0x26, 0x00, 0x34, 0x00, 0x14, 
+0x00, 0x1C, 0x00, 0x08, 0x00, 0x38, 0x00, 0x60, 0x00, 
+0xC0, 0x00, 0xC0, 0xE6, 0xC1, 0xE6, 0xC3, 0x00, 0x7E, 
+0x00, 0x3C, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0x1E, 0x00, 
+0x1C, 0x07, 0x00, 0x30, 0x03, 0x00, 0x20, 0x61, 0x80, 
+0x61, 0xF8, 0x80, 0x43, 0x0C, 0xC0, 0xC6, 0x0C, 0xC0, 
+0xC4, 0x0C, 0xC0, 0xC4, 0x08, 0xC0, 0xC4, 0x38, 0xC0, 
+0xC3, 0xFC, 0xC0, 0x47, 0xCC, 0x80, 0x64, 0x0C, 0x00, 
+0x30, 0x0C, 0x00, 0x38, 0x18, 0x00, 0x1F, 0xF0, 0x00, 
+0x07, 0xC0, 0x00, 0x00, 0x02, 0x00, 0x0E, 0x00, 0x7C, 
+0x03, 0xF0, 0x1F, 0x60, 0xFC, 0x60, 0xE0, 0x60, 0xF8, 
+0x60, 0x3F, 0x60, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1E, 
+0x00, 0x02, 0xFF, 0xFE, 0xC1, 0x06, 0xC1, 0x06, 0xC1, 
+0x06, 0xC1, 0x06, 0xC1, 0x06, 0xC1, 0x06, 0x63, 0x86, 
+0x7E, 0xCC, 0x1C, 0xFC, 0x0F, 0xF0, 0x3F, 0xF8, 0x70, 
+0x0C, 0x60, 0x06, 0xC0, 0x06, 0xC0, 0x02, 0xC0, 0x02, 
+0xC0, 0x02, 0xC0, 0x06, 0x60, 0x0E, 0x38, 0x3C, 0x18, 
+0x38, 0xFF, 0xFE, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 
+0xC0, 0x06, 0xC0, 0x06, 0x40, 0x06, 0x60, 0x06, 0x70, 
+0x1C, 0x3F, 0xF8, 0x0F, 0xE0, 0xFF, 0xFE, 0xC1, 0x06, 
+0xC1, 0x06, 0xC1, 0x06, 0xC1, 0x06, 0xC1, 0x06, 0xC1, 
+0x06, 0xC1, 0x06, 0xC1, 0x06, 0xC0, 0x06, 0xFF, 0xFE, 
+0xC1, 0x00, 0xC1, 0x00, 0xC1, 0x00, 0xC1, 0x00, 0xC1, 
+0x00, 0xC1, 0x00, 0xC1, 0x00, 0xC0, 0x00, 0x0F, 0xF0, 
+0x1F, 0xF8, 0x30, 0x1C, 0x60, 0x06, 0x40, 0x06, 0xC0, 
+0x02, 0xC0, 0x02, 0xC1, 0x82, 0xC1, 0x82, 0x61, 0x86, 
+0x71, 0x8C, 0x39, 0xF8, 0x19, 0xFE, 0xFF, 0xFE, 0x01, 
+0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 
+0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFF, 0xFE, 0xFF, 
+0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0x3C, 0x00, 0x3E, 
+0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x06, 0xFF, 
+0xFE, 0xFF, 0xF8, 0xFF, 0xFE, 0x00, 0xC0, 0x01, 0x80, 
+0x03, 0x00, 0x07, 0x00, 0x0D, 0xC0, 0x18, 0xE0, 0x30, 
+0x38, 0x60, 0x1C, 0xC0, 0x06, 0x80, 0x02, 0xFF, 0xFE, 
+0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 
+0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0xFF, 0xFE, 
+0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 
+0x3E, 0x00, 0x06, 0x00, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 
+0x7C, 0x00, 0xE0, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xE0, 
+0x00, 0x38, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x03, 0xC0, 
+0x00, 0xE0, 0x00, 0x38, 0x00, 0x1C, 0xFF, 0xFE, 0xFF, 
+0xFE, 0x0F, 0xE0, 0x1F, 0xF8, 0x30, 0x1C, 0x60, 0x06, 
+0x40, 0x06, 0xC0, 0x02, 0xC0, 0x02, 0xC0, 0x02, 0xC0, 
+0x02, 0x60, 0x06, 0x60, 0x0E, 0x38, 0x1C, 0x1F, 0xF8, 
+0x07, 0xE0, 0xFF, 0xFE, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 
+0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0x63, 0x80, 
+0x7F, 0x00, 0x3E, 0x00, 0x0F, 0xE0, 0x1F, 0xF8, 0x30, 
+0x1C, 0x60, 0x06, 0x40, 0x06, 0xC0, 0x02, 0xC0, 0x02, 
+0xC0, 0x02, 0xC0, 0x1A, 0x60, 0x0E, 0x60, 0x0E, 0x38, 
+0x1E, 0x1F, 0xFB, 0x07, 0xC0, 0xFF, 0xFE, 0xC1, 0x80, 
+0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 
+0x80, 0x41, 0x80, 0x63, 0xC0, 0x7E, 0xFE, 0x1C, 0x06, 
+0x18, 0x38, 0x3E, 0x3C, 0x67, 0x06, 0xC3, 0x06, 0xC3, 
+0x02, 0xC1, 0x02, 0xC1, 0x82, 0xC1, 0x82, 0x61, 0x86, 
+0x78, 0xEE, 0x18, 0x7C, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 
+0x00, 0xC0, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xC0, 0x00, 
+0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 
+0xFC, 0x00, 0x1C, 0x00, 0x06, 0x00, 0x02, 0x00, 0x02, 
+0x00, 0x02, 0x00, 0x02, 0x00, 0x06, 0x00, 0x0E, 0xFF, 
+0xFC, 0xFF, 0xF0, 0x80, 0x00, 0xF0, 0x00, 0x7E, 0x00, 
+0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x06, 0x00, 
+0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x00, 0xF0, 0x00, 
+0x80, 0x00, 0x80, 0x00, 0xF8, 0x00, 0x7F, 0x80, 0x07, 
+0xF8, 0x00, 0x3E, 0x00, 0x1E, 0x01, 0xF8, 0x0F, 0xC0, 
+0xFC, 0x00, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x00, 
+0xFC, 0x00, 0x0E, 0x00, 0x7E, 0x0F, 0xF0, 0xFF, 0x00, 
+0xF0, 0x00, 0xC0, 0x06, 0xE0, 0x0E, 0x78, 0x3C, 0x1C, 
+0x70, 0x0F, 0xE0, 0x03, 0x80, 0x07, 0xC0, 0x1C, 0x70, 
+0x38, 0x38, 0xE0, 0x0E, 0xC0, 0x06, 0x80, 0x00, 0x80, 
+0x00, 0xC0, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x0E, 0x00, 
+0x07, 0x80, 0x01, 0xFE, 0x03, 0xFE, 0x07, 0x00, 0x1E, 
+0x00, 0x78, 0x00, 0xE0, 0x00, 0xC0, 0x00, 0xC0, 0x0E, 
+0xC0, 0x1E, 0xC0, 0x3E, 0xC0, 0xE6, 0xC1, 0xC6, 0xC3, 
+0x86, 0xCE, 0x06, 0xDC, 0x06, 0xF8, 0x06, 0xF0, 0x06, 
+0xC0, 0x06, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0xC0, 
+0x00, 0x20, 0xC0, 0x00, 0x20, 0xC0, 0x00, 0x3C, 0x00, 
+0x07, 0x80, 0x00, 0x70, 0x00, 0x0E, 0xC0, 0x00, 0x20, 
+0xC0, 0x00, 0x20, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 
+0x02, 0x1E, 0x70, 0xC0, 0xE0, 0x1C, 0x06, 0x80, 0x80, 
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+0x80, 0x80, 0xC0, 0x60, 0x33, 0xE0, 0x73, 0x60, 0xC6, 
+0x20, 0xC4, 0x20, 0xC4, 0x20, 0xC4, 0x60, 0x6C, 0xC0, 
+0x7F, 0xE0, 0x00, 0x20, 0xFF, 0xFE, 0xFF, 0xFE, 0x06, 
+0x06, 0x04, 0x02, 0x0C, 0x02, 0x0C, 0x02, 0x0C, 0x06, 
+0x07, 0x0E, 0x03, 0xFC, 0x00, 0xE0, 0x3F, 0xC0, 0x71, 
+0xE0, 0x40, 0x60, 0xC0, 0x20, 0xC0, 0x20, 0xC0, 0x20, 
+0x60, 0x60, 0x31, 0xC0, 0x01, 0x00, 0x03, 0xF8, 0x07, 
+0x1E, 0x0E, 0x06, 0x0C, 0x02, 0x0C, 0x02, 0x0C, 0x02, 
+0x06, 0x06, 0xFF, 0xFE, 0xFF, 0xFE, 0x3F, 0x80, 0x74, 
+0xE0, 0x44, 0x60, 0xC4, 0x20, 0xC4, 0x20, 0xC4, 0x20, 
+0x64, 0x60, 0x7C, 0xC0, 0x1C, 0x80, 0x04, 0x00, 0x04, 
+0x00, 0x7F, 0xFE, 0xC4, 0x00, 0xC4, 0x00, 0x3F, 0x8C, 
+0x71, 0xEE, 0x40, 0x62, 0xC0, 0x22, 0xC0, 0x22, 0x40, 
+0x22, 0x60, 0x46, 0x7F, 0xFC, 0x7F, 0xF0, 0xFF, 0xFE, 
+0xFF, 0xFE, 0x06, 0x00, 0x04, 0x00, 0x0C, 0x00, 0x0C, 
+0x00, 0x0C, 0x00, 0x07, 0xFE, 0x01, 0xFE, 0xE7, 0xFE, 
+0xE7, 0xFE, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0xE7, 
+0xFF, 0xE0, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0xC0, 0x01, 
+0x80, 0x03, 0xE0, 0x06, 0x78, 0x04, 0x1C, 0x04, 0x0E, 
+0x00, 0x02, 0xFF, 0xFE, 0xFF, 0xFE, 0x7F, 0xE0, 0x7F, 
+0xE0, 0x60, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 
+0x7F, 0xE0, 0x7F, 0xE0, 0x60, 0x00, 0xC0, 0x00, 0xC0, 
+0x00, 0xC0, 0x00, 0xFF, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 
+0x7F, 0xE0, 0x60, 0x00, 0x40, 0x00, 0xC0, 0x00, 0xC0, 
+0x00, 0xC0, 0x00, 0x7F, 0xE0, 0x1F, 0xE0, 0x3F, 0xC0, 
+0x71, 0xE0, 0x40, 0x60, 0xC0, 0x20, 0xC0, 0x20, 0xC0, 
+0x20, 0x60, 0x60, 0x7F, 0xC0, 0x1F, 0x80, 0x7F, 0xFE, 
+0x7F, 0xFE, 0x60, 0x60, 0x40, 0x20, 0xC0, 0x20, 0xC0, 
+0x20, 0xC0, 0x60, 0x70, 0xE0, 0x3F, 0xC0, 0x06, 0x00, 
+0x3F, 0xC0, 0x71, 0xE0, 0x60, 0x60, 0xC0, 0x20, 0xC0, 
+0x20, 0xC0, 0x20, 0x60, 0x60, 0x7F, 0xFE, 0x7F, 0xFE, 
+0x7F, 0xE0, 0x7F, 0xE0, 0x60, 0x00, 0xC0, 0x00, 0xC0, 
+0x00, 0x38, 0xC0, 0x7C, 0xE0, 0xCC, 0x20, 0xC4, 0x20, 
+0xC6, 0x20, 0xC6, 0x20, 0x63, 0xE0, 0x23, 0xC0, 0x10, 
+0x00, 0x10, 0x00, 0xFF, 0xF8, 0x10, 0x18, 0x10, 0x08, 
+0xFF, 0x80, 0xFF, 0xC0, 0x00, 0xC0, 0x00, 0x40, 0x00, 
+0x40, 0x00, 0x40, 0x01, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 
+0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xC0, 0x03, 
+0xC0, 0x1F, 0x00, 0xF8, 0x00, 0xE0, 0x00, 0x80, 0x00, 
+0xF0, 0x00, 0x7E, 0x00, 0x07, 0xC0, 0x03, 0xC0, 0x3F, 
+0x00, 0xF0, 0x00, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xC0, 
+0x01, 0xC0, 0x1F, 0x80, 0xF8, 0x00, 0xC0, 0x00, 0x80, 
+0xC0, 0xE1, 0x80, 0x77, 0x00, 0x1C, 0x00, 0x3E, 0x00, 
+0x63, 0x80, 0xC1, 0xC0, 0x80, 0x40, 0xE0, 0x04, 0x7C, 
+0x04, 0x0F, 0x9C, 0x01, 0xF8, 0x07, 0xC0, 0x1E, 0x00, 
+0xF8, 0x00, 0xC0, 0x00, 0x81, 0xC0, 0x83, 0xC0, 0x86, 
+0x40, 0x8C, 0x40, 0x98, 0x40, 0xF0, 0x40, 0xE0, 0x40, 
+0x80, 0x40, 0x00, 0x60, 0x00, 0x3F, 0xFF, 0x80, 0x7F, 
+0x9F, 0xE0, 0xC0, 0x00, 0x20, 0xC0, 0x00, 0x20, 0xFF, 
+0xFF, 0xE0, 0xC0, 0x00, 0x20, 0xC0, 0x00, 0x20, 0x7F, 
+0xBF, 0xE0, 0x00, 0xF0, 0x00, 0x00, 0x60, 0x00, 0x60, 
+0xC0, 0xC0, 0x40, 0x20, 0x30, 0x30, 0x60, };
+
+
+inline constexpr uint16_t Sans20ColumnIndex[] {
+0, 1, 5, 10, 32, 59, 91, 113, 115, 130, 142, 148, 168, 170, 175, 177, 
+189, 207, 217, 235, 253, 271, 289, 307, 325, 343, 361, 365, 369, 389, 399, 419, 
+435, 489, 515, 535, 559, 581, 601, 619, 645, 667, 671, 687, 709, 727, 753, 775, 
+803, 823, 851, 873, 895, 917, 939, 965, 1001, 1025, 1051, 1073, 1085, 1095, 1107, 1114, 
+1126, 1129, 1147, 1167, 1185, 1203, 1221, 1231, 1249, 1267, 1271, 1280, 1298, 1302, 1330, 1348, 
+1366, 1386, 1404, 1414, 1430, 1440, 1458, 1474, 1502, 1518, 1534, 1550, 1565, 1568, 1583, };
+
+
+inline constexpr uint8_t Sans20Widths[] {
+5, 7, 7, 11, 11, 18, 13, 4, 7, 7, 8, 12, 6, 7, 5, 6, 
+11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 5, 5, 12, 12, 12, 11, 
+20, 13, 13, 14, 14, 13, 12, 15, 14, 6, 11, 13, 11, 17, 15, 16, 
+13, 16, 14, 13, 13, 14, 13, 19, 13, 14, 12, 6, 6, 6, 9, 11, 
+5, 11, 11, 10, 11, 11, 6, 11, 11, 4, 5, 10, 4, 16, 11, 11, 
+11, 11, 7, 10, 6, 11, 10, 14, 10, 10, 10, 7, 5, 7, 10, };
+
+
 /****** Font Definition ******/
 
-const BdfFont Sans20 
+inline const BdfFont Sans20 
 {
 	///Start address for bitmaps
 	Sans20Bitmaps,
@@ -369,9 +567,19 @@ const BdfFont Sans20
 	///Highest ASCII encoding
 	126,
 	/// Vertical step
-	19
+	19,
+	/// Start address for column-major bitmaps
+	Sans20Columns,
+	/// Start address for column-major glyph offsets
+	Sans20ColumnIndex,
+	/// Max rise above the baseline
+	15,
+	/// Max drop below the baseline (zero or negative)
+	-4,
+	/// Start address for the advance widths
+	Sans20Widths
 };
 
 /****************************/
 
-#endif
+
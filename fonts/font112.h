@@ -1,9 +1,10 @@
-#pragma once
 
-#include "fontServer.h"
+#pragma once
 
+#include <cinttypes>
+#include "bdfFont.h"
 
-/****** Font Summary *******
+/****** Font Summary ********
 Tag			font112
 Width		383
 Height		189
@@ -22,45932 +23,10283 @@ DWidth	22 to 114
 Max Rise 86
 Max Drop -24
 V Step	110
+****************************/
+
+ inline constexpr BdfGlyph font112Glyphs[] {
+{0, 1, 1, 28, 0, 0},			// 0x20			space
+{1, 9, 82, 37, 14, 0},			// 0x21			exclam
+{165, 29, 27, 37, 4, 52},			// 0x22			quotedbl
+{273, 59, 80, 62, 2, -2},			// 0x23			numbersign
+{913, 54, 100, 62, 4, -14},			// 0x24			dollar
+{1613, 93, 81, 100, 3, -2},			// 0x25			percent
+{2585, 65, 82, 75, 6, -3},			// 0x26			ampersand
+{3323, 10, 27, 22, 6, 52},			// 0x27			quotesingle
+{3377, 25, 106, 37, 8, -24},			// 0x28			parenleft
+{3801, 25, 106, 37, 4, -24},			// 0x29			parenright
+{4225, 33, 33, 44, 5, 49},			// 0x2a			asterisk
+{4390, 54, 54, 65, 6, -1},			// 0x2b			plus
+{4768, 12, 28, 31, 10, -16},			// 0x2c			comma
+{4824, 27, 8, 37, 5, 27},			// 0x2d			hyphen
+{4856, 12, 12, 28, 9, 0},			// 0x2e			period
+{4880, 33, 84, 31, -1, -2},			// 0x2f			slash
+{5300, 52, 82, 62, 5, -3},			// 0x30			zero
+{5874, 28, 79, 62, 11, 0},			// 0x31			one
+{6190, 53, 79, 62, 4, 0},			// 0x32			two
+{6743, 53, 82, 62, 4, -3},			// 0x33			three
+{7317, 55, 79, 62, 3, 0},			// 0x34			four
+{7870, 53, 82, 62, 4, -3},			// 0x35			five
+{8444, 52, 82, 62, 5, -3},			// 0x36			six
+{9018, 53, 79, 62, 5, 0},			// 0x37			seven
+{9571, 53, 82, 62, 4, -3},			// 0x38			eight
+{10145, 53, 82, 62, 4, -3},			// 0x39			nine
+{10719, 12, 59, 28, 9, 0},			// 0x3a			colon
+{10837, 12, 75, 28, 9, -16},			// 0x3b			semicolon
+{10987, 55, 54, 65, 5, -1},			// 0x3c			less
+{11365, 54, 28, 65, 6, 12},			// 0x3d			equal
+{11561, 54, 54, 65, 6, -1},			// 0x3e			greater
+{11939, 48, 83, 62, 9, 0},			// 0x3f			question
+{12437, 103, 99, 114, 4, -16},			// 0x40			at
+{13724, 71, 82, 75, 2, 0},			// 0x41			A
+{14462, 61, 82, 74, 9, 0},			// 0x42			B
+{15118, 71, 86, 79, 4, -3},			// 0x43			C
+{15892, 65, 82, 78, 9, 0},			// 0x44			D
+{16630, 59, 82, 71, 9, 0},			// 0x45			E
+{17286, 55, 82, 67, 9, 0},			// 0x46			F
+{17860, 75, 86, 86, 4, -3},			// 0x47			G
+{18720, 63, 82, 81, 9, 0},			// 0x48			H
+{19376, 11, 82, 31, 11, 0},			// 0x49			I
+{19540, 46, 85, 59, 4, -3},			// 0x4a			J
+{20050, 64, 82, 75, 9, 0},			// 0x4b			K
+{20706, 51, 82, 63, 9, 0},			// 0x4c			L
+{21280, 77, 82, 95, 9, 0},			// 0x4d			M
+{22100, 64, 82, 82, 9, 0},			// 0x4e			N
+{22756, 79, 86, 88, 4, -3},			// 0x4f			O
+{23616, 59, 82, 73, 9, 0},			// 0x50			P
+{24272, 79, 89, 88, 4, -6},			// 0x51			Q
+{25162, 66, 82, 79, 9, 0},			// 0x52			R
+{25900, 65, 86, 75, 5, -3},			// 0x53			S
+{26674, 64, 82, 71, 3, 0},			// 0x54			T
+{27330, 63, 85, 81, 9, -3},			// 0x55			U
+{28010, 69, 82, 72, 2, 0},			// 0x56			V
+{28748, 101, 82, 105, 2, 0},			// 0x57			W
+{29814, 70, 82, 74, 2, 0},			// 0x58			X
+{30552, 72, 82, 76, 2, 0},			// 0x59			Y
+{31290, 63, 82, 69, 3, 0},			// 0x5a			Z
+{31946, 21, 106, 31, 7, -24},			// 0x5b			bracketleft
+{32264, 33, 84, 31, -1, -2},			// 0x5c			backslash
+{32684, 21, 106, 31, 2, -24},			// 0x5d			bracketright
+{33002, 42, 42, 53, 5, 37},			// 0x5e			asciicircum
+{33254, 67, 6, 62, -2, -20},			// 0x5f			underscore
+{33308, 23, 17, 28, 3, 66},			// 0x60			grave
+{33359, 56, 63, 61, 3, -3},			// 0x61			a
+{33800, 52, 85, 63, 7, -3},			// 0x62			b
+{34395, 50, 63, 57, 3, -3},			// 0x63			c
+{34836, 53, 85, 63, 3, -3},			// 0x64			d
+{35431, 53, 63, 60, 3, -3},			// 0x65			e
+{35872, 27, 82, 31, 2, 0},			// 0x66			f
+{36200, 52, 84, 62, 3, -24},			// 0x67			g
+{36788, 46, 82, 60, 7, 0},			// 0x68			h
+{37280, 10, 82, 25, 7, 0},			// 0x69			i
+{37444, 19, 106, 27, 0, -24},			// 0x6a			j
+{37762, 49, 82, 58, 7, 0},			// 0x6b			k
+{38336, 9, 82, 24, 7, 0},			// 0x6c			l
+{38500, 77, 60, 91, 7, 0},			// 0x6d			m
+{39100, 46, 60, 60, 7, 0},			// 0x6e			n
+{39460, 53, 63, 60, 3, -3},			// 0x6f			o
+{39901, 52, 84, 63, 7, -24},			// 0x70			p
+{40489, 53, 84, 63, 3, -24},			// 0x71			q
+{41077, 28, 60, 37, 7, 0},			// 0x72			r
+{41317, 47, 63, 55, 4, -3},			// 0x73			s
+{41695, 27, 78, 31, 2, -3},			// 0x74			t
+{42007, 46, 62, 60, 7, -3},			// 0x75			u
+{42379, 53, 59, 56, 1, 0},			// 0x76			v
+{42792, 79, 59, 81, 1, 0},			// 0x77			w
+{43382, 51, 59, 53, 1, 0},			// 0x78			x
+{43795, 51, 83, 54, 1, -24},			// 0x79			y
+{44376, 48, 59, 54, 3, 0},			// 0x7a			z
+{44730, 26, 106, 37, 5, -24},			// 0x7b			braceleft
+{45154, 6, 106, 28, 11, -24},			// 0x7c			bar
+{45260, 26, 106, 37, 6, -24},			// 0x7d			braceright
+{45684, 48, 19, 56, 4, 30},			// 0x7e			asciitilde
+};
+
+
+inline constexpr uint8_t font112Bitmaps[] {
+0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 
+0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 
+0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 
+0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 
+0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 
+0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 
+0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 
+0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 
+0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 
+0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x80, 0x7F, 
+0x80, 0x7F, 0x80, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 
+0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x3F, 
+0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3E, 0x00, 
+0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 
+0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 
+0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 
+0x80, 0xFF, 0x80, 0xFF, 0xE0, 0x3F, 0xF8, 0xFF, 0xE0, 
+0x3F, 0xF8, 0xFF, 0xE0, 0x3F, 0xF8, 0xFF, 0xE0, 0x3F, 
+0xF8, 0xFF, 0xE0, 0x3F, 0xF8, 0xFF, 0xE0, 0x3F, 0xF8, 
+0xFF, 0xE0, 0x3F, 0xF8, 0xFF, 0xE0, 0x3F, 0xF8, 0xFF, 
+0xE0, 0x3F, 0xF8, 0xFF, 0xE0, 0x3F, 0xF8, 0xFF, 0xE0, 
+0x3F, 0xF8, 0xFF, 0xE0, 0x3F, 0xF8, 0x7F, 0xE0, 0x3F, 
+0xF8, 0x7F, 0xE0, 0x1F, 0xF8, 0x7F, 0xC0, 0x1F, 0xF0, 
+0x7F, 0xC0, 0x1F, 0xF0, 0x7F, 0xC0, 0x1F, 0xF0, 0x3F, 
+0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0x80, 
+0x0F, 0xE0, 0x3F, 0x80, 0x0F, 0xE0, 0x3F, 0x80, 0x0F, 
+0xE0, 0x1F, 0x80, 0x07, 0xE0, 0x1F, 0x80, 0x07, 0xE0, 
+0x1F, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x07, 0xC0, 0x1F, 
+0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 
+0xF0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 
+0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 
+0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 
+0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 
+0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 
+0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 
+0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 
+0x00, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 
+0x1F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 
+0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 
+0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 
+0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 
+0x07, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x07, 
+0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFC, 
+0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xF8, 0x00, 
+0x00, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x00, 
+0x00, 0x03, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 
+0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 
+0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 
+0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 
+0xF0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 
+0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 
+0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 
+0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 
+0x1F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 
+0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 
+0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0x80, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0x80, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 
+0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 
+0x07, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x07, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF1, 0xFC, 0x3F, 0xFF, 
+0x00, 0x07, 0xFF, 0x81, 0xFC, 0x0F, 0xFF, 0x00, 0x0F, 
+0xFF, 0x01, 0xFC, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x01, 
+0xFC, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFC, 0x00, 
+0xFF, 0xC0, 0x1F, 0xF0, 0x01, 0xFC, 0x00, 0xFF, 0xC0, 
+0x3F, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 
+0x01, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xE0, 0x01, 0xFC, 
+0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 
+0xE0, 0x7F, 0xC0, 0x01, 0xFC, 0x00, 0x3F, 0xE0, 0x7F, 
+0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xE0, 0x7F, 0xC0, 0x01, 
+0xFC, 0x00, 0x1F, 0xF0, 0x7F, 0xC0, 0x01, 0xFC, 0x00, 
+0x1F, 0xF0, 0x7F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x01, 0xFC, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0x01, 0xFC, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 
+0xF8, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x01, 
+0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x01, 0xFC, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0x01, 0xFC, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xF1, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x01, 0xFC, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 
+0xFC, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x03, 
+0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0xF0, 
+0x00, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x00, 
+0x01, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xFC, 
+0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0F, 
+0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 
+0x00, 0x01, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 
+0xFC, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x01, 0xFC, 0x00, 
+0x07, 0xFC, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x07, 0xFC, 
+0xFF, 0x80, 0x01, 0xFC, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x01, 0xFC, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x01, 0xFC, 
+0x00, 0x07, 0xFC, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xFC, 0xFF, 
+0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x01, 
+0xFC, 0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x01, 0xFC, 0x00, 
+0x1F, 0xF8, 0x7F, 0xE0, 0x01, 0xFC, 0x00, 0x1F, 0xF8, 
+0x3F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 
+0x01, 0xFC, 0x00, 0x7F, 0xF0, 0x3F, 0xF8, 0x01, 0xFC, 
+0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x01, 0xFC, 0x01, 0xFF, 
+0xE0, 0x1F, 0xFF, 0x01, 0xFC, 0x03, 0xFF, 0xC0, 0x0F, 
+0xFF, 0xC1, 0xFC, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0xF9, 
+0xFC, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 
+0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 
+0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 
+0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 
+0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 
+0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0x80, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x01, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 
+0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x00, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x07, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 
+0xFC, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x00, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 
+0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0x80, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x3F, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 
+0xF8, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 
+0xF0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0x83, 0xFF, 0xE0, 0x01, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 
+0x80, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 
+0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 
+0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 
+0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 
+0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 
+0x3F, 0xFC, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 
+0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 
+0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 
+0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x01, 
+0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0x80, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 
+0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 
+0x00, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x01, 
+0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 
+0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 
+0x00, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 
+0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0F, 
+0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 
+0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 
+0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 
+0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 
+0x3F, 0xFC, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 
+0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0x07, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0x8F, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFD, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xF0, 0x00, 0x7F, 
+0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x7F, 0xF0, 0x00, 0x7F, 
+0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x7F, 0xF8, 0x00, 0x7F, 
+0xC0, 0x00, 0x07, 0xFF, 0x80, 0x3F, 0xFC, 0x00, 0x7F, 
+0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 
+0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 
+0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x80, 0xFF, 
+0x80, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x80, 0xFF, 
+0x80, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 
+0x80, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xE1, 0xFF, 
+0x80, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFC, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xF8, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF8, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 
+0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 
+0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFC, 
+0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFE, 
+0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 
+0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0x80, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xF9, 0xFF, 
+0xE0, 0x00, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0xFF, 
+0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 
+0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 
+0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 
+0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 
+0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 
+0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 
+0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 
+0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 
+0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 
+0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0, 0x7F, 0xC0, 
+0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x3F, 0x80, 0x3F, 
+0x80, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x1F, 0x00, 
+0x1F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 
+0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFE, 0x00, 
+0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 
+0x03, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 
+0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 
+0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 
+0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 
+0x7F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 
+0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 
+0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 
+0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 
+0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xF8, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 
+0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 
+0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 
+0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 
+0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 
+0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 
+0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 
+0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 
+0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 
+0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xF8, 
+0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 
+0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 
+0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 
+0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0x80, 
+0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 
+0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 
+0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 
+0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 
+0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 
+0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 
+0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7E, 0x00, 
+0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 
+0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 
+0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 
+0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF8, 
+0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 
+0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 
+0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
+0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 
+0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 
+0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 
+0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 
+0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xF8, 
+0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 
+0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 
+0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 
+0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFE, 
+0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 
+0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 
+0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 
+0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 
+0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 
+0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 
+0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 
+0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFE, 
+0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 
+0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 
+0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xF8, 
+0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 
+0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 
+0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 
+0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 
+0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 
+0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 
+0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 
+0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 
+0x07, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 
+0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 
+0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 
+0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 
+0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 
+0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 
+0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 
+0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 
+0x07, 0xF0, 0x00, 0x00, 0x70, 0x07, 0xF0, 0x07, 0x00, 
+0x7E, 0x07, 0xF0, 0x3F, 0x00, 0x7F, 0xC7, 0xF1, 0xFF, 
+0x00, 0xFF, 0xF7, 0xE7, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x7F, 
+0x00, 0x00, 0x00, 0xFF, 0x7F, 0x80, 0x00, 0x01, 0xFE, 
+0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x1F, 0xE0, 0x00, 0x07, 
+0xFC, 0x1F, 0xF0, 0x00, 0x07, 0xF8, 0x0F, 0xF0, 0x00, 
+0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x07, 0xF0, 0x07, 0xF0, 
+0x00, 0x03, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0xC0, 0x01, 
+0x80, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 
+0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 
+0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 
+0xFF, 0xF0, 0xFF, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 
+0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 
+0x07, 0xE0, 0x07, 0xE0, 0x07, 0xC0, 0x0F, 0xC0, 0x1F, 
+0x80, 0xFF, 0x80, 0xFF, 0x00, 0xFE, 0x00, 0xF8, 0x00, 
+0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 
+0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 
+0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 
+0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xF0, 0xFF, 0xF0, 
+0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 
+0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 
+0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 
+0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 
+0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 
+0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 
+0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 
+0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 
+0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 
+0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 
+0x07, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 
+0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 
+0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 
+0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 
+0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 
+0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 
+0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 
+0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x01, 
+0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 
+0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 
+0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 
+0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0, 
+0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 
+0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 
+0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 
+0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 
+0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E, 
+0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 
+0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 
+0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 
+0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8, 
+0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 
+0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 
+0x07, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 
+0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 
+0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 
+0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x1F, 
+0x80, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 
+0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 
+0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 
+0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x00, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00, 0x01, 
+0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xE0, 
+0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 
+0xFC, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 
+0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 
+0x00, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 
+0x07, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 
+0x00, 0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x1F, 
+0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 
+0x00, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x01, 
+0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 
+0xE0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x7F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x7F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x7F, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 
+0xE0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0xFF, 0xE0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 
+0x80, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x1F, 
+0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x00, 
+0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 
+0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 
+0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFF, 
+0x00, 0x00, 0x0F, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x00, 
+0x1F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 
+0x00, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x01, 
+0xFF, 0xF8, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 
+0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 
+0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 
+0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 
+0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 
+0x00, 0x07, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 
+0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 
+0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 
+0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 
+0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 
+0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 
+0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 
+0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 
+0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 
+0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 
+0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
+0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 
+0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x00, 
+0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x00, 0x07, 0xFF, 
+0xC0, 0x07, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x0F, 
+0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 
+0x00, 0x00, 0xFF, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x7F, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x1F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 
+0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 
+0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 
+0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x00, 
+0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x1F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x07, 0xFF, 
+0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 
+0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xFF, 
+0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
+0x07, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 
+0x80, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x1F, 
+0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 
+0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 
+0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x00, 0x00, 
+0x00, 0xFF, 0xE0, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 
+0xE0, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x1F, 
+0xFE, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 
+0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 
+0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x00, 
+0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xE0, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x00, 
+0x03, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFE, 
+0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 
+0x00, 0x00, 0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0x00, 
+0x00, 0x1F, 0xF8, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x3F, 
+0xE0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xE0, 0x00, 0x00, 0x01, 
+0xFF, 0x80, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 
+0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 
+0x00, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x00, 
+0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 
+0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 
+0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 
+0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 
+0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 
+0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 
+0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 
+0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 
+0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0xE0, 
+0x00, 0x00, 0x0F, 0xFC, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 
+0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF9, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 
+0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 
+0x9F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0xFF, 
+0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 
+0x1F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x1F, 0xFE, 
+0x00, 0x00, 0x03, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 
+0x01, 0xFF, 0xE0, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 
+0xE0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x3F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 
+0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 
+0xC0, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x0F, 
+0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0xE0, 
+0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x03, 0xFF, 
+0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x70, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xC3, 0xFF, 
+0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 
+0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x01, 0xFF, 
+0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 
+0x07, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 
+0x80, 0x07, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x07, 
+0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xFF, 
+0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x00, 
+0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
+0xC1, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xC3, 0xFF, 
+0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x00, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 
+0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 
+0xFF, 0x87, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 
+0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 
+0x80, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x80, 0xFF, 
+0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 
+0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x01, 
+0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x7F, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xC0, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 
+0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 
+0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x7F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 
+0xC0, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x07, 
+0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 
+0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x7F, 
+0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x03, 0xFF, 0xFC, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 
+0x07, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x7F, 
+0xFE, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 
+0x07, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 
+0x00, 0x00, 0x03, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x00, 
+0x03, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 
+0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 
+0xFF, 0xE0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0x1F, 0xF8, 0x00, 0x00, 
+0x00, 0xFF, 0xE0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 
+0xE0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 
+0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x01, 
+0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x80, 
+0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x03, 0xFF, 
+0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x00, 
+0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x00, 0x03, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x07, 
+0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 
+0x00, 0x07, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x00, 0x03, 
+0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xE0, 
+0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 
+0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x3F, 0xF8, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 
+0x00, 0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 
+0xE0, 0x1F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 
+0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 
+0x00, 0x3F, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x01, 0xFF, 
+0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFE, 0x07, 0xFF, 
+0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xFC, 0x00, 
+0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 
+0x80, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
+0x07, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 
+0x80, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x3F, 
+0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x3F, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x3F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 
+0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 
+0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 0xF0, 0x00, 
+0x00, 0x00, 0xFF, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x00, 
+0xFF, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF8, 
+0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x1F, 0xFE, 
+0x00, 0x00, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0x00, 0x00, 
+0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 
+0xF8, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xF8, 0x07, 
+0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x9F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF8, 
+0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F, 0xF8, 0x00, 0x1F, 
+0xFF, 0xFF, 0xFC, 0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 
+0xF0, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 
+0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 
+0x00, 0x02, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x01, 
+0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 
+0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x1F, 0xF8, 
+0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x07, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 
+0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 
+0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x80, 
+0x00, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0xFF, 
+0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 
+0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 
+0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 
+0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 
+0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 
+0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 
+0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 
+0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 
+0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 
+0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 
+0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 
+0xFF, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 
+0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xE0, 0x07, 0xE0, 
+0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0xC0, 0xFF, 
+0x80, 0xFF, 0x00, 0xFE, 0x00, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x07, 
+0xFF, 0xF8, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x1F, 
+0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 
+0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFE, 0x7F, 
+0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 
+0x0F, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 
+0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 
+0x00, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 
+0x00, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x01, 
+0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x03, 0xFF, 
+0x00, 0xFF, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0x03, 0xFE, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x83, 0xFE, 0x00, 
+0x3F, 0xF8, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFF, 0xC7, 0xFE, 0x00, 0x3F, 0xF8, 0x07, 0xFE, 0x00, 
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE7, 0xFC, 0x00, 0x1F, 
+0xF8, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 
+0xE7, 0xFC, 0x00, 0x1F, 0xF8, 0x0F, 0xFC, 0x00, 0x00, 
+0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x1F, 0xFC, 
+0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x07, 0xFF, 
+0xF8, 0x00, 0x0F, 0xFC, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 
+0xF0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xFC, 0x1F, 
+0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF8, 
+0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 
+0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 
+0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 
+0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0xF0, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 
+0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x07, 
+0xFC, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 
+0xFF, 0xE0, 0x00, 0x07, 0xFE, 0x7F, 0xC0, 0x00, 0x0F, 
+0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 
+0x7F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x0F, 0xFC, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xFF, 
+0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x07, 0xFC, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0xFF, 0xC0, 
+0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x0F, 0xFC, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0xFF, 0x80, 0x00, 
+0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F, 
+0xFC, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 
+0xFF, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x80, 0x00, 0x3F, 
+0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 
+0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 
+0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 
+0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x3F, 0xF8, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 
+0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 
+0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 
+0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 
+0xE0, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 
+0xF8, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x3F, 
+0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 
+0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 
+0x00, 0x03, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF8, 
+0x00, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x7F, 
+0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 
+0x07, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 
+0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x7F, 0xF0, 
+0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 
+0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x03, 
+0xFF, 0xF8, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 
+0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 
+0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0xF0, 0x7F, 0xEF, 
+0xFF, 0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 
+0x1F, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 
+0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 
+0xFE, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 
+0xF8, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 
+0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x00, 
+0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xEF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0x87, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0x83, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0x83, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 
+0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 
+0x07, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 
+0x0F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 
+0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 
+0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x01, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x01, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x01, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x03, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x03, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x03, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x07, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x07, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x0F, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x3F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x7F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x7F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x3F, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 
+0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 
+0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0xFF, 
+0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 
+0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 
+0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 
+0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x7F, 
+0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x01, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x07, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x07, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x07, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x01, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x01, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x7F, 
+0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 
+0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x1F, 
+0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 
+0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 
+0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 
+0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 
+0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 
+0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 
+0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 
+0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 
+0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFE, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x07, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 
+0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0x80, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 
+0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 
+0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 
+0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xE0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xE0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xE0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x3F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xE0, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x03, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 
+0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0xE0, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xE0, 
+0x00, 0x00, 0x07, 0xFF, 0xBF, 0xE0, 0x00, 0x0F, 0xFF, 
+0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x3F, 0xE0, 0x00, 0x07, 
+0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x3F, 0xE0, 0x00, 
+0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xE0, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 
+0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 
+0xFF, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0E, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 
+0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 
+0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 
+0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 
+0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 
+0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 
+0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 
+0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 
+0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 
+0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 
+0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 
+0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 
+0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 
+0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 
+0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 
+0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 
+0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 
+0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 
+0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 
+0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xE0, 
+0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 
+0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xE0, 
+0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 
+0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xE0, 
+0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 
+0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 
+0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 
+0xF8, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 0xF8, 
+0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 
+0xF0, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xFE, 
+0x00, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 
+0xE0, 0x1F, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 
+0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 
+0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 
+0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 
+0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 
+0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x01, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xC1, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC7, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC7, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0xFF, 0xCF, 0xFE, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0xFF, 0xDF, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xF8, 0x7F, 0xF8, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xC0, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 
+0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x07, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 
+0xC0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 
+0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x00, 
+0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 
+0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x1F, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 
+0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 
+0x80, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x80, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x3F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 
+0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xF8, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xF8, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xF8, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xDF, 0xF8, 0xFF, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xDF, 0xF8, 0xFF, 0xDF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xDF, 0xF8, 0xFF, 0xDF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x9F, 0xF8, 0xFF, 0xCF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x9F, 0xF8, 0xFF, 0xCF, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0xF8, 0xFF, 0xCF, 
+0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x1F, 0xF8, 0xFF, 
+0xC7, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x1F, 0xF8, 
+0xFF, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x1F, 
+0xF8, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 
+0x1F, 0xF8, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x03, 
+0xFE, 0x1F, 0xF8, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x00, 
+0x03, 0xFE, 0x1F, 0xF8, 0xFF, 0xC1, 0xFF, 0x00, 0x00, 
+0x00, 0x07, 0xFC, 0x1F, 0xF8, 0xFF, 0xC1, 0xFF, 0x00, 
+0x00, 0x00, 0x07, 0xFC, 0x1F, 0xF8, 0xFF, 0xC1, 0xFF, 
+0x00, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0xF8, 0xFF, 0xC0, 
+0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xF8, 0xFF, 
+0xC0, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xF8, 
+0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 
+0xF8, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 
+0x1F, 0xF8, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 
+0xF0, 0x1F, 0xF8, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 
+0x1F, 0xF0, 0x1F, 0xF8, 0xFF, 0xC0, 0x3F, 0xE0, 0x00, 
+0x00, 0x3F, 0xE0, 0x1F, 0xF8, 0xFF, 0xC0, 0x3F, 0xE0, 
+0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF8, 0xFF, 0xC0, 0x3F, 
+0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF8, 0xFF, 0xC0, 
+0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF8, 0xFF, 
+0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF8, 
+0xFF, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 
+0xF8, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 
+0x1F, 0xF8, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 
+0x80, 0x1F, 0xF8, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 
+0xFF, 0x80, 0x1F, 0xF8, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 
+0x01, 0xFF, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x07, 0xFC, 
+0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x07, 
+0xFC, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 
+0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF8, 0xFF, 
+0xC0, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF8, 
+0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x1F, 
+0xF8, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 
+0x1F, 0xF8, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 
+0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0x07, 
+0xFC, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 
+0x0F, 0xF8, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0xFF, 
+0x80, 0x0F, 0xF8, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 
+0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 
+0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0xFF, 
+0xC0, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 
+0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x1F, 0xF0, 0x00, 0x1F, 
+0xF8, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 
+0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 
+0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x3F, 
+0xE0, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 
+0x7F, 0xC0, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x1F, 
+0xF0, 0x7F, 0xC0, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 
+0x1F, 0xF8, 0x7F, 0xC0, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 
+0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0xFF, 
+0xC0, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 
+0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0xFF, 0x80, 0x00, 0x1F, 
+0xF8, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0xFF, 0x00, 0x00, 
+0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0xFF, 0x00, 
+0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 
+0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 
+0xFE, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x03, 
+0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 
+0x03, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 
+0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 
+0xC0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 
+0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 
+0xF8, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 
+0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 
+0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 
+0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 
+0xF0, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xDF, 0xFC, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFE, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xC7, 0xFF, 0x80, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xC1, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xC1, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x7F, 
+0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x7F, 0xF8, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xC0, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 
+0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 
+0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 
+0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 
+0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 
+0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x03, 
+0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 
+0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 
+0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 
+0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 
+0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 
+0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 
+0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x80, 
+0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x03, 
+0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x3F, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 
+0xFE, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 
+0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x03, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x03, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x83, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0xFF, 0xE3, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0xFF, 0xF3, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x7F, 0xF3, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 
+0xFB, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 
+0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFE, 
+0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 
+0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 
+0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 
+0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 
+0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 
+0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFE, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x0F, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
+0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xF8, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xF8, 0x1F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 
+0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 
+0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xF8, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x01, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 
+0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 
+0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 
+0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 
+0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 
+0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 
+0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 
+0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x01, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x03, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 
+0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xC0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x1F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x1F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 
+0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 
+0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF8, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xF8, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xF8, 0x1F, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x20, 0x00, 0x7F, 0xF0, 0x0F, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x70, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFF, 0xF0, 0x07, 
+0xFF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0xE0, 
+0x07, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xFF, 
+0xE0, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x83, 
+0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 
+0xC7, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x03, 
+0xFF, 0xE7, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 
+0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 
+0x3F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 
+0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xF8, 
+0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 
+0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xE0, 0x00, 
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 
+0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 
+0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 
+0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 
+0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 
+0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 
+0xC0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 
+0x80, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x7F, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x07, 0xFF, 
+0xE0, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 
+0xFC, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 
+0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xF8, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 
+0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x1F, 
+0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x1F, 0xFF, 
+0x80, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 
+0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x00, 
+0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x01, 
+0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xE0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xE0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xE0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 
+0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 
+0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 
+0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 
+0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 
+0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 
+0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 
+0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 
+0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 
+0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 
+0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 
+0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 
+0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 
+0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFF, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFE, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x01, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x03, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x07, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x07, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x87, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x8F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x8F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xCF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xDF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xF8, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x7F, 0xF8, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xF0, 
+0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF8, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x7F, 
+0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0xFF, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0xFF, 0xE0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 
+0xE0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 
+0x00, 0x00, 0x01, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 
+0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 
+0x00, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 
+0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 
+0x03, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 
+0xDF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x0F, 0xFE, 
+0x00, 0x00, 0x00, 0xFF, 0xDF, 0xF8, 0x00, 0x00, 0x03, 
+0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x9F, 
+0xF8, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0x00, 
+0x00, 0x00, 0xFF, 0x8F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 
+0x00, 0x07, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x8F, 0xFC, 
+0x00, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 
+0x01, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 
+0x07, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xFC, 0x00, 
+0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 
+0xFF, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x03, 
+0xFF, 0x80, 0x00, 0x03, 0xFF, 0x07, 0xFE, 0x00, 0x00, 
+0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFE, 
+0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 
+0x80, 0x00, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x00, 0x0F, 
+0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x03, 
+0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 
+0x00, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 
+0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0x03, 0xFF, 
+0x00, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 
+0x07, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 
+0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 
+0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 
+0xFC, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 
+0xFF, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x00, 
+0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xF8, 
+0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 
+0xE0, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 
+0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 
+0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 
+0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xF0, 
+0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 
+0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 
+0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 
+0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 
+0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 
+0x3F, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 
+0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 
+0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 
+0x1F, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 
+0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0xC0, 
+0x00, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x1F, 
+0xF8, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 
+0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x00, 
+0x00, 0x0F, 0xFE, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 
+0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x01, 0xFF, 
+0x80, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x03, 
+0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0x00, 
+0x00, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x03, 0xFF, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 
+0x07, 0xFE, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x07, 0xFE, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x03, 
+0xFF, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x87, 
+0xFE, 0x00, 0x00, 0x03, 0xFF, 0x07, 0xFE, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0x87, 0xFC, 0x00, 0x00, 0x01, 0xFF, 
+0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x87, 0xFC, 
+0x00, 0x00, 0x01, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x8F, 
+0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x8F, 0xFC, 0x00, 
+0x00, 0x01, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xCF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xCF, 0xF8, 0x00, 0x00, 
+0x00, 0xFF, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xDF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xDF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xDF, 0xF8, 0x00, 0x00, 0x00, 
+0xFF, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x1F, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 
+0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 
+0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFE, 
+0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 
+0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 
+0x80, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 
+0x80, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 
+0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xF8, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFE, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFE, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0x83, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0x87, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xCF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xEF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xDF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xCF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFE, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0x80, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 
+0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 
+0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFE, 
+0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFC, 
+0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 
+0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x3F, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x7F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x7F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x7F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x3F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x1F, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x0F, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xF8, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 
+0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 
+0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 
+0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 
+0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 
+0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 
+0x80, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 
+0xC0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 
+0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 
+0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 
+0xF0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 
+0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0x80, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0x80, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xC1, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xC1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xE3, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xF7, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
+0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF8, 0xFF, 
+0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 
+0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 
+0xFF, 0xF8, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x80, 0x00, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 
+0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 
+0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 
+0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x1F, 
+0x80, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 
+0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 
+0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 
+0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0, 
+0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 
+0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 
+0x03, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 
+0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 
+0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x1F, 
+0x80, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 
+0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 
+0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 
+0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0, 
+0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 
+0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 
+0x03, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 
+0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 
+0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 
+0x80, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 
+0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 
+0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 
+0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0, 
+0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 
+0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 
+0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 
+0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 
+0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0xFF, 0xF8, 0xFF, 
+0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 
+0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 
+0xFF, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 
+0x0F, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 
+0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 
+0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x07, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF3, 0xFC, 
+0x00, 0x00, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x00, 0x00, 
+0x0F, 0xF1, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE1, 0xFE, 
+0x00, 0x00, 0x00, 0x1F, 0xE0, 0xFE, 0x00, 0x00, 0x00, 
+0x1F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 
+0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 
+0x7F, 0x80, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x3F, 
+0x80, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x00, 0x00, 
+0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x1F, 
+0xE0, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x01, 
+0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x0F, 
+0xF0, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x03, 
+0xFC, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 
+0xF8, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x07, 
+0xF0, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x01, 
+0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x1F, 
+0xE0, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x00, 
+0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x3F, 
+0xC0, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x00, 0x00, 
+0x7F, 0x80, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x7F, 
+0x80, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 
+0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 
+0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 
+0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x03, 
+0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 
+0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 
+0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF8, 0x00, 
+0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 
+0xFE, 0x03, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 
+0x3F, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 
+0x00, 0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0F, 
+0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 
+0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 
+0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 
+0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 
+0x00, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xF0, 0x00, 0x00, 
+0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 
+0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 
+0xFF, 0xFD, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xE1, 
+0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x80, 
+0x1F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xFF, 
+0xC0, 0x00, 0x01, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x00, 
+0x01, 0xFF, 0x80, 0x3F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 
+0x80, 0x7F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x7F, 
+0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 
+0x00, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x00, 0x01, 
+0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 
+0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 
+0x00, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 
+0x03, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 
+0x80, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x7F, 
+0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 
+0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 
+0xFF, 0x80, 0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x80, 
+0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 
+0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 
+0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x07, 
+0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 
+0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 
+0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 
+0x38, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x07, 
+0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 
+0x00, 0x00, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 
+0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x87, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x8F, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x00, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 
+0xBF, 0xFF, 0x1F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 
+0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 
+0xFE, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 
+0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0xFF, 0xFC, 
+0x00, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x00, 
+0x03, 0xFF, 0x80, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 
+0xC0, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x7F, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 
+0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 
+0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x00, 0x01, 
+0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x80, 
+0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0xFE, 
+0x00, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
+0x1F, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFE, 
+0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 
+0x7F, 0xFC, 0x07, 0xFF, 0xFC, 0x00, 0xFF, 0x3F, 0xFF, 
+0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x00, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 
+0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x03, 
+0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 
+0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF0, 
+0x00, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 
+0xFE, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00, 
+0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFE, 
+0x00, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 
+0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 
+0x80, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x3F, 
+0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 
+0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 
+0x00, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x00, 0x01, 
+0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x80, 
+0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFF, 
+0x00, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x00, 
+0x0F, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFE, 
+0x00, 0x03, 0xFF, 0xF0, 0x00, 0x7F, 0xFC, 0x00, 0x01, 
+0xFF, 0xFE, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x1F, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 
+0xE0, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x0F, 
+0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x0F, 0xF8, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 
+0xFF, 0xFF, 0x8F, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 
+0xCF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 
+0x01, 0xFF, 0xFF, 0xCF, 0xFF, 0xEF, 0xF8, 0x03, 0xFF, 
+0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x00, 
+0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 
+0xF8, 0x0F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x0F, 
+0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x1F, 0xFE, 0x00, 
+0x00, 0x01, 0xFF, 0xF8, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0xFF, 0xF8, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF8, 
+0x3F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 
+0x00, 0x3F, 0xF8, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 
+0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x1F, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x7F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xC0, 
+0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 
+0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x7F, 0xF0, 0x00, 
+0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x3F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 
+0x3F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0xFF, 0xF8, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0xFF, 0xF8, 0x1F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 
+0xF8, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x0F, 
+0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 
+0x00, 0x07, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x00, 0x1F, 
+0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x00, 0x7F, 0xF7, 0xF8, 
+0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xF7, 0xF8, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xE7, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC7, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x87, 
+0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0x00, 
+0x0F, 0xFF, 0xFF, 0xFE, 0x07, 0xF8, 0x00, 0x07, 0xFF, 
+0xFF, 0xFC, 0x07, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 
+0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 
+0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 
+0x1F, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x07, 0xFF, 
+0x80, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x0F, 
+0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0xFF, 0xE0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 
+0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x00, 
+0x1F, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x1F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0x1F, 0xF8, 0x00, 0x00, 
+0x00, 0x7F, 0xE0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 
+0xE0, 0x0F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 
+0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 
+0x00, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 
+0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 
+0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 
+0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 
+0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 
+0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xE0, 
+0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 
+0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 
+0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 
+0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 
+0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 
+0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x03, 
+0xFF, 0xFF, 0xF0, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 
+0xF8, 0x3F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x1F, 
+0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xF0, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFF, 0x9F, 0xF0, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x9F, 0xF0, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 
+0xDF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 
+0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0x07, 0xFF, 
+0x80, 0x00, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0x00, 0x00, 
+0x07, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 
+0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x1F, 
+0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x1F, 0xF8, 0x00, 
+0x00, 0x01, 0xFF, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 
+0xFF, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 
+0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x7F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 
+0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xC0, 0x00, 
+0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 
+0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x3F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 
+0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 
+0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF0, 0x00, 
+0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 
+0xFF, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF0, 
+0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x1F, 0xFC, 
+0x00, 0x00, 0x03, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 
+0x03, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 
+0xF0, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF0, 0x07, 
+0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 
+0x00, 0x7F, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x03, 0xFF, 
+0xBF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xF0, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xF0, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFE, 0x3F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x3F, 
+0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 
+0x01, 0xFF, 0xFF, 0x80, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 
+0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 
+0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 
+0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 
+0x00, 0x01, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x00, 0x01, 
+0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 
+0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 
+0x80, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 
+0x7F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x9F, 0xFF, 0xFC, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 
+0x80, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0xFF, 0xFF, 
+0xFE, 0x00, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 
+0x87, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x8F, 0xFF, 0xFF, 
+0xFF, 0xE0, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 
+0x9F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xBF, 0xF0, 0x07, 
+0xFF, 0xF8, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0xFF, 
+0xFF, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0xFE, 0x00, 0x00, 
+0x3F, 0xFC, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 
+0xF8, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xF0, 0x00, 0x00, 
+0x0F, 0xFC, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0xFF, 
+0xE0, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 
+0x07, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0xFF, 
+0xC0, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 
+0x07, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0xFF, 
+0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 
+0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 
+0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 
+0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 
+0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 
+0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 
+0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 
+0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 
+0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 
+0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 
+0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 
+0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 
+0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFC, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 
+0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 
+0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 
+0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 
+0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 
+0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 
+0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 
+0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 
+0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 
+0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 
+0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 
+0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 
+0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 
+0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 
+0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 
+0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 
+0xE0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 
+0xE0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 
+0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0x3F, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 
+0xF8, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 
+0xFF, 0x80, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0x80, 
+0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x07, 
+0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x7F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 
+0x00, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0xE0, 0x00, 0x00, 
+0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 
+0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFF, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0xFF, 0x87, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x8F, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0xFF, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x9F, 0xFC, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFE, 0x00, 0x00, 0x00, 
+0xFF, 0xFE, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 
+0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x07, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 
+0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 
+0xC0, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xF8, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 
+0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x07, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 
+0xC0, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xC0, 0x00, 
+0xFF, 0x80, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x7F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0x1F, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 
+0xFE, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0x80, 
+0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 
+0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 
+0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 
+0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 
+0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 
+0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 
+0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 
+0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 
+0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 
+0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 
+0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 
+0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 
+0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 
+0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 
+0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 
+0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 
+0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 
+0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 
+0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 
+0x0F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 
+0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 
+0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFE, 
+0x00, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 
+0xFF, 0x00, 0xFF, 0x07, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 
+0xFF, 0xFF, 0x80, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x07, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 
+0x8F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x3F, 0xFF, 0xFF, 
+0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x7F, 0xE0, 
+0x1F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0xFF, 0xFF, 
+0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xF0, 0xFF, 
+0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xF8, 
+0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 
+0xF8, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 
+0x3F, 0xF8, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 
+0x00, 0x1F, 0xF8, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 
+0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 
+0xF8, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 
+0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 
+0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 
+0x80, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 
+0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 
+0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 
+0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 
+0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 
+0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 
+0xE0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 
+0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 
+0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 
+0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 
+0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 
+0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 
+0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 
+0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 
+0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 
+0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 
+0xE0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 
+0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 
+0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 
+0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 
+0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 
+0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 
+0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 
+0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 
+0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 
+0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 
+0xE0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 
+0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 
+0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 
+0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 
+0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 
+0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 
+0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 
+0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 
+0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 
+0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 
+0xE0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 
+0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 
+0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 
+0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 
+0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 
+0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 
+0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 
+0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 
+0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xE0, 
+0x00, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0xFF, 0x00, 
+0x7F, 0xFF, 0xFE, 0x00, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 
+0x80, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x07, 
+0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 
+0xF0, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x3F, 
+0xF0, 0x03, 0xFF, 0xF8, 0xFF, 0x7F, 0xC0, 0x00, 0xFF, 
+0xF8, 0xFF, 0x7F, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0xFE, 
+0x00, 0x00, 0x3F, 0xFC, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 
+0xFC, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xF8, 
+0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xF0, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0xE0, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0xC0, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 
+0x07, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x7F, 
+0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x00, 
+0x07, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 
+0x00, 0x00, 0x03, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 
+0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x1F, 
+0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x3F, 0xF8, 0x00, 
+0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x7F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 
+0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 
+0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xC0, 0x00, 
+0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x00, 
+0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x00, 
+0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 
+0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF8, 0x00, 
+0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 
+0x7F, 0xE0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
+0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x0F, 0xFE, 
+0x00, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x00, 
+0x03, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x00, 0x07, 0xFF, 
+0x80, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x03, 
+0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xFE, 
+0x01, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 
+0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 
+0x00, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 
+0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x03, 
+0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x07, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 
+0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x7F, 0xFF, 
+0x1F, 0xFF, 0xFC, 0x00, 0xFF, 0x7F, 0xF0, 0x01, 0xFF, 
+0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0x00, 
+0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xFE, 
+0x00, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x00, 
+0x07, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 
+0x80, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 
+0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x7F, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 
+0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x00, 0x01, 
+0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 
+0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xFC, 
+0x00, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0xFE, 0x00, 0x00, 
+0x0F, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 
+0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0xFF, 
+0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 
+0x07, 0xFF, 0xFC, 0x00, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 
+0xF8, 0x00, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0x87, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x83, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0xFF, 0x81, 0xFF, 0xFF, 0xFE, 0x00, 
+0x00, 0xFF, 0x80, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 
+0x80, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x78, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xE0, 0x07, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x07, 
+0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x07, 0xF8, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0x00, 0x3F, 0xFF, 
+0xFF, 0xFF, 0x87, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 
+0xC7, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF8, 
+0x01, 0xFF, 0xFF, 0xCF, 0xFF, 0xF7, 0xF8, 0x03, 0xFF, 
+0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x00, 
+0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 
+0xF8, 0x07, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x0F, 
+0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x0F, 0xFE, 0x00, 
+0x00, 0x01, 0xFF, 0xF8, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0xFF, 0xF8, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF8, 
+0x3F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 
+0x00, 0x3F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 
+0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x1F, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x7F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xC0, 
+0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 
+0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x7F, 0xF0, 0x00, 
+0x00, 0x00, 0x3F, 0xF8, 0x7F, 0xF0, 0x00, 0x00, 0x00, 
+0x3F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 
+0x3F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0xFF, 0xF8, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0xFF, 0xF8, 0x1F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 
+0xF8, 0x1F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x0F, 
+0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 
+0x00, 0x07, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x00, 0x1F, 
+0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF8, 
+0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xEF, 0xF8, 0x01, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xCF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x8F, 
+0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFE, 0x0F, 0xF8, 0x00, 0x07, 0xFF, 
+0xFF, 0xF8, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 
+0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xF0, 
+0xFF, 0x00, 0xFF, 0xF0, 0xFF, 0x01, 0xFF, 0xF0, 0xFF, 
+0x03, 0xFF, 0xF0, 0xFF, 0x07, 0xFF, 0xF0, 0xFF, 0x0F, 
+0xFF, 0xF0, 0xFF, 0x1F, 0xFF, 0xF0, 0xFF, 0x1F, 0xFF, 
+0xF0, 0xFF, 0x3F, 0xFF, 0xF0, 0xFF, 0x7F, 0xF0, 0x00, 
+0xFF, 0x7F, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
+0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 
+0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 
+0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 
+0x00, 0x03, 0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 
+0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF0, 
+0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 
+0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 
+0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 
+0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x03, 
+0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0xC0, 
+0x00, 0x00, 0x03, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x07, 
+0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xF0, 
+0x00, 0x00, 0x07, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 
+0xFE, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xFC, 
+0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 
+0xF8, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 
+0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 
+0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 
+0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 
+0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 
+0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 
+0xE0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 
+0x00, 0x00, 0x38, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x1F, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x3F, 
+0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0xFF, 0xC0, 
+0x00, 0x00, 0x7F, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 
+0xFC, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFC, 0xFF, 0xF8, 
+0x00, 0x03, 0xFF, 0xFC, 0x7F, 0xFC, 0x00, 0x07, 0xFF, 
+0xFC, 0x7F, 0xFF, 0x00, 0x1F, 0xFB, 0xFC, 0x3F, 0xFF, 
+0xFF, 0xFF, 0xF3, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xE3, 
+0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFC, 0x0F, 0xFF, 
+0xFF, 0xFF, 0x83, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x03, 
+0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x3F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 
+0xF8, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 
+0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF0, 0x00, 
+0x00, 0x00, 0x7F, 0xE0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 
+0x7F, 0xE0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
+0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 
+0x80, 0x0F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x07, 
+0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 
+0x00, 0x03, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 
+0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 
+0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 
+0x80, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 
+0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 
+0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 
+0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 
+0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 
+0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x1F, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 
+0x80, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0x00, 
+0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 
+0xFE, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x03, 
+0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x03, 0xFE, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0x07, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x8F, 0xF8, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0x8F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x9F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xDF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xE0, 
+0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 
+0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 
+0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 
+0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 
+0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 
+0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 
+0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 
+0xFE, 0x00, 0x00, 0x3F, 0xF8, 0x1F, 0xF8, 0x00, 0x00, 
+0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 
+0x01, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 
+0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x1F, 
+0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 
+0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 
+0xE0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 
+0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x80, 
+0x00, 0x7F, 0xE0, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0xFF, 
+0x80, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x03, 0xFC, 
+0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x07, 
+0xFC, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 
+0x07, 0xFC, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 
+0x00, 0x07, 0xF8, 0x7F, 0xC0, 0x01, 0xFF, 0x80, 0x03, 
+0xFF, 0x00, 0x07, 0xF8, 0x7F, 0xC0, 0x01, 0xFF, 0x80, 
+0x03, 0xFF, 0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x01, 0xFF, 
+0x80, 0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x7F, 0xE0, 0x01, 
+0xFF, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 
+0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x0F, 0xF0, 0x3F, 
+0xE0, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xF0, 
+0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x1F, 
+0xF0, 0x3F, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 
+0x1F, 0xE0, 0x1F, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0xFF, 
+0xC0, 0x1F, 0xE0, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 
+0x7F, 0xC0, 0x3F, 0xE0, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 
+0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x0F, 0xF8, 0x0F, 0xFC, 
+0x00, 0x00, 0x7F, 0xE0, 0x3F, 0xC0, 0x0F, 0xF8, 0x0F, 
+0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x3F, 0xC0, 0x0F, 0xF8, 
+0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x0F, 
+0xF8, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 
+0x07, 0xFC, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 
+0x80, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 
+0x7F, 0x80, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 
+0xF0, 0xFF, 0x80, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 
+0x1F, 0xF0, 0xFF, 0x80, 0x03, 0xFE, 0x3F, 0xF0, 0x00, 
+0x00, 0x1F, 0xF8, 0xFF, 0x00, 0x03, 0xFE, 0x3F, 0xE0, 
+0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x03, 0xFE, 0x3F, 
+0xE0, 0x00, 0x00, 0x0F, 0xF9, 0xFF, 0x00, 0x03, 0xFE, 
+0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF9, 0xFF, 0x00, 0x01, 
+0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0x00, 
+0x01, 0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0xFE, 
+0x00, 0x01, 0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFD, 
+0xFE, 0x00, 0x01, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x03, 
+0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 
+0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 
+0x7F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 
+0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 
+0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
+0x3F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x1F, 0xF8, 
+0x00, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x00, 
+0x03, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 
+0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x07, 
+0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 
+0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 
+0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 
+0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 
+0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0x80, 
+0x00, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x00, 0x00, 
+0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x07, 0xFE, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0x9F, 0xF8, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0x9F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x0F, 
+0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x0F, 0xFE, 0x00, 
+0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x00, 
+0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 
+0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 
+0x7F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 
+0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x07, 
+0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 
+0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 
+0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 
+0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x3F, 0xF0, 
+0x00, 0x00, 0x01, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 
+0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 
+0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF0, 
+0x00, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xF0, 0x00, 0x00, 
+0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 
+0x00, 0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 
+0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 
+0xFE, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 
+0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 
+0x00, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 
+0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x01, 
+0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 
+0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 
+0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x3F, 0xE0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 
+0x01, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 
+0x00, 0x00, 0x00, 0x1F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 
+0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 
+0xF8, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x07, 
+0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 
+0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x00, 
+0x07, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x03, 0xFE, 0x1F, 0xF8, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x3F, 
+0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xE0, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 
+0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1F, 
+0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 
+0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 
+0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 
+0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 
+0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 
+0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 
+0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 
+0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 
+0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 
+0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 
+0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 
+0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 
+0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 
+0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 
+0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 
+0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 
+0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 
+0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 
+0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 
+0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 
+0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 
+0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 
+0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 
+0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 
+0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 
+0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 
+0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 
+0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 
+0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 
+0x1F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x07, 
+0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 
+0xC0, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFE, 
+0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 
+0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 
+0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
+0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 
+0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 
+0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 
+0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 
+0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 
+0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 
+0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 
+0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 
+0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 
+0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x01, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 
+0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 
+0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 
+0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0x1F, 0xFF, 0xFE, 
+0x00, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 
+0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0x7F, 0xEF, 0xFF, 
+0xF0, 0x00, 0x3F, 0x7F, 0x81, 0xFF, 0xF8, 0x00, 0x7F, 
+0x7F, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 
+0xFF, 0x80, 0xFE, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 
+0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0xFC, 0x00, 0x01, 
+0xFF, 0xFF, 0xFC, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 
+0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, };
+
+
+inline constexpr uint8_t font112Columns[] {
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x03, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF8, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0x03, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 
+0xC0, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 
+0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 
+0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 
+0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 
+0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 
+0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 
+0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 
+0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 
+0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 
+0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 
+0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0x00, 
+0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFF, 
+0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0xFF, 
+0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x9F, 
+0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 
+0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFC, 
+0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 
+0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
+0x7F, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 
+0xFF, 0xC3, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 
+0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 
+0x00, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 
+0x00, 0x00, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 
+0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 
+0x7F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00, 
+0x00, 0x7F, 0x80, 0x1F, 0xFF, 0x00, 0x00, 0x03, 0xFC, 
+0x00, 0x00, 0x7F, 0x87, 0xFF, 0xFF, 0x00, 0x00, 0x03, 
+0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+0x03, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 
+0x00, 0x03, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x00, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0x80, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0x80, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x80, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 
+0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFB, 0xFC, 0x00, 0x00, 
+0x7F, 0x80, 0x00, 0x00, 0xFF, 0xFE, 0x03, 0xFC, 0x00, 
+0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFC, 
+0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x03, 
+0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 
+0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 
+0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 
+0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 
+0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x7F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 
+0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x7F, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 
+0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 
+0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 
+0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 
+0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 
+0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
+0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 
+0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 
+0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x7F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFC, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 
+0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 
+0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 
+0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 
+0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 
+0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x07, 
+0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x07, 
+0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 
+0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 
+0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFC, 
+0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 
+0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 
+0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 
+0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 
+0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x80, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x1F, 0xE0, 0x00, 
+0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x1F, 
+0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0x80, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0x80, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x07, 
+0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x07, 0xFE, 
+0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 
+0x07, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 
+0xFE, 0x00, 0x03, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 
+0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 
+0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 
+0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 
+0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0x7F, 0xFE, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x07, 
+0xFE, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 
+0x00, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 
+0x80, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 
+0x00, 0x7F, 0x80, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 
+0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 
+0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 
+0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0F, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0x80, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 
+0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 
+0x07, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 
+0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 
+0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0x00, 0x01, 
+0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 
+0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x00, 0x00, 
+0x07, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x03, 0xFE, 
+0x00, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 
+0x07, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x1F, 0xFF, 
+0xFF, 0xFF, 0xCF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 
+0x3F, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x00, 0x00, 0x01, 
+0xFF, 0x80, 0x3F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x01, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7F, 
+0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 
+0x80, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x00, 0x07, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x00, 
+0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x80, 
+0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x7F, 0x80, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0xFF, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 
+0x80, 0xFF, 0x00, 0x00, 0x1F, 0xF7, 0xFF, 0xF0, 0x00, 
+0x01, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xF1, 0xFF, 
+0xF8, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x7F, 
+0xE0, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xC0, 
+0x00, 0xFF, 0xC0, 0x7F, 0xFF, 0x00, 0x07, 0xFE, 0x00, 
+0x7F, 0xE0, 0x01, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x0F, 
+0xFE, 0x00, 0x7F, 0xF8, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 
+0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 
+0x07, 0xFF, 0xF0, 0x1F, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 
+0xFF, 0x00, 0x03, 0xFF, 0xF8, 0x3F, 0xF8, 0x00, 0x1F, 
+0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFC, 0x7F, 0xF0, 
+0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 
+0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF9, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0x80, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFF, 0xFE, 0x00, 
+0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 
+0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 
+0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 
+0xFF, 0xE0, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x03, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 
+0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0x80, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x40, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xC0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x3F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 
+0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 
+0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0x80, 0x08, 0x00, 0x00, 0x3F, 0x80, 
+0x3C, 0x00, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x00, 0x1F, 
+0x80, 0xFE, 0x00, 0x00, 0x1F, 0xC1, 0xFF, 0x00, 0x00, 
+0x1F, 0xC7, 0xFF, 0x80, 0x00, 0x0F, 0xCF, 0xFE, 0x00, 
+0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xF0, 
+0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xF7, 0xFF, 0xE0, 0x00, 
+0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 
+0x00, 0x00, 0x0F, 0xCF, 0xFE, 0x00, 0x00, 0x1F, 0xC7, 
+0xFF, 0x80, 0x00, 0x1F, 0xC1, 0xFF, 0x00, 0x00, 0x1F, 
+0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x7C, 0x00, 0x00, 
+0x3F, 0x80, 0x3C, 0x00, 0x00, 0x3F, 0x80, 0x08, 0x00, 
+0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 
+0x00, 0x00, 0xFF, 0xF0, 0x00, 0xF0, 0xFF, 0xF0, 0x00, 
+0xF0, 0xFF, 0xF0, 0x00, 0xF0, 0xFF, 0xF0, 0x01, 0xF0, 
+0xFF, 0xF0, 0x03, 0xF0, 0xFF, 0xF0, 0x7F, 0xE0, 0xFF, 
+0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF8, 
+0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xF0, 
+0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 
+0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 
+0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xF8, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 
+0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 
+0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 
+0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFE, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x07, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x0F, 0xFF, 0xE7, 0xFE, 0x1F, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0x07, 0xFE, 0x1F, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x3F, 0xFC, 0x07, 0xFE, 0x3F, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x07, 0xFE, 0x3F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x07, 0xFE, 
+0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x07, 
+0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 
+0x07, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0x80, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0x00, 0x07, 0xFE, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFE, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x07, 
+0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 
+0x07, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x07, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xE0, 0x00, 0x07, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xE0, 0x00, 0x07, 0xFE, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0x80, 0x00, 
+0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0x80, 
+0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0xFF, 
+0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 
+0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 
+0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 
+0x07, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 
+0x00, 0x07, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x07, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 
+0xFC, 0x00, 0x00, 0x07, 0xFE, 0x3F, 0xF8, 0x00, 0x00, 
+0x7F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x3F, 0xFE, 0x00, 
+0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x1F, 0xFF, 
+0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x1F, 
+0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFE, 
+0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 
+0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x07, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xFF, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x0F, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 
+0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 
+0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 
+0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 
+0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 
+0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 
+0x7F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 
+0x00, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x3F, 
+0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x00, 
+0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 
+0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 
+0x00, 0x7F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x80, 
+0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 
+0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x7F, 
+0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 
+0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 
+0x03, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xF8, 
+0x00, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x07, 
+0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xFF, 
+0x80, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x80, 0x00, 0x3F, 
+0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xC0, 
+0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF1, 
+0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 
+0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 
+0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xDF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x9F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x1F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x1F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 
+0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xE0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x1F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 
+0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 
+0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 
+0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 
+0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 
+0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 
+0xF0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x20, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 
+0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 
+0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 
+0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0xFF, 
+0xFF, 0xFF, 0xF9, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFE, 
+0x00, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x07, 
+0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x80, 
+0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 
+0xFF, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0x80, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 
+0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 
+0x80, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0x80, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x80, 0x00, 0x1F, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 
+0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0x80, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x80, 0x00, 
+0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 
+0x80, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x1F, 
+0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0x80, 
+0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 
+0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
+0x00, 0x07, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFF, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0x80, 0x00, 
+0x07, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 
+0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFC, 
+0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 
+0xFF, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 
+0x00, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFC, 0x7F, 0xFF, 
+0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 
+0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 
+0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 
+0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFE, 
+0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 
+0x0F, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 
+0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 
+0x7F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 
+0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 
+0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0x80, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0x80, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x00, 0x03, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 
+0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 
+0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0x80, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0x80, 0xFF, 0x80, 0x00, 0x03, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 
+0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 
+0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x01, 
+0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 
+0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 
+0x7F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 
+0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 
+0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 
+0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xFF, 0xE0, 
+0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 
+0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 
+0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 
+0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 
+0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF0, 
+0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x10, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFE, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xFE, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xFE, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xFE, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x1F, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x83, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x87, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 
+0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE1, 
+0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xF3, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 
+0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 
+0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 
+0x1F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0xFC, 
+0x00, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x07, 
+0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x7F, 0xF0, 
+0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 
+0x7F, 0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x01, 
+0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 
+0x00, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 
+0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 
+0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x80, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 
+0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 
+0x80, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 
+0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 
+0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x01, 
+0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 
+0x00, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 
+0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 
+0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x3F, 
+0xFE, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 
+0x00, 0x1F, 0xFF, 0xE3, 0xFF, 0xFB, 0xFF, 0x00, 0x00, 
+0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 
+0x80, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 
+0xE1, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 
+0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 
+0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 
+0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x1F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 
+0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0xFF, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 
+0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x00, 0x07, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 
+0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 
+0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x00, 
+0x07, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 
+0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 
+0x00, 0x1F, 0xFF, 0x80, 0x01, 0xFF, 0xFC, 0x00, 0x1F, 
+0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFE, 
+0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 
+0x1F, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 
+0xC0, 0x00, 0x07, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 
+0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 
+0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 
+0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 
+0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xF0, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 
+0x7F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 
+0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 
+0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 
+0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 
+0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 
+0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 
+0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 
+0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 
+0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x1F, 
+0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFF, 0xF0, 
+0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0x00, 0xFF, 
+0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xE0, 0x01, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xE0, 0x01, 0xE0, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xE0, 0x01, 0xE0, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x03, 0xE0, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x07, 0xE0, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x3F, 
+0xC0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xFF, 0x80, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xDF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x87, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x03, 
+0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x00, 
+0x00, 0x00, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 
+0x03, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x7F, 
+0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 
+0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 
+0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 
+0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xE0, 
+0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 
+0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 
+0x00, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 
+0x03, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFE, 
+0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x03, 
+0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 
+0x00, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 
+0xFF, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 
+0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 
+0xE0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x3F, 
+0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x00, 
+0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x00, 0x0F, 0xF0, 
+0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 
+0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 
+0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 
+0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 
+0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 
+0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 
+0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 
+0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 
+0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 
+0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 
+0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 
+0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 
+0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 
+0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 
+0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 
+0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 
+0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 
+0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 
+0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 
+0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 
+0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 
+0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 
+0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 
+0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x3F, 
+0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 
+0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 
+0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 
+0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 
+0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x7F, 
+0x80, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x07, 
+0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 
+0x00, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 
+0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 
+0x01, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 
+0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x07, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 
+0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 
+0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 
+0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 
+0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 
+0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 
+0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0x00, 
+0x07, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xFC, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xFF, 
+0x00, 0x00, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x00, 
+0x00, 0x01, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x83, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x87, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0x87, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xCF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xCF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xE0, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x01, 0xFF, 0xE0, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x01, 
+0xFF, 0xE0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xF8, 0x01, 0xFF, 0xE0, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xE0, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xE0, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x01, 0xFF, 
+0xE0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 
+0x01, 0xFF, 0xE0, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xF8, 0x01, 0xFF, 0xE0, 0xFF, 0x80, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xE0, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 
+0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0xC0, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 
+0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 
+0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 
+0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 
+0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 
+0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 
+0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xF8, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0x00, 
+0x07, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x00, 0x03, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 
+0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x0F, 0xF8, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 
+0xFF, 0x80, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
+0x07, 0xFF, 0xE0, 0x00, 0xFF, 0x80, 0x1F, 0xF0, 0x00, 
+0x01, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 
+0x80, 0x1F, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 
+0x7F, 0xE0, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x00, 0x07, 
+0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xC0, 
+0x3F, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 
+0xF0, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xFC, 
+0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x7F, 
+0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 
+0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 
+0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xE0, 0x7F, 0x80, 
+0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 
+0x3F, 0xE0, 0x7F, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x00, 
+0x00, 0x07, 0xF0, 0x00, 0x3F, 0xE0, 0x7F, 0x80, 0x00, 
+0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 
+0xE0, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 
+0x07, 0xF0, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x7F, 
+0x80, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0xE0, 
+0xFF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xE0, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x7F, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xE0, 0xFF, 
+0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 
+0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 
+0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 
+0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0x80, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 
+0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 
+0xE0, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 
+0xFE, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x7F, 
+0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 
+0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xF8, 
+0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x7F, 0x80, 
+0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 
+0x80, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 
+0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 
+0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 
+0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 
+0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 
+0xC0, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x00, 0x7F, 0x80, 0x7F, 0xE0, 0x00, 0x01, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 
+0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFC, 0x7F, 0xF0, 0x00, 0xFF, 0x80, 0x3F, 
+0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xF0, 
+0x00, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0x00, 0x1F, 0xF8, 
+0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xF8, 0x01, 
+0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 
+0x00, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 
+0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0xFE, 
+0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 
+0x07, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 
+0xFF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x04, 0x00, 
+0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 
+0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x1F, 0xC0, 
+0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0x80, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x10, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x03, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x7F, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0xFE, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 
+0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 
+0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0x80, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 
+0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 
+0xFE, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 
+0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 
+0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 
+0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 
+0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 
+0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 
+0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 
+0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xFC, 
+0x00, 0x00, 0x01, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0x01, 
+0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xFF, 
+0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 
+0x1F, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 
+0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xC0, 
+0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 
+0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 
+0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 
+0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 
+0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 
+0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 
+0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x07, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 
+0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x03, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 
+0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xE0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 
+0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xE0, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 
+0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 
+0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 
+0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 
+0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 
+0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 
+0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x1F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 
+0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 
+0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 
+0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 
+0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 
+0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 
+0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 
+0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 
+0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x03, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x1F, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 
+0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xE0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xE0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 
+0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x1F, 0xE0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xF8, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 
+0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 
+0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFF, 
+0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 
+0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 
+0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x01, 
+0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 
+0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x0F, 
+0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xFF, 
+0x81, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 
+0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
+0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 
+0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x07, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xBF, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x1F, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 
+0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFC, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 
+0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 
+0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 
+0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x1F, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 
+0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xC0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xC0, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 
+0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x03, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 
+0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 
+0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x3F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x3F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x7F, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xE0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 
+0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0x80, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x01, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 
+0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 
+0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 
+0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 
+0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 
+0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 
+0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 
+0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 
+0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 
+0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
+0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F, 0xF8, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xF0, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xF0, 0x1F, 0xF8, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xF8, 
+0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFC, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x3F, 0xF0, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xBF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 
+0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 
+0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 
+0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 
+0x00, 0x7F, 0xFF, 0xFF, 0xDF, 0xFC, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 
+0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xE0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7E, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 
+0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 
+0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 
+0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xBF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 
+0x9F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 
+0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 
+0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 
+0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 
+0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 
+0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 
+0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 
+0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 
+0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 
+0x7F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 
+0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 
+0xC0, 0x1F, 0xFE, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0xFF, 0xE0, 0x3F, 0xF8, 0x00, 0x01, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 
+0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 
+0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xC0, 0x00, 
+0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 
+0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 
+0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 
+0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 
+0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 
+0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF8, 
+0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x0F, 
+0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 
+0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 
+0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 
+0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
+0x00, 0x0F, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 
+0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 
+0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 
+0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 
+0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 
+0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x03, 
+0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x00, 
+0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x7F, 
+0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 
+0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 
+0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 
+0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 
+0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 
+0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 
+0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 
+0x00, 0x00, 0x7F, 0xE0, 0x1F, 0xFE, 0x00, 0x00, 0x00, 
+0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x0F, 0xFF, 0x00, 
+0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 
+0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x01, 0xFF, 
+0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 
+0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 
+0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x80, 
+0x00, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x01, 0xFF, 
+0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
+0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 
+0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 
+0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 
+0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 
+0x03, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 
+0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 
+0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x01, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xF0, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x3F, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x7F, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFC, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x07, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 
+0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 
+0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x7F, 
+0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFC, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xF8, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x7F, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0xC0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 
+0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x7F, 0xC0, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x7F, 
+0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 
+0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0x80, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 
+0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 
+0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 
+0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 
+0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 
+0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 
+0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x1F, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 
+0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x03, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x07, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 
+0xC0, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC1, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0xFF, 0xC7, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0xCF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xDF, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xC0, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0x80, 
+0x00, 0x00, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF0, 
+0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFE, 
+0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0xC0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 
+0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x07, 
+0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 
+0x3F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x07, 0x80, 0x00, 
+0x01, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 
+0x00, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 
+0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x01, 
+0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 
+0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 
+0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x03, 
+0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 
+0xC0, 0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0x00, 
+0x3F, 0xF8, 0x3F, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x1F, 
+0xFC, 0x3F, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xFC, 
+0x7F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x7F, 
+0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x7F, 0xE0, 
+0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 
+0x0F, 0xF0, 0x00, 0x03, 0xFC, 0xFF, 0xC0, 0x00, 0x0F, 
+0xE0, 0x00, 0x03, 0xFE, 0xFF, 0x80, 0x00, 0x1F, 0xE0, 
+0x00, 0x03, 0xFE, 0xFF, 0x80, 0x00, 0x1F, 0xE0, 0x00, 
+0x03, 0xFE, 0xFF, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x03, 
+0xFC, 0xFF, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 
+0xFF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0xFF, 
+0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0xFF, 0x00, 
+0x00, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 
+0x3F, 0xC0, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0x3F, 
+0xC0, 0x00, 0x03, 0xF8, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 
+0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 
+0x07, 0xF8, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x07, 
+0xF0, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 
+0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xE0, 0xFF, 
+0x80, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0xFF, 0xC0, 
+0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x00, 
+0x7F, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xE0, 0x00, 0xFF, 
+0x00, 0x00, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0x00, 
+0x01, 0xFF, 0x00, 0x7F, 0xFC, 0x03, 0xFE, 0x00, 0x07, 
+0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
+0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 
+0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 
+0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 
+0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 
+0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 
+0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 
+0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 
+0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 
+0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 
+0x00, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFC, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x00, 
+0x00, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 
+0x3F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 
+0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 
+0x80, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
+0x01, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 
+0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 
+0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 
+0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 
+0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 
+0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x03, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 
+0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 
+0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 
+0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 
+0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0x80, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
+0x07, 0xFF, 0xFF, 0x3F, 0xC3, 0xFF, 0xFF, 0x80, 0x07, 
+0xFF, 0xF0, 0x3F, 0xC0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 
+0x80, 0x3F, 0xC0, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x00, 
+0x3F, 0xC0, 0x01, 0xFF, 0xE0, 0x1F, 0xFC, 0x00, 0x3F, 
+0xC0, 0x00, 0xFF, 0xF0, 0x3F, 0xF8, 0x00, 0x3F, 0xC0, 
+0x00, 0x7F, 0xF0, 0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 
+0x3F, 0xF8, 0x7F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 
+0xF8, 0x7F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF8, 
+0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFC, 0xFF, 
+0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0xFF, 0x80, 
+0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 
+0x3F, 0xC0, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x3F, 
+0xC0, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 
+0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 
+0x03, 0xFE, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 
+0xFE, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 
+0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0xFF, 
+0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0xFF, 0x80, 
+0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00, 
+0x3F, 0xC0, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00, 0x3F, 
+0xC0, 0x00, 0x07, 0xFC, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 
+0x00, 0x07, 0xFC, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 
+0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 
+0xF8, 0x7F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF8, 
+0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF8, 0x3F, 
+0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xF0, 0x3F, 0xFC, 
+0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xF0, 0x1F, 0xFF, 0x00, 
+0x3F, 0xC0, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0x3F, 
+0xC0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x3F, 0xC0, 
+0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 
+0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 
+0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 
+0xFF, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 
+0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 
+0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x7F, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 
+0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 
+0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x80, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x07, 
+0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 
+0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x1F, 
+0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 
+0xC0, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 
+0x01, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xF0, 0x00, 0x7F, 0xE0, 0x3F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xE0, 0x7F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xE0, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 
+0x1F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFC, 0x00, 0x1F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 
+0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 
+0x00, 0x0F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFE, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xF0, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 
+0x07, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFC, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 
+0xF0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 
+0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 
+0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 
+0x3F, 0xE0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xE0, 0x00, 0x3F, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x0F, 0xFE, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x07, 
+0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 
+0xC0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 
+0x0F, 0xFF, 0x80, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 
+0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x70, 0x7F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xF0, 0x01, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xF0, 0x01, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xF0, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 
+0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
+0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xF0, 0x01, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF8, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xE7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xC1, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 
+0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 
+0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 
+0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xC0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
+0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 
+0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 
+0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 
+0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFC, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xF0, 0x1F, 0xFF, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 
+0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 
+0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 
+0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
+0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x00, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 
+0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 
+0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 
+0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 
+0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0x80, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 
+0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFE, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 
+0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 
+0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 
+0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 
+0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 
+0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 
+0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 
+0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 
+0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x01, 
+0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 
+0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 
+0xF8, 0x00, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 
+0x00, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 
+0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 
+0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 
+0xF0, 0x3F, 0xFC, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF8, 
+0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x7F, 
+0xE0, 0x03, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 
+0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x7F, 0xC0, 0x01, 
+0xFF, 0x80, 0x00, 0x0F, 0xFC, 0xFF, 0x80, 0x00, 0xFF, 
+0xC0, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 
+0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 
+0x07, 0xFC, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x03, 
+0xFC, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFC, 
+0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFC, 0xFF, 
+0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0xFF, 0x00, 
+0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 
+0x3F, 0xF0, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0x3F, 
+0xF0, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 
+0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 
+0x03, 0xFC, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x03, 
+0xFC, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFC, 
+0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0xFF, 
+0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x7F, 0xE0, 
+0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x7F, 0xF0, 0x00, 
+0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x7F, 0xFC, 0x00, 0x07, 
+0xFE, 0x00, 0x1F, 0xF8, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 
+0x00, 0x3F, 0xF8, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 
+0x7F, 0xF0, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xE3, 0xFF, 
+0xF0, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 
+0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 
+0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 
+0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 
+0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x1F, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 
+0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 
+0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 
+0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 
+0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x60, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xF8, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 
+0xFF, 0xE0, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
+0xE0, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 
+0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 
+0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 
+0xF0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xF8, 
+0x00, 0x07, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 
+0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 
+0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE1, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xFB, 0xFF, 0xF0, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x07, 0xFF, 0xF7, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xC1, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0x80, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x00, 
+0x3F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x1F, 
+0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 
+0xF8, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFE, 
+0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
+0x7F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0xFF, 
+0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0xFF, 0xF8, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xE0, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xE0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0xC0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 
+0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xE0, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xE0, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 
+0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 
+0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 
+0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 
+0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 
+0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 
+0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0xFF, 0xE0, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x0F, 0xFF, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xFF, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0xFF, 0x00, 
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0xFF, 0x00, 0x00, 
+0x00, 0x0F, 0xFF, 0xDF, 0xE0, 0xFF, 0x00, 0x00, 0x00, 
+0x1F, 0xFF, 0x9F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x3F, 
+0xFE, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 
+0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x1F, 
+0xE0, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x1F, 0xE0, 
+0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x1F, 0xE0, 0xFF, 
+0x00, 0x00, 0x0F, 0xFF, 0x80, 0x1F, 0xE0, 0xFF, 0x00, 
+0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 
+0x7F, 0xFE, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0xFF, 
+0xFC, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x01, 0xFF, 0xF8, 
+0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 
+0x1F, 0xE0, 0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1F, 
+0xE0, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xE0, 
+0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 
+0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 
+0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x03, 0xFF, 
+0xF0, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x07, 0xFF, 0xE0, 
+0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x0F, 0xFF, 0xC0, 0x00, 
+0x00, 0x1F, 0xE0, 0xFF, 0x1F, 0xFF, 0x00, 0x00, 0x00, 
+0x1F, 0xE0, 0xFF, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 
+0xE0, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 
+0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 
+0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x1F, 0xE0, 0xFF, 0xFE, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xE0, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+0x1F, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 
+0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x80, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x7F, 0x80, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 
+0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x3F, 0x00, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x0F, 
+0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 
+0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 
+0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 
+0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 
+0x80, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 
+0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 
+0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 
+0xFC, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x01, 
+0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 
+0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 
+0x1F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 
+0x1F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 
+0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xC0, 0x1F, 
+0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x1F, 
+0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xC0, 0x00, };
+
+
+inline constexpr uint16_t font112ColumnIndex[] {
+0, 1, 100, 216, 806, 1508, 2531, 3246, 3286, 3636, 3986, 4151, 4529, 4577, 4604, 4628, 
+4991, 5563, 5843, 6373, 6956, 7506, 8089, 8661, 9191, 9774, 10357, 10453, 10573, 10958, 11174, 11552, 
+12080, 13419, 14200, 14871, 15652, 16367, 17016, 17621, 18446, 19139, 19260, 19766, 20470, 21031, 21878, 22582, 
+23451, 24100, 25048, 25774, 26489, 27193, 27886, 28645, 29756, 30526, 31318, 32011, 32305, 32668, 32962, 33214, 
+33281, 33350, 33798, 34370, 34770, 35353, 35777, 36074, 36646, 37152, 37262, 37528, 38067, 38166, 38782, 39150, 
+39574, 40146, 40729, 40953, 41329, 41599, 41967, 42391, 43023, 43431, 43992, 44376, 44740, 44824, 45188, };
 
- ****** Font Definition to add to source file ******
 
-const BdfFont font112
+inline constexpr uint8_t font112Widths[] {
+28, 37, 37, 62, 62, 100, 75, 22, 37, 37, 44, 65, 31, 37, 28, 31, 
+62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 28, 28, 65, 65, 65, 62, 
+114, 75, 74, 79, 78, 71, 67, 86, 81, 31, 59, 75, 63, 95, 82, 88, 
+73, 88, 79, 75, 71, 81, 72, 105, 74, 76, 69, 31, 31, 31, 53, 62, 
+28, 61, 63, 57, 63, 60, 31, 62, 60, 25, 27, 58, 24, 91, 60, 60, 
+63, 63, 37, 55, 31, 60, 56, 81, 53, 54, 54, 37, 28, 37, 56, };
+
+
+/****** Font Definition ******/
+
+inline const BdfFont font112 
 {
 	///Start address for bitmaps
 	font112Bitmaps,
 	///Start address for glyphs
-	font112Glyphs,
+	font112Glyphs, 
 	///Lowest ASCII encoding
 	32,
 	///Highest ASCII encoding
 	126,
 	/// Vertical step
-	110
+	110,
+	/// Start address for column-major bitmaps
+	font112Columns,
+	/// Start address for column-major glyph offsets
+	font112ColumnIndex,
+	/// Max rise above the baseline
+	86,
+	/// Max drop below the baseline (zero or negative)
+	-24,
+	/// Start address for the advance widths
+	font112Widths
 };
 
-****************************/
+/****************************/
 
-const BdfGlyph font112Glyphs[] = {
-	{0, 1, 1, 28, 0, 0},		   // 0x20			space
-	{1, 9, 82, 37, 14, 0},		   // 0x21			exclam
-	{165, 29, 27, 37, 4, 52},	   // 0x22			quotedbl
-	{273, 59, 80, 62, 2, -2},	   // 0x23			numbersign
-	{913, 54, 100, 62, 4, -14},	   // 0x24			dollar
-	{1613, 93, 81, 100, 3, -2},	   // 0x25			percent
-	{2585, 65, 82, 75, 6, -3},	   // 0x26			ampersand
-	{3323, 10, 27, 22, 6, 52},	   // 0x27			quotesingle
-	{3377, 25, 106, 37, 8, -24},   // 0x28			parenleft
-	{3801, 25, 106, 37, 4, -24},   // 0x29			parenright
-	{4225, 33, 33, 44, 5, 49},	   // 0x2a			asterisk
-	{4390, 54, 54, 65, 6, -1},	   // 0x2b			plus
-	{4768, 12, 28, 31, 10, -16},   // 0x2c			comma
-	{4824, 27, 8, 37, 5, 27},	   // 0x2d			hyphen
-	{4856, 12, 12, 28, 9, 0},	   // 0x2e			period
-	{4880, 33, 84, 31, -1, -2},	   // 0x2f			slash
-	{5300, 52, 82, 62, 5, -3},	   // 0x30			zero
-	{5874, 28, 79, 62, 11, 0},	   // 0x31			one
-	{6190, 53, 79, 62, 4, 0},	   // 0x32			two
-	{6743, 53, 82, 62, 4, -3},	   // 0x33			three
-	{7317, 55, 79, 62, 3, 0},	   // 0x34			four
-	{7870, 53, 82, 62, 4, -3},	   // 0x35			five
-	{8444, 52, 82, 62, 5, -3},	   // 0x36			six
-	{9018, 53, 79, 62, 5, 0},	   // 0x37			seven
-	{9571, 53, 82, 62, 4, -3},	   // 0x38			eight
-	{10145, 53, 82, 62, 4, -3},	   // 0x39			nine
-	{10719, 12, 59, 28, 9, 0},	   // 0x3a			colon
-	{10837, 12, 75, 28, 9, -16},   // 0x3b			semicolon
-	{10987, 55, 54, 65, 5, -1},	   // 0x3c			less
-	{11365, 54, 28, 65, 6, 12},	   // 0x3d			equal
-	{11561, 54, 54, 65, 6, -1},	   // 0x3e			greater
-	{11939, 48, 83, 62, 9, 0},	   // 0x3f			question
-	{12437, 103, 99, 114, 4, -16}, // 0x40			at
-	{13724, 71, 82, 75, 2, 0},	   // 0x41			A
-	{14462, 61, 82, 74, 9, 0},	   // 0x42			B
-	{15118, 71, 86, 79, 4, -3},	   // 0x43			C
-	{15892, 65, 82, 78, 9, 0},	   // 0x44			D
-	{16630, 59, 82, 71, 9, 0},	   // 0x45			E
-	{17286, 55, 82, 67, 9, 0},	   // 0x46			F
-	{17860, 75, 86, 86, 4, -3},	   // 0x47			G
-	{18720, 63, 82, 81, 9, 0},	   // 0x48			H
-	{19376, 11, 82, 31, 11, 0},	   // 0x49			I
-	{19540, 46, 85, 59, 4, -3},	   // 0x4a			J
-	{20050, 64, 82, 75, 9, 0},	   // 0x4b			K
-	{20706, 51, 82, 63, 9, 0},	   // 0x4c			L
-	{21280, 77, 82, 95, 9, 0},	   // 0x4d			M
-	{22100, 64, 82, 82, 9, 0},	   // 0x4e			N
-	{22756, 79, 86, 88, 4, -3},	   // 0x4f			O
-	{23616, 59, 82, 73, 9, 0},	   // 0x50			P
-	{24272, 79, 89, 88, 4, -6},	   // 0x51			Q
-	{25162, 66, 82, 79, 9, 0},	   // 0x52			R
-	{25900, 65, 86, 75, 5, -3},	   // 0x53			S
-	{26674, 64, 82, 71, 3, 0},	   // 0x54			T
-	{27330, 63, 85, 81, 9, -3},	   // 0x55			U
-	{28010, 69, 82, 72, 2, 0},	   // 0x56			V
-	{28748, 101, 82, 105, 2, 0},   // 0x57			W
-	{29814, 70, 82, 74, 2, 0},	   // 0x58			X
-	{30552, 72, 82, 76, 2, 0},	   // 0x59			Y
-	{31290, 63, 82, 69, 3, 0},	   // 0x5a			Z
-	{31946, 21, 106, 31, 7, -24},  // 0x5b			bracketleft
-	{32264, 33, 84, 31, -1, -2},   // 0x5c			backslash
-	{32684, 21, 106, 31, 2, -24},  // 0x5d			bracketright
-	{33002, 42, 42, 53, 5, 37},	   // 0x5e			asciicircum
-	{33254, 67, 6, 62, -2, -20},   // 0x5f			underscore
-	{33308, 23, 17, 28, 3, 66},	   // 0x60			grave
-	{33359, 56, 63, 61, 3, -3},	   // 0x61			a
-	{33800, 52, 85, 63, 7, -3},	   // 0x62			b
-	{34395, 50, 63, 57, 3, -3},	   // 0x63			c
-	{34836, 53, 85, 63, 3, -3},	   // 0x64			d
-	{35431, 53, 63, 60, 3, -3},	   // 0x65			e
-	{35872, 27, 82, 31, 2, 0},	   // 0x66			f
-	{36200, 52, 84, 62, 3, -24},   // 0x67			g
-	{36788, 46, 82, 60, 7, 0},	   // 0x68			h
-	{37280, 10, 82, 25, 7, 0},	   // 0x69			i
-	{37444, 19, 106, 27, 0, -24},  // 0x6a			j
-	{37762, 49, 82, 58, 7, 0},	   // 0x6b			k
-	{38336, 9, 82, 24, 7, 0},	   // 0x6c			l
-	{38500, 77, 60, 91, 7, 0},	   // 0x6d			m
-	{39100, 46, 60, 60, 7, 0},	   // 0x6e			n
-	{39460, 53, 63, 60, 3, -3},	   // 0x6f			o
-	{39901, 52, 84, 63, 7, -24},   // 0x70			p
-	{40489, 53, 84, 63, 3, -24},   // 0x71			q
-	{41077, 28, 60, 37, 7, 0},	   // 0x72			r
-	{41317, 47, 63, 55, 4, -3},	   // 0x73			s
-	{41695, 27, 78, 31, 2, -3},	   // 0x74			t
-	{42007, 46, 62, 60, 7, -3},	   // 0x75			u
-	{42379, 53, 59, 56, 1, 0},	   // 0x76			v
-	{42792, 79, 59, 81, 1, 0},	   // 0x77			w
-	{43382, 51, 59, 53, 1, 0},	   // 0x78			x
-	{43795, 51, 83, 54, 1, -24},   // 0x79			y
-	{44376, 48, 59, 54, 3, 0},	   // 0x7a			z
-	{44730, 26, 106, 37, 5, -24},  // 0x7b			braceleft
-	{45154, 6, 106, 28, 11, -24},  // 0x7c			bar
-	{45260, 26, 106, 37, 6, -24},  // 0x7d			braceright
-	{45684, 48, 19, 56, 4, 30},	   // 0x7e			asciitilde
-};
 
-const uint8_t font112Bitmaps[] = {
-	0x00,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0x7F,
-	0x80,
-	0x7F,
-	0x80,
-	0x7F,
-	0x80,
-	0x7F,
-	0x00,
-	0x7F,
-	0x00,
-	0x7F,
-	0x00,
-	0x7F,
-	0x00,
-	0x7F,
-	0x00,
-	0x7F,
-	0x00,
-	0x7F,
-	0x00,
-	0x3F,
-	0x00,
-	0x3F,
-	0x00,
-	0x3F,
-	0x00,
-	0x3F,
-	0x00,
-	0x3E,
-	0x00,
-	0x3E,
-	0x00,
-	0x3E,
-	0x00,
-	0x3E,
-	0x00,
-	0x3E,
-	0x00,
-	0x3E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x1F,
-	0xF0,
-	0x7F,
-	0xC0,
-	0x1F,
-	0xF0,
-	0x7F,
-	0xC0,
-	0x1F,
-	0xF0,
-	0x3F,
-	0xC0,
-	0x0F,
-	0xF0,
-	0x3F,
-	0xC0,
-	0x0F,
-	0xF0,
-	0x3F,
-	0x80,
-	0x0F,
-	0xE0,
-	0x3F,
-	0x80,
-	0x0F,
-	0xE0,
-	0x3F,
-	0x80,
-	0x0F,
-	0xE0,
-	0x1F,
-	0x80,
-	0x07,
-	0xE0,
-	0x1F,
-	0x80,
-	0x07,
-	0xE0,
-	0x1F,
-	0x00,
-	0x07,
-	0xC0,
-	0x1F,
-	0x00,
-	0x07,
-	0xC0,
-	0x1F,
-	0x00,
-	0x07,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x07,
-	0xFF,
-	0xF1,
-	0xFC,
-	0x3F,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0x81,
-	0xFC,
-	0x0F,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFF,
-	0x01,
-	0xFC,
-	0x03,
-	0xFF,
-	0x80,
-	0x1F,
-	0xFC,
-	0x01,
-	0xFC,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF8,
-	0x01,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xF0,
-	0x01,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x01,
-	0xFC,
-	0x00,
-	0x7F,
-	0xC0,
-	0x3F,
-	0xE0,
-	0x01,
-	0xFC,
-	0x00,
-	0x7F,
-	0xE0,
-	0x3F,
-	0xE0,
-	0x01,
-	0xFC,
-	0x00,
-	0x3F,
-	0xE0,
-	0x3F,
-	0xE0,
-	0x01,
-	0xFC,
-	0x00,
-	0x3F,
-	0xE0,
-	0x7F,
-	0xC0,
-	0x01,
-	0xFC,
-	0x00,
-	0x3F,
-	0xE0,
-	0x7F,
-	0xC0,
-	0x01,
-	0xFC,
-	0x00,
-	0x1F,
-	0xE0,
-	0x7F,
-	0xC0,
-	0x01,
-	0xFC,
-	0x00,
-	0x1F,
-	0xF0,
-	0x7F,
-	0xC0,
-	0x01,
-	0xFC,
-	0x00,
-	0x1F,
-	0xF0,
-	0x7F,
-	0xC0,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC1,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF1,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x0F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x03,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x01,
-	0xFC,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x01,
-	0xFC,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x01,
-	0xFC,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x01,
-	0xFC,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x01,
-	0xFC,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x01,
-	0xFC,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x01,
-	0xFC,
-	0x00,
-	0x0F,
-	0xFC,
-	0xFF,
-	0xC0,
-	0x01,
-	0xFC,
-	0x00,
-	0x0F,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x01,
-	0xFC,
-	0x00,
-	0x0F,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x01,
-	0xFC,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x01,
-	0xFC,
-	0x00,
-	0x1F,
-	0xF8,
-	0x3F,
-	0xE0,
-	0x01,
-	0xFC,
-	0x00,
-	0x3F,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x01,
-	0xFC,
-	0x00,
-	0x7F,
-	0xF0,
-	0x3F,
-	0xF8,
-	0x01,
-	0xFC,
-	0x00,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xFC,
-	0x01,
-	0xFC,
-	0x01,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xFF,
-	0x01,
-	0xFC,
-	0x03,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFF,
-	0xC1,
-	0xFC,
-	0x0F,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0xF9,
-	0xFC,
-	0xFF,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x03,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x1F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x3F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x3F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x7F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x83,
-	0xFF,
-	0xE0,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x03,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x10,
-	0x00,
-	0x00,
-	0x1F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF8,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x3F,
-	0xFC,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xC0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x80,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF8,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xEF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x8F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFD,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xF0,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xF8,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x3F,
-	0xFC,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0xFF,
-	0x80,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x01,
-	0xFF,
-	0xE1,
-	0xFF,
-	0x80,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xF1,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFB,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFB,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x03,
-	0xFF,
-	0xF9,
-	0xFF,
-	0xE0,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF8,
-	0x1F,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x7F,
-	0xF8,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xFC,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xC0,
-	0x7F,
-	0xC0,
-	0x7F,
-	0x80,
-	0x7F,
-	0x80,
-	0x7F,
-	0x80,
-	0x3F,
-	0x80,
-	0x3F,
-	0x80,
-	0x3F,
-	0x00,
-	0x3F,
-	0x00,
-	0x3F,
-	0x00,
-	0x1F,
-	0x00,
-	0x1F,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xF8,
-	0x00,
-	0x00,
-	0x03,
-	0xF8,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x03,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x80,
-	0x00,
-	0x00,
-	0x1F,
-	0x80,
-	0x00,
-	0x00,
-	0x1F,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x03,
-	0xF8,
-	0x00,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xF8,
-	0x00,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x70,
-	0x07,
-	0xF0,
-	0x07,
-	0x00,
-	0x7E,
-	0x07,
-	0xF0,
-	0x3F,
-	0x00,
-	0x7F,
-	0xC7,
-	0xF1,
-	0xFF,
-	0x00,
-	0xFF,
-	0xF7,
-	0xE7,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x7F,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x7F,
-	0x80,
-	0x00,
-	0x01,
-	0xFE,
-	0x3F,
-	0xC0,
-	0x00,
-	0x03,
-	0xFC,
-	0x1F,
-	0xE0,
-	0x00,
-	0x07,
-	0xFC,
-	0x1F,
-	0xF0,
-	0x00,
-	0x07,
-	0xF8,
-	0x0F,
-	0xF0,
-	0x00,
-	0x0F,
-	0xF0,
-	0x07,
-	0xF8,
-	0x00,
-	0x07,
-	0xF0,
-	0x07,
-	0xF0,
-	0x00,
-	0x03,
-	0xE0,
-	0x03,
-	0xC0,
-	0x00,
-	0x00,
-	0xC0,
-	0x01,
-	0x80,
-	0x00,
-	0x00,
-	0x40,
-	0x01,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0x03,
-	0xF0,
-	0x03,
-	0xF0,
-	0x03,
-	0xE0,
-	0x03,
-	0xE0,
-	0x03,
-	0xE0,
-	0x07,
-	0xE0,
-	0x07,
-	0xE0,
-	0x07,
-	0xE0,
-	0x07,
-	0xE0,
-	0x07,
-	0xC0,
-	0x0F,
-	0xC0,
-	0x1F,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x00,
-	0xFE,
-	0x00,
-	0xF8,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0x0F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x01,
-	0xFF,
-	0xF8,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x01,
-	0xFF,
-	0xF8,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x07,
-	0xFF,
-	0xF0,
-	0x00,
-	0x3F,
-	0xFF,
-	0xF0,
-	0x03,
-	0xFF,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0x01,
-	0xFF,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0xF8,
-	0x00,
-	0x3F,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x03,
-	0xFF,
-	0xFC,
-	0x07,
-	0xFF,
-	0xFE,
-	0x00,
-	0x07,
-	0xFF,
-	0xE0,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0xFC,
-	0x03,
-	0xFF,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x68,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xBF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x1F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x0F,
-	0xF9,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0x9F,
-	0xFF,
-	0xFF,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xFF,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0xFC,
-	0x03,
-	0xFF,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0x70,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xC3,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x07,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xC1,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xC3,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xCF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xDF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0xFF,
-	0xDF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x87,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x7F,
-	0xFF,
-	0x00,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0xF0,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0xFE,
-	0x03,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x60,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0x07,
-	0xFF,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0xF0,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0xF8,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0xF8,
-	0x00,
-	0x7F,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFF,
-	0xE0,
-	0x00,
-	0x3F,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0xFE,
-	0x01,
-	0xFF,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x34,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x03,
-	0xFF,
-	0xFE,
-	0x07,
-	0xFF,
-	0xFC,
-	0x00,
-	0x03,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF8,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF8,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF8,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF8,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF8,
-	0x07,
-	0xFF,
-	0xE0,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF8,
-	0x07,
-	0xFF,
-	0xFC,
-	0x07,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xDF,
-	0xF8,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x9F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x1F,
-	0xF8,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x1F,
-	0xF8,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x1F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x02,
-	0xE0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x03,
-	0xFF,
-	0xFC,
-	0x0F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xF0,
-	0x03,
-	0xF0,
-	0x03,
-	0xF0,
-	0x03,
-	0xF0,
-	0x03,
-	0xF0,
-	0x03,
-	0xF0,
-	0x03,
-	0xF0,
-	0x03,
-	0xE0,
-	0x07,
-	0xE0,
-	0x07,
-	0xE0,
-	0x07,
-	0xE0,
-	0x0F,
-	0xC0,
-	0x1F,
-	0xC0,
-	0xFF,
-	0x80,
-	0xFF,
-	0x00,
-	0xFE,
-	0x00,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x06,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x02,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFF,
-	0xF8,
-	0x1F,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0xF8,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFE,
-	0x03,
-	0xFF,
-	0x00,
-	0xFF,
-	0xF0,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0x03,
-	0xFE,
-	0x00,
-	0x7F,
-	0xF0,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x83,
-	0xFE,
-	0x00,
-	0x3F,
-	0xF8,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC7,
-	0xFE,
-	0x00,
-	0x3F,
-	0xF8,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE7,
-	0xFC,
-	0x00,
-	0x1F,
-	0xF8,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x3F,
-	0xE7,
-	0xFC,
-	0x00,
-	0x1F,
-	0xF8,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x1F,
-	0xFC,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x07,
-	0xFF,
-	0xF8,
-	0x00,
-	0x0F,
-	0xFC,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x03,
-	0xFF,
-	0xF8,
-	0x00,
-	0x0F,
-	0xFC,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x01,
-	0xFF,
-	0xF8,
-	0x00,
-	0x0F,
-	0xFC,
-	0x3F,
-	0xF0,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x0F,
-	0xFC,
-	0x3F,
-	0xF0,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x0F,
-	0xFC,
-	0x3F,
-	0xE0,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x07,
-	0xFC,
-	0x3F,
-	0xE0,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x07,
-	0xFC,
-	0x7F,
-	0xE0,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x07,
-	0xFC,
-	0x7F,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x7F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x7F,
-	0xE0,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0xF8,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0xF8,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFF,
-	0xFC,
-	0x01,
-	0xFF,
-	0xF8,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x07,
-	0xFF,
-	0xF0,
-	0x7F,
-	0xEF,
-	0xFF,
-	0x0F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xCF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x8F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFE,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF8,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xEF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xEF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xCF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC7,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC7,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x87,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x83,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x83,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0x80,
-	0x7F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x03,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x7F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x07,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xE0,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xE0,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x3F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x1F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xBF,
-	0xE0,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x3F,
-	0xE0,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xFE,
-	0x3F,
-	0xE0,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x1F,
-	0xE0,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0E,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x3F,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xFF,
-	0xF0,
-	0x3F,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC1,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC3,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC7,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC7,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xCF,
-	0xFE,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xDF,
-	0xFC,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0xFE,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xDF,
-	0xF8,
-	0xFF,
-	0xDF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xDF,
-	0xF8,
-	0xFF,
-	0xDF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xDF,
-	0xF8,
-	0xFF,
-	0xDF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x9F,
-	0xF8,
-	0xFF,
-	0xCF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x9F,
-	0xF8,
-	0xFF,
-	0xCF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x9F,
-	0xF8,
-	0xFF,
-	0xCF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC7,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC7,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC3,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC3,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC3,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC1,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC1,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC1,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x03,
-	0xFE,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x03,
-	0xFE,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x03,
-	0xFE,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x01,
-	0xFF,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x01,
-	0xFF,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x01,
-	0xFF,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0x80,
-	0x0F,
-	0xF8,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0x80,
-	0x0F,
-	0xF8,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xF8,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x7F,
-	0xC0,
-	0x1F,
-	0xF0,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x7F,
-	0xC0,
-	0x1F,
-	0xF0,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x7F,
-	0xE0,
-	0x1F,
-	0xF0,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x3F,
-	0xE0,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x3F,
-	0xE0,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x3F,
-	0xE0,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xF0,
-	0x7F,
-	0xC0,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xF0,
-	0x7F,
-	0xC0,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x07,
-	0xFD,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x07,
-	0xFD,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x03,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x03,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x03,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x01,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x01,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x01,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xDF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xCF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xCF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC7,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC7,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC3,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC1,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC1,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x83,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC3,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC3,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE3,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF3,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF3,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFB,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0B,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x20,
-	0x00,
-	0x7F,
-	0xF0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x70,
-	0x00,
-	0x7F,
-	0xF0,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xF8,
-	0x00,
-	0xFF,
-	0xF0,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0xFF,
-	0xE0,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x01,
-	0xFF,
-	0xE0,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x83,
-	0xFF,
-	0xC0,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC7,
-	0xFF,
-	0xC0,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE7,
-	0xFF,
-	0x80,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF3,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC1,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0B,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xC0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x80,
-	0x01,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x01,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x80,
-	0x00,
-	0x03,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x07,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF8,
-	0x00,
-	0x03,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF0,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x1F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFF,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x87,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x8F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x8F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xCF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xDF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xDF,
-	0xF8,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xDF,
-	0xF8,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x9F,
-	0xF8,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x8F,
-	0xF8,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x8F,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x8F,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x03,
-	0xFF,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x03,
-	0xFF,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x03,
-	0xFE,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x03,
-	0xFE,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x07,
-	0xFE,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x07,
-	0xFE,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x07,
-	0xFC,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x07,
-	0xFC,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x0F,
-	0xFC,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x0F,
-	0xFC,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xF8,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xF8,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x1F,
-	0xF8,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFC,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFC,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFC,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x87,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x87,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x87,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x8F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x8F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x8F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x8F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x8F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xCF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x8F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xCF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xDF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xDF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xDF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xDF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xDF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x83,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x87,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xCF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xEF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xDF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xCF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x8F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC1,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC1,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE3,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF7,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF7,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7E,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0x80,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFB,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xF3,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF3,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF1,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xE1,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xE0,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xC0,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x3F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x0F,
-	0xE0,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x03,
-	0xF8,
-	0x00,
-	0x07,
-	0xF0,
-	0x00,
-	0x03,
-	0xFC,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x01,
-	0xFE,
-	0x00,
-	0x1F,
-	0xE0,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x1F,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x7F,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xC0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xF0,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x0F,
-	0xF0,
-	0x00,
-	0x07,
-	0xF8,
-	0x00,
-	0x03,
-	0xF8,
-	0x00,
-	0x01,
-	0xFC,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x03,
-	0xFF,
-	0xFE,
-	0x03,
-	0xFF,
-	0xFE,
-	0x00,
-	0x07,
-	0xFF,
-	0xE0,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFD,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE1,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x80,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0x80,
-	0x3F,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0x80,
-	0x3F,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFF,
-	0xF0,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xFF,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xFF,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xFF,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x7F,
-	0xFF,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x38,
-	0x00,
-	0x00,
-	0x00,
-	0xC0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x3F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0x83,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x87,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0x8F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0x9F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xBF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0xFF,
-	0xBF,
-	0xFF,
-	0x1F,
-	0xFF,
-	0xFC,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x01,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0xFF,
-	0x7F,
-	0xFC,
-	0x07,
-	0xFF,
-	0xFC,
-	0x00,
-	0xFF,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0xFF,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0x07,
-	0xFF,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0xF0,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xFE,
-	0x01,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x60,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xF8,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x0F,
-	0xF8,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x0F,
-	0xF8,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x0F,
-	0xF8,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x8F,
-	0xF8,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xCF,
-	0xF8,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xEF,
-	0xF8,
-	0x01,
-	0xFF,
-	0xFF,
-	0xCF,
-	0xFF,
-	0xEF,
-	0xF8,
-	0x03,
-	0xFF,
-	0xF8,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF8,
-	0x07,
-	0xFF,
-	0xE0,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF8,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF8,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0xF8,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF8,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF8,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF8,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF8,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF8,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x07,
-	0xFF,
-	0xF8,
-	0x07,
-	0xFF,
-	0xE0,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF8,
-	0x03,
-	0xFF,
-	0xF8,
-	0x00,
-	0x7F,
-	0xF7,
-	0xF8,
-	0x01,
-	0xFF,
-	0xFF,
-	0x03,
-	0xFF,
-	0xF7,
-	0xF8,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE7,
-	0xF8,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC7,
-	0xF8,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x87,
-	0xF8,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x07,
-	0xF8,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x07,
-	0xF8,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x07,
-	0xF8,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x03,
-	0xFF,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0xF8,
-	0x00,
-	0x7F,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0xF0,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xF4,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x07,
-	0xFF,
-	0xE0,
-	0x00,
-	0x0F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x1F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x3F,
-	0xF0,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x1F,
-	0xF0,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x1F,
-	0xF0,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x9F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x9F,
-	0xF0,
-	0x01,
-	0xFF,
-	0xFF,
-	0x07,
-	0xFF,
-	0xDF,
-	0xF0,
-	0x03,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xFF,
-	0xF0,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF0,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF0,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF0,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xF0,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF0,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF0,
-	0x03,
-	0xFF,
-	0xF0,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF0,
-	0x01,
-	0xFF,
-	0xFE,
-	0x03,
-	0xFF,
-	0xBF,
-	0xF0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x3F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x3F,
-	0xF0,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x3F,
-	0xF0,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x3F,
-	0xF0,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x3F,
-	0xF0,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0x80,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x03,
-	0xC0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x07,
-	0xFF,
-	0xE0,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0x9F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0x80,
-	0x3F,
-	0xFF,
-	0xFC,
-	0x00,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0x81,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0x87,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0xFF,
-	0x8F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0x9F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0xFF,
-	0x9F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xBF,
-	0xF0,
-	0x07,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0xF8,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0xFF,
-	0xE0,
-	0x01,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFF,
-	0x00,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x81,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x83,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x87,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x8F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x9F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xBF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x9F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFE,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFC,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF8,
-	0x00,
-	0xFF,
-	0x01,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0xFF,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0xFF,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x8F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xDF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0x7F,
-	0xE0,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x07,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x01,
-	0xFF,
-	0xF0,
-	0xFF,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x7F,
-	0xF8,
-	0xFF,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0x00,
-	0x3F,
-	0xFF,
-	0xF8,
-	0x00,
-	0xFF,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0xFF,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0xFF,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0xFF,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0xFF,
-	0x3F,
-	0xF0,
-	0x03,
-	0xFF,
-	0xF8,
-	0xFF,
-	0x7F,
-	0xC0,
-	0x00,
-	0xFF,
-	0xF8,
-	0xFF,
-	0x7F,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0x07,
-	0xFF,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0xF0,
-	0x00,
-	0x7F,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0xF0,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0xFE,
-	0x01,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x78,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x3F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0xFF,
-	0x7F,
-	0xFF,
-	0x1F,
-	0xFF,
-	0xFC,
-	0x00,
-	0xFF,
-	0x7F,
-	0xF0,
-	0x01,
-	0xFF,
-	0xFC,
-	0x00,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xFE,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x07,
-	0xFF,
-	0xFC,
-	0x00,
-	0xFF,
-	0xBF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0xFF,
-	0x9F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0xFF,
-	0x8F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0x87,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0x83,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0x81,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x7F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x78,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x07,
-	0xF8,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x07,
-	0xF8,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x07,
-	0xF8,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x07,
-	0xF8,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x87,
-	0xF8,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC7,
-	0xF8,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE7,
-	0xF8,
-	0x01,
-	0xFF,
-	0xFF,
-	0xCF,
-	0xFF,
-	0xF7,
-	0xF8,
-	0x03,
-	0xFF,
-	0xF8,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF8,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF8,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF8,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0xF8,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF8,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF8,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF8,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF8,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xF8,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x07,
-	0xFF,
-	0xF8,
-	0x07,
-	0xFF,
-	0xE0,
-	0x00,
-	0x1F,
-	0xFF,
-	0xF8,
-	0x03,
-	0xFF,
-	0xF8,
-	0x00,
-	0x7F,
-	0xFF,
-	0xF8,
-	0x03,
-	0xFF,
-	0xFF,
-	0x03,
-	0xFF,
-	0xEF,
-	0xF8,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xEF,
-	0xF8,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xCF,
-	0xF8,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x8F,
-	0xF8,
-	0x00,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x0F,
-	0xF8,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x0F,
-	0xF8,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x0F,
-	0xF8,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x80,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xE0,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x0F,
-	0xF0,
-	0xFF,
-	0x00,
-	0x3F,
-	0xF0,
-	0xFF,
-	0x00,
-	0xFF,
-	0xF0,
-	0xFF,
-	0x01,
-	0xFF,
-	0xF0,
-	0xFF,
-	0x03,
-	0xFF,
-	0xF0,
-	0xFF,
-	0x07,
-	0xFF,
-	0xF0,
-	0xFF,
-	0x0F,
-	0xFF,
-	0xF0,
-	0xFF,
-	0x1F,
-	0xFF,
-	0xF0,
-	0xFF,
-	0x1F,
-	0xFF,
-	0xF0,
-	0xFF,
-	0x3F,
-	0xFF,
-	0xF0,
-	0xFF,
-	0x7F,
-	0xF0,
-	0x00,
-	0xFF,
-	0x7F,
-	0xC0,
-	0x00,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFF,
-	0xF0,
-	0x1F,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x1F,
-	0xFF,
-	0xE0,
-	0x07,
-	0xFF,
-	0xF8,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x80,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x3F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x1F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x07,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x38,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xF0,
-	0x00,
-	0x01,
-	0xFF,
-	0xFC,
-	0xFF,
-	0xF8,
-	0x00,
-	0x03,
-	0xFF,
-	0xFC,
-	0x7F,
-	0xFC,
-	0x00,
-	0x07,
-	0xFF,
-	0xFC,
-	0x7F,
-	0xFF,
-	0x00,
-	0x1F,
-	0xFB,
-	0xFC,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xF3,
-	0xFC,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xE3,
-	0xFC,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xC3,
-	0xFC,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x83,
-	0xFC,
-	0x07,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x03,
-	0xFC,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFC,
-	0x03,
-	0xFC,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x70,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x8F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x8F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x9F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xDF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xDF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xFC,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x01,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x0F,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x0F,
-	0xFC,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x0F,
-	0xFC,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x7F,
-	0xE0,
-	0x07,
-	0xFC,
-	0x00,
-	0x03,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFE,
-	0x00,
-	0x03,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFE,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xC0,
-	0x07,
-	0xFE,
-	0x00,
-	0x07,
-	0xFC,
-	0xFF,
-	0xC0,
-	0x00,
-	0xFF,
-	0x80,
-	0x03,
-	0xFE,
-	0x00,
-	0x07,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x01,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0x00,
-	0x07,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x01,
-	0xFF,
-	0x80,
-	0x03,
-	0xFF,
-	0x00,
-	0x0F,
-	0xF8,
-	0x7F,
-	0xC0,
-	0x01,
-	0xFF,
-	0x80,
-	0x01,
-	0xFF,
-	0x00,
-	0x0F,
-	0xF8,
-	0x7F,
-	0xE0,
-	0x01,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x0F,
-	0xF0,
-	0x3F,
-	0xE0,
-	0x03,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x0F,
-	0xF0,
-	0x3F,
-	0xE0,
-	0x03,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF0,
-	0x3F,
-	0xE0,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF0,
-	0x3F,
-	0xF0,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xE0,
-	0x1F,
-	0xF0,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xE0,
-	0x1F,
-	0xF0,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x3F,
-	0xE0,
-	0x1F,
-	0xF0,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x3F,
-	0xE0,
-	0x0F,
-	0xF8,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x3F,
-	0xC0,
-	0x0F,
-	0xF8,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x3F,
-	0xC0,
-	0x0F,
-	0xF8,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x7F,
-	0xC0,
-	0x0F,
-	0xF8,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x7F,
-	0xC0,
-	0x07,
-	0xFC,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x7F,
-	0x80,
-	0x07,
-	0xFC,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x7F,
-	0x80,
-	0x07,
-	0xFC,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x07,
-	0xFC,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0xFF,
-	0x80,
-	0x03,
-	0xFE,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0xFF,
-	0x00,
-	0x03,
-	0xFE,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0xFF,
-	0x00,
-	0x03,
-	0xFE,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF9,
-	0xFF,
-	0x00,
-	0x03,
-	0xFE,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF9,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFD,
-	0xFF,
-	0x00,
-	0x01,
-	0xFF,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFD,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x07,
-	0xFD,
-	0xFE,
-	0x00,
-	0x01,
-	0xFF,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x9F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x9F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xBF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x07,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFC,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xBF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x1F,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x1F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x1F,
-	0xC0,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x7F,
-	0xF0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x0F,
-	0xFE,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0xFC,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFE,
-	0x00,
-	0x00,
-	0x03,
-	0xFE,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x01,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x1F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x0F,
-	0xFF,
-	0xC0,
-	0x00,
-	0x07,
-	0xFF,
-	0xC0,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFC,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0xC0,
-	0x00,
-	0x01,
-	0xFF,
-	0xC0,
-	0x00,
-	0x03,
-	0xFF,
-	0xC0,
-	0x00,
-	0x07,
-	0xFF,
-	0x00,
-	0x00,
-	0x0F,
-	0xFC,
-	0x00,
-	0x00,
-	0x0F,
-	0xF8,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x1F,
-	0xF0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xE0,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x3F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0x7F,
-	0xC0,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x01,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xFF,
-	0x80,
-	0x00,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0xFF,
-	0xFC,
-	0x00,
-	0x00,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0xFE,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0x80,
-	0x00,
-	0x00,
-	0x00,
-	0x07,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x3F,
-	0x1F,
-	0xFF,
-	0xFE,
-	0x00,
-	0x00,
-	0x3F,
-	0x3F,
-	0xFF,
-	0xFF,
-	0x00,
-	0x00,
-	0x3F,
-	0x3F,
-	0xFF,
-	0xFF,
-	0xC0,
-	0x00,
-	0x3F,
-	0x7F,
-	0xEF,
-	0xFF,
-	0xF0,
-	0x00,
-	0x3F,
-	0x7F,
-	0x81,
-	0xFF,
-	0xF8,
-	0x00,
-	0x7F,
-	0x7F,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x7F,
-	0xFE,
-	0x00,
-	0x1F,
-	0xFF,
-	0x80,
-	0xFE,
-	0xFE,
-	0x00,
-	0x0F,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFC,
-	0x00,
-	0x03,
-	0xFF,
-	0xFF,
-	0xFE,
-	0xFC,
-	0x00,
-	0x01,
-	0xFF,
-	0xFF,
-	0xFC,
-	0xFC,
-	0x00,
-	0x00,
-	0x7F,
-	0xFF,
-	0xFC,
-	0xFC,
-	0x00,
-	0x00,
-	0x3F,
-	0xFF,
-	0xF8,
-	0x00,
-	0x00,
-	0x00,
-	0x0F,
-	0xFF,
-	0xF0,
-	0x00,
-	0x00,
-	0x00,
-	0x03,
-	0xFF,
-	0xE0,
-	0x00,
-	0x00,
-	0x00,
-	0x00,
-	0x7F,
-	0x00,
-};
-
-const BdfFont font112{
-	/// Start address for bitmaps
-	font112Bitmaps,
-	/// Start address for glyphs
-	font112Glyphs,
-	/// Lowest ASCII encoding
-	32,
-	/// Highest ASCII encoding
-	126,
-	/// Vertical step
-	110};
\ No newline at end of file
@@ -1,8 +1,8 @@
 
 #pragma once
 
-#include <inttypes.h>
-#include "fontServer.h"
+#include <cinttypes>
+#include "bdfFont.h"
 
 /****** Font Summary ********
 Tag			Sans22
@@ -25,7 +25,7 @@ Max Drop -5
 V Step	22
 ****************************/
 
-constexpr BdfGlyph Sans22Glyphs[] {
+ inline constexpr BdfGlyph Sans22Glyphs[] {
 {0, 1, 1, 6, 0, 0},			// 0x20			space
 {1, 2, 16, 7, 3, 0},			// 0x21			exclam
 {17, 5, 6, 7, 1, 10},			// 0x22			quotedbl
@@ -124,7 +124,7 @@ constexpr BdfGlyph Sans22Glyphs[] {
 };
 
 
-constexpr uint8_t Sans22Bitmaps[] {
+inline constexpr uint8_t Sans22Bitmaps[] {
 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 
 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0xC0, 0xC0, 0xD8, 
 0xD8, 0xD8, 0xC8, 0xC8, 0x88, 0x0C, 0x60, 0x0C, 0x40, 
@@ -391,9 +391,234 @@ constexpr uint8_t Sans22Bitmaps[] {
 0x80, };
 
 
+inline constexpr uint8_t Sans22Columns[] {
+0x00, 0xFF, 0xF3, 0xFF, 0x03, 0xFC, 0xF8, 0x00, 0xE0, 
+0xFC, 0x00, 0x60, 0x08, 0x60, 0x08, 0x7E, 0x0F, 0xFE, 
+0xFF, 0xE0, 0xF8, 0x60, 0x08, 0x66, 0x08, 0xFE, 0x3F, 
+0xF0, 0xFC, 0x60, 0x88, 0x60, 0x08, 0x00, 0x1F, 0x0F, 
+0x00, 0x3F, 0x87, 0x80, 0x31, 0x81, 0x80, 0x60, 0xC0, 
+0x80, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x60, 0xC0, 
+0x80, 0x30, 0x61, 0x80, 0x3C, 0x73, 0x80, 0x0C, 0x3F, 
+0x00, 0x3E, 0x00, 0x63, 0x00, 0x61, 0x00, 0x41, 0x00, 
+0x61, 0x01, 0x37, 0x07, 0x1E, 0x1C, 0x00, 0x70, 0x00, 
+0xC0, 0x03, 0x00, 0x0E, 0x0C, 0x38, 0x3E, 0xE0, 0x63, 
+0x80, 0x61, 0x00, 0x41, 0x00, 0x63, 0x00, 0x3F, 0x00, 
+0x1C, 0x00, 0x3C, 0x00, 0x7E, 0x3C, 0xC3, 0x7E, 0x83, 
+0x43, 0x81, 0xC3, 0xC1, 0xC3, 0xE3, 0x6E, 0x73, 0x3C, 
+0x3E, 0x00, 0x1E, 0x00, 0x77, 0x00, 0x43, 0x00, 0x01, 
+0xF0, 0xFC, 0x07, 0xFE, 0x00, 0x1F, 0x0F, 0xC0, 0x70, 
+0x00, 0x70, 0xC0, 0x00, 0x18, 0x80, 0x00, 0x08, 0x60, 
+0x00, 0x70, 0x3E, 0x03, 0xC0, 0x0F, 0xFF, 0x00, 0x00, 
+0xF0, 0x00, 0x20, 0x24, 0x38, 0xF8, 0x2C, 0x24, 0x0C, 
+0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 
+0xFF, 0xC0, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 
+0x00, 0x0C, 0x00, 0xC8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 
+0xC0, 0xC0, 0xC0, 0x00, 0x03, 0x00, 0x1E, 0x00, 0xF0, 
+0x07, 0x80, 0x38, 0x00, 0xC0, 0x00, 0x0F, 0xF8, 0x3F, 
+0xFE, 0x70, 0x07, 0x60, 0x03, 0xC0, 0x01, 0xC0, 0x01, 
+0x60, 0x03, 0x70, 0x07, 0x3F, 0xFE, 0x0F, 0xF8, 0x18, 
+0x00, 0x18, 0x00, 0x18, 0x00, 0x38, 0x00, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x1C, 0x07, 0x3C, 0x1F, 0x70, 0x3B, 0x60, 
+0x33, 0xC0, 0x63, 0xC0, 0xC3, 0x40, 0xC3, 0x61, 0x83, 
+0x7F, 0x83, 0x3E, 0x03, 0x18, 0x1C, 0x78, 0x1F, 0x60, 
+0x03, 0x40, 0x01, 0xC1, 0x81, 0xC1, 0x81, 0x41, 0x83, 
+0x73, 0xC3, 0x3E, 0xFE, 0x1C, 0x7C, 0x00, 0x70, 0x00, 
+0xD0, 0x03, 0x90, 0x06, 0x10, 0x1C, 0x10, 0x38, 0x10, 
+0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 0x00, 0x10, 0x01, 
+0x8C, 0xFF, 0x8E, 0xFD, 0x03, 0xC3, 0x01, 0xC2, 0x01, 
+0xC2, 0x01, 0xC3, 0x03, 0xC3, 0x83, 0xC1, 0xFE, 0x00, 
+0xFC, 0x07, 0xF8, 0x3F, 0xFE, 0x71, 0x87, 0x61, 0x03, 
+0xC3, 0x01, 0xC3, 0x01, 0xC3, 0x01, 0x61, 0x83, 0x71, 
+0xFE, 0x10, 0xFC, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x03, 
+0xC0, 0x1F, 0xC0, 0x7C, 0xC1, 0xE0, 0xC7, 0x00, 0xCC, 
+0x00, 0xF8, 0x00, 0xE0, 0x00, 0x1C, 0x7C, 0x3E, 0xFE, 
+0x73, 0xC3, 0x41, 0x83, 0xC1, 0x81, 0xC1, 0x81, 0x41, 
+0x81, 0x63, 0xC3, 0x3E, 0xFE, 0x1C, 0x7C, 0x1F, 0x0C, 
+0x3F, 0xCE, 0x60, 0xC3, 0x40, 0x41, 0xC0, 0x61, 0xC0, 
+0x61, 0x60, 0xC3, 0x60, 0xC7, 0x3F, 0xFE, 0x1F, 0xF8, 
+0xE0, 0x30, 0xE0, 0x30, 0xC0, 0x64, 0xC0, 0x78, 0x0C, 
+0x00, 0x1C, 0x00, 0x1E, 0x00, 0x16, 0x00, 0x33, 0x00, 
+0x23, 0x00, 0x61, 0x00, 0x61, 0x80, 0x40, 0x80, 0xC0, 
+0xC0, 0x80, 0xC0, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
+0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x80, 0xC0, 0xC0, 0xC0, 
+0x41, 0x80, 0x61, 0x80, 0x61, 0x00, 0x33, 0x00, 0x32, 
+0x00, 0x16, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x0C, 0x00, 
+0x38, 0x00, 0x78, 0x00, 0xC0, 0x00, 0x80, 0x73, 0x80, 
+0xF3, 0xC1, 0xC0, 0xC3, 0x00, 0x7E, 0x00, 0x7C, 0x00, 
+0x03, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x1C, 0x07, 0x00, 
+0x38, 0x01, 0x80, 0x30, 0x00, 0xC0, 0x60, 0xF8, 0xC0, 
+0xC3, 0xFC, 0x60, 0xC7, 0x06, 0x60, 0xC6, 0x06, 0x60, 
+0x84, 0x04, 0x60, 0x84, 0x04, 0x60, 0x84, 0x18, 0x60, 
+0xC7, 0xFC, 0x60, 0xC7, 0xE6, 0x60, 0xE7, 0x06, 0x00, 
+0x60, 0x06, 0x00, 0x30, 0x0C, 0x00, 0x3C, 0x1C, 0x00, 
+0x0F, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0x00, 
+0x3F, 0x01, 0xF8, 0x0F, 0xE0, 0x3E, 0x60, 0xF0, 0x60, 
+0xE0, 0x60, 0xFC, 0x60, 0x3F, 0xE0, 0x07, 0xF0, 0x00, 
+0xFC, 0x00, 0x1F, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 
+0x83, 0xC1, 0x83, 0xE3, 0x83, 0x7E, 0xC6, 0x3C, 0xFE, 
+0x00, 0x38, 0x0F, 0xF0, 0x3F, 0xFC, 0x78, 0x1E, 0x60, 
+0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0xC0, 0x01, 
+0xC0, 0x01, 0xC0, 0x03, 0xE0, 0x07, 0x78, 0x1E, 0x38, 
+0x3C, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 
+0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 
+0x03, 0xE0, 0x07, 0x70, 0x0E, 0x3F, 0xFC, 0x1F, 0xF8, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 
+0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 
+0xC1, 0x83, 0xC1, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 
+0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 
+0xC1, 0x80, 0xC1, 0x80, 0xC0, 0x00, 0xC0, 0x00, 0x07, 
+0xF0, 0x1F, 0xFC, 0x78, 0x1E, 0x60, 0x07, 0xC0, 0x03, 
+0xC0, 0x03, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x81, 0xC0, 
+0x83, 0xC0, 0x83, 0x60, 0x86, 0x78, 0x9C, 0x18, 0xFF, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0x01, 
+0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
+0x01, 0x80, 0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x03, 
+0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x07, 0xFF, 
+0xFE, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 
+0x03, 0x80, 0x07, 0x00, 0x0F, 0x80, 0x1D, 0xE0, 0x38, 
+0x70, 0x70, 0x3C, 0xE0, 0x0E, 0xC0, 0x07, 0x80, 0x01, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0x00, 0x03, 0x00, 
+0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 
+0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 
+0x00, 0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0x3E, 0x00, 0xF0, 
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x70, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x07, 0x80, 0x01, 
+0xE0, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x0E, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x0F, 0xF0, 0x1F, 0xFC, 0x38, 0x1E, 0x60, 
+0x06, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0xC0, 0x01, 
+0xC0, 0x01, 0xC0, 0x03, 0xC0, 0x03, 0x60, 0x07, 0x70, 
+0x0E, 0x3F, 0xFC, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 
+0x80, 0xC1, 0x80, 0xE1, 0x80, 0x7F, 0x00, 0x3E, 0x00, 
+0x0F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x38, 0x1E, 0x00, 
+0x60, 0x06, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x00, 
+0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 
+0xC0, 0x0B, 0x00, 0xC0, 0x0F, 0x00, 0x60, 0x07, 0x00, 
+0x70, 0x0F, 0x00, 0x3F, 0xFD, 0x80, 0x0F, 0xF1, 0x80, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 
+0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 
+0xE3, 0xC0, 0x7E, 0x7F, 0x3C, 0x3F, 0x00, 0x01, 0x00, 
+0x18, 0x3E, 0x1E, 0x7F, 0x07, 0xC3, 0x03, 0xC3, 0x03, 
+0x81, 0x81, 0x81, 0x81, 0xC1, 0x81, 0xC1, 0x83, 0xE0, 
+0xC3, 0x78, 0xE7, 0x38, 0x7E, 0x00, 0x38, 0xC0, 0x00, 
+0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 
+0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xFC, 0xFF, 0xFE, 0x00, 
+0x07, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 
+0x00, 0x01, 0x00, 0x03, 0x00, 0x07, 0xFF, 0xFE, 0xFF, 
+0xFC, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 
+0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0x00, 0x3E, 0x01, 
+0xF8, 0x0F, 0xC0, 0x7E, 0x00, 0xF0, 0x00, 0x80, 0x00, 
+0x80, 0x00, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 
+0xFF, 0x00, 0x0F, 0x00, 0x3F, 0x03, 0xF8, 0x1F, 0x80, 
+0xFC, 0x00, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x01, 
+0xFC, 0x00, 0x1F, 0x00, 0x1F, 0x01, 0xFE, 0x3F, 0xE0, 
+0xFE, 0x00, 0xE0, 0x00, 0x80, 0x03, 0xE0, 0x07, 0xF0, 
+0x1E, 0x3C, 0x38, 0x0E, 0xF0, 0x07, 0xC0, 0x03, 0xC0, 
+0x0F, 0xE0, 0x1C, 0x78, 0x78, 0x1C, 0xE0, 0x0F, 0xC0, 
+0x03, 0x00, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x78, 0x00, 
+0x1E, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0x03, 
+0xFF, 0x0F, 0x00, 0x1E, 0x00, 0x78, 0x00, 0xE0, 0x00, 
+0xC0, 0x00, 0xC0, 0x07, 0xC0, 0x0F, 0xC0, 0x1F, 0xC0, 
+0x7B, 0xC0, 0xE3, 0xC1, 0xC3, 0xC7, 0x83, 0xCE, 0x03, 
+0xDC, 0x03, 0xF8, 0x03, 0xF0, 0x03, 0xC0, 0x03, 0xFF, 
+0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xC0, 0x00, 0x18, 0xC0, 
+0x00, 0x18, 0xC0, 0x00, 0x18, 0xC0, 0x00, 0x78, 0x00, 
+0x07, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 
+0x00, 0x18, 0xC0, 0x00, 0x18, 0xC0, 0x00, 0x18, 0xFF, 
+0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0x01, 0x80, 0x07, 0x80, 
+0x3C, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0F, 
+0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 
+0x60, 0x20, 0x31, 0xE0, 0x73, 0xF0, 0xE2, 0x10, 0xC2, 
+0x10, 0xC6, 0x10, 0xC6, 0x10, 0xC6, 0x20, 0x7F, 0xE0, 
+0x7F, 0xF0, 0x00, 0x10, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 
+0xFF, 0x03, 0x06, 0x06, 0x03, 0x0C, 0x01, 0x0C, 0x01, 
+0x0C, 0x01, 0x0E, 0x03, 0x07, 0x8F, 0x03, 0xFC, 0x00, 
+0xF0, 0x1F, 0xC0, 0x7F, 0xE0, 0x60, 0x30, 0xC0, 0x10, 
+0xC0, 0x10, 0xC0, 0x10, 0xC0, 0x30, 0x70, 0x70, 0x30, 
+0xE0, 0x01, 0xFC, 0x07, 0xFE, 0x06, 0x03, 0x0C, 0x03, 
+0x0C, 0x01, 0x0C, 0x01, 0x04, 0x03, 0x06, 0x06, 0xFF, 
+0xFF, 0xFF, 0xFF, 0x1F, 0xC0, 0x7F, 0xE0, 0x66, 0x30, 
+0xC6, 0x10, 0xC6, 0x10, 0xC6, 0x10, 0xC6, 0x30, 0x66, 
+0x30, 0x7E, 0xE0, 0x1E, 0xC0, 0x0C, 0x00, 0x0C, 0x00, 
+0x7F, 0xFF, 0xFF, 0xFF, 0xCC, 0x00, 0xCC, 0x00, 0x1F, 
+0xC6, 0x00, 0x7F, 0xE7, 0x00, 0x60, 0x31, 0x00, 0xC0, 
+0x11, 0x80, 0xC0, 0x11, 0x80, 0xC0, 0x11, 0x80, 0x40, 
+0x31, 0x80, 0x70, 0x63, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 
+0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x04, 
+0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0E, 0x00, 
+0x07, 0xFF, 0xCF, 0xFF, 0xCF, 0xFF, 0x00, 0x00, 0x18, 
+0x00, 0x00, 0x18, 0xCF, 0xFF, 0xF0, 0xCF, 0xFF, 0xF0, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x60, 0x00, 0xC0, 0x01, 
+0xE0, 0x03, 0x70, 0x06, 0x3C, 0x0C, 0x0E, 0x08, 0x07, 
+0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 
+0xF0, 0x60, 0x00, 0x40, 0x00, 0xC0, 0x00, 0xC0, 0x00, 
+0xC0, 0x00, 0x7F, 0xF0, 0x3F, 0xF0, 0x60, 0x00, 0xC0, 
+0x00, 0xC0, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x7F, 0xF0, 
+0x1F, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x30, 0x00, 0x40, 
+0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xE0, 0x00, 
+0x7F, 0xF0, 0x1F, 0xF0, 0x1F, 0xC0, 0x7F, 0xE0, 0x60, 
+0x30, 0xC0, 0x10, 0xC0, 0x10, 0xC0, 0x10, 0xC0, 0x30, 
+0x60, 0x70, 0x3F, 0xE0, 0x1F, 0xC0, 0xFF, 0xFF, 0x80, 
+0xFF, 0xFF, 0x80, 0x30, 0xE0, 0x00, 0x60, 0x30, 0x00, 
+0xC0, 0x10, 0x00, 0xC0, 0x10, 0x00, 0xC0, 0x10, 0x00, 
+0xE0, 0x30, 0x00, 0x78, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 
+0x07, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 
+0x60, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x10, 0x00, 
+0xC0, 0x10, 0x00, 0xC0, 0x30, 0x00, 0x60, 0x60, 0x00, 
+0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xF0, 0xFF, 
+0xF0, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x00, 0xC0, 0x00, 
+0x38, 0x60, 0x7C, 0x70, 0xC6, 0x30, 0xC6, 0x10, 0xC6, 
+0x10, 0xC2, 0x10, 0xE3, 0x30, 0x73, 0xF0, 0x11, 0xE0, 
+0x18, 0x00, 0x18, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0x18, 
+0x02, 0x18, 0x02, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x30, 
+0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x30, 0x00, 
+0xE0, 0xFF, 0xF0, 0xFF, 0xF0, 0x80, 0x00, 0xF0, 0x00, 
+0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x70, 0x01, 
+0xE0, 0x0F, 0x80, 0x7C, 0x00, 0xF0, 0x00, 0x80, 0x00, 
+0x80, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 
+0x70, 0x03, 0xF0, 0x3F, 0x00, 0xF0, 0x00, 0xF8, 0x00, 
+0x3F, 0x80, 0x03, 0xF0, 0x00, 0x70, 0x07, 0xE0, 0x7F, 
+0x00, 0xF0, 0x00, 0x80, 0x00, 0x80, 0x00, 0xC0, 0x30, 
+0xE0, 0x70, 0x39, 0xC0, 0x1F, 0x80, 0x0F, 0x00, 0x1F, 
+0xC0, 0x70, 0xE0, 0xE0, 0x70, 0x80, 0x10, 0x80, 0x00, 
+0x00, 0xF0, 0x01, 0x80, 0x7E, 0x01, 0x80, 0x07, 0xC3, 
+0x80, 0x00, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 
+0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xE0, 0x00, 
+0x00, 0xC0, 0x70, 0xC0, 0xF0, 0xC1, 0xF0, 0xC3, 0x30, 
+0xC6, 0x30, 0xDC, 0x30, 0xF8, 0x30, 0xF0, 0x30, 0xC0, 
+0x30, 0x00, 0x60, 0x00, 0x00, 0xF8, 0x00, 0x7F, 0xDF, 
+0xF0, 0xC0, 0x00, 0x18, 0x80, 0x00, 0x18, 0xFF, 0xFF, 
+0xF8, 0x80, 0x00, 0x18, 0xC0, 0x00, 0x18, 0xFF, 0x8F, 
+0xF0, 0x7F, 0xFF, 0xE0, 0x00, 0x60, 0x00, 0x70, 0xC0, 
+0xC0, 0x40, 0x60, 0x30, 0x10, 0x10, 0x70, };
+
+
+inline constexpr uint16_t Sans22ColumnIndex[] {
+0, 1, 5, 10, 34, 64, 100, 126, 128, 140, 155, 161, 183, 185, 190, 192, 
+204, 224, 236, 256, 276, 296, 316, 336, 356, 376, 396, 400, 404, 426, 437, 459, 
+477, 537, 563, 587, 615, 639, 661, 683, 713, 737, 741, 759, 783, 803, 833, 857, 
+887, 909, 954, 980, 1006, 1030, 1054, 1080, 1120, 1146, 1172, 1196, 1211, 1223, 1238, 1254, 
+1267, 1271, 1293, 1315, 1333, 1353, 1373, 1385, 1415, 1433, 1437, 1449, 1469, 1473, 1505, 1525, 
+1545, 1578, 1608, 1620, 1638, 1650, 1670, 1692, 1724, 1744, 1774, 1792, 1807, 1810, 1825, };
+
+
+inline constexpr uint8_t Sans22Widths[] {
+6, 7, 7, 12, 12, 20, 15, 4, 7, 7, 9, 13, 6, 7, 6, 6, 
+12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 6, 6, 13, 13, 13, 12, 
+22, 15, 15, 16, 15, 14, 13, 17, 16, 6, 12, 15, 12, 19, 16, 17, 
+14, 17, 16, 15, 14, 16, 14, 21, 14, 15, 14, 6, 6, 6, 10, 12, 
+6, 12, 12, 11, 12, 12, 6, 12, 12, 5, 5, 11, 5, 18, 12, 12, 
+12, 12, 7, 11, 6, 12, 11, 16, 10, 11, 11, 7, 6, 7, 11, };
+
+
 /****** Font Definition ******/
 
-const BdfFont Sans22 
+inline const BdfFont Sans22 
 {
 	///Start address for bitmaps
 	Sans22Bitmaps,
@@ -404,7 +629,19 @@ const BdfFont Sans22
 	///Highest ASCII encoding
 	126,
 	/// Vertical step
-	22
+	22,
+	/// Start address for column-major bitmaps
+	Sans22Columns,
+	/// Start address for column-major glyph offsets
+	Sans22ColumnIndex,
+	/// Max rise above the baseline
+	17,
+	/// Max drop below the baseline (zero or negative)
+	-5,
+	/// Start address for the advance widths
+	Sans22Widths
 };
 
 /****************************/
+
+
@@ -1,8 +1,8 @@
 
 #pragma once
 
-#include <inttypes.h>
-#include "fontServer.h"
+#include <cinttypes>
+#include "bdfFont.h"
 
 /****** Font Summary ********
 Tag			Sans24
@@ -25,7 +25,7 @@ Max Drop -5
 V Step	23
 ****************************/
 
-const BdfGlyph Sans24Glyphs[] {
+ inline constexpr BdfGlyph Sans24Glyphs[] {
 {0, 1, 1, 6, 0, 0},			// 0x20			space
 {1, 2, 18, 8, 3, 0},			// 0x21			exclam
 {19, 6, 6, 8, 1, 11},			// 0x22			quotedbl
@@ -124,7 +124,7 @@ const BdfGlyph Sans24Glyphs[] {
 };
 
 
-const uint8_t Sans24Bitmaps[] {
+inline constexpr uint8_t Sans24Bitmaps[] {
 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 
 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 
 0xC0, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x48, 0x06, 0x30, 
@@ -429,9 +429,318 @@ const uint8_t Sans24Bitmaps[] {
 0x40, 0x87, 0xC0, 0x01, 0x00, };
 
 
+inline constexpr uint8_t Sans24Columns[] {
+0x00, 0xFF, 0xFD, 0xC0, 0xFF, 0xFD, 0xC0, 0xF8, 0xFC, 
+0x00, 0x00, 0xFC, 0xF8, 0x00, 0x10, 0x00, 0x06, 0x10, 
+0x00, 0x06, 0x13, 0x80, 0x06, 0xFF, 0x80, 0x1F, 0xF8, 
+0x00, 0xFF, 0x10, 0x00, 0xC6, 0x10, 0x00, 0x06, 0x17, 
+0x80, 0x07, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0xFE, 0x10, 
+0x00, 0x86, 0x10, 0x00, 0x06, 0x00, 0x00, 0x0F, 0x07, 
+0x00, 0x3F, 0x87, 0x80, 0x71, 0xC0, 0xC0, 0x60, 0xC0, 
+0x40, 0x60, 0xC0, 0x40, 0xFF, 0xFF, 0xF8, 0x60, 0x60, 
+0x40, 0x60, 0x60, 0x40, 0x70, 0x70, 0xC0, 0x3C, 0x3F, 
+0xC0, 0x1C, 0x1F, 0x80, 0x3E, 0x00, 0x00, 0x77, 0x00, 
+0x00, 0x61, 0x80, 0x00, 0x41, 0x80, 0x00, 0x41, 0x80, 
+0x00, 0x63, 0x01, 0x80, 0x3F, 0x07, 0x00, 0x1C, 0x1C, 
+0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 
+0x00, 0x0E, 0x0C, 0x00, 0x38, 0x1F, 0x00, 0xE0, 0x31, 
+0x80, 0x80, 0x60, 0x80, 0x00, 0x60, 0x80, 0x00, 0x60, 
+0x80, 0x00, 0x31, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x0C, 
+0x00, 0x00, 0x1E, 0x00, 0x00, 0x3F, 0x00, 0x38, 0x63, 
+0x80, 0x7E, 0xC1, 0x80, 0xE7, 0x80, 0x80, 0xC3, 0x80, 
+0xC0, 0xC3, 0xE1, 0x80, 0xC7, 0x71, 0x80, 0x7E, 0x3B, 
+0x80, 0x3C, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x7B, 
+0x80, 0x00, 0x61, 0x80, 0x00, 0x00, 0x80, 0xF0, 0xFC, 
+0xE0, 0x01, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x3C, 0x00, 
+0x38, 0x60, 0x00, 0x0E, 0x80, 0x00, 0x02, 0xC0, 0x00, 
+0x02, 0x70, 0x00, 0x0E, 0x3C, 0x00, 0x78, 0x0F, 0xFF, 
+0xE0, 0x01, 0xFF, 0x00, 0x30, 0x12, 0x1E, 0xF8, 0x1E, 
+0x12, 0x30, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 
+0x00, 0x04, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x04, 0x00, 
+0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0xE0, 
+0xFC, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0, 
+0xE0, 0x00, 0x00, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x3C, 
+0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x00, 
+0x00, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFE, 
+0x00, 0x78, 0x0F, 0x80, 0xE0, 0x01, 0x80, 0xC0, 0x01, 
+0x80, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0x80, 0xE0, 0x01, 
+0x80, 0x78, 0x07, 0x80, 0x3F, 0xFF, 0x00, 0x0F, 0xFC, 
+0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 
+0x00, 0x18, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xFF, 0xFF, 
+0x80, 0x0C, 0x07, 0x80, 0x3C, 0x0F, 0x80, 0x70, 0x1D, 
+0x80, 0xE0, 0x39, 0x80, 0xC0, 0x31, 0x80, 0xC0, 0x61, 
+0x80, 0xC0, 0x61, 0x80, 0xC0, 0xC1, 0x80, 0x61, 0xC1, 
+0x80, 0x7F, 0x81, 0x80, 0x3F, 0x01, 0x80, 0x18, 0x0E, 
+0x00, 0x78, 0x0F, 0x00, 0x70, 0x03, 0x80, 0xC0, 0x01, 
+0x80, 0xC1, 0x80, 0x80, 0xC1, 0x80, 0xC0, 0xC1, 0x80, 
+0x80, 0xC1, 0xC1, 0x80, 0x7F, 0xC3, 0x80, 0x7E, 0x7F, 
+0x00, 0x1C, 0x3E, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF8, 
+0x00, 0x01, 0xD8, 0x00, 0x07, 0x18, 0x00, 0x0E, 0x18, 
+0x00, 0x18, 0x18, 0x00, 0x70, 0x18, 0x00, 0xFF, 0xFF, 
+0x80, 0xFF, 0xFF, 0x80, 0x00, 0x18, 0x00, 0x00, 0x18, 
+0x00, 0x00, 0x86, 0x00, 0x7F, 0x87, 0x00, 0xFF, 0x83, 
+0x80, 0xC3, 0x01, 0x80, 0xC3, 0x00, 0xC0, 0xC3, 0x00, 
+0xC0, 0xC3, 0x00, 0x80, 0xC3, 0x01, 0x80, 0xC3, 0x83, 
+0x80, 0xC1, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xF8, 
+0x00, 0x3F, 0xFF, 0x00, 0x78, 0xE7, 0x80, 0x61, 0x81, 
+0x80, 0xC1, 0x81, 0x80, 0xC1, 0x00, 0xC0, 0xC3, 0x00, 
+0x80, 0xC1, 0x81, 0x80, 0x61, 0xC3, 0x80, 0x70, 0xFF, 
+0x00, 0x10, 0x7E, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 
+0x00, 0xC0, 0x00, 0x80, 0xC0, 0x07, 0x80, 0xC0, 0x3F, 
+0x80, 0xC0, 0xF8, 0x00, 0xC3, 0xC0, 0x00, 0xC7, 0x00, 
+0x00, 0xDC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xE0, 0x00, 
+0x00, 0x08, 0x3E, 0x00, 0x3E, 0x7F, 0x00, 0x7F, 0xE3, 
+0x80, 0xE1, 0xC1, 0x80, 0xC1, 0x80, 0x80, 0xC1, 0x80, 
+0xC0, 0xC1, 0x80, 0x80, 0xC1, 0x81, 0x80, 0x77, 0xC3, 
+0x80, 0x7E, 0x7F, 0x00, 0x1C, 0x3E, 0x00, 0x1F, 0x04, 
+0x00, 0x3F, 0xC7, 0x00, 0x70, 0xC3, 0x80, 0xC0, 0x61, 
+0x80, 0xC0, 0x60, 0x80, 0xC0, 0x60, 0xC0, 0xC0, 0x61, 
+0x80, 0xE0, 0x61, 0x80, 0x71, 0xC7, 0x00, 0x3F, 0xFE, 
+0x00, 0x1F, 0xF8, 0x00, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 
+0x39, 0xE0, 0x3F, 0x0C, 0x00, 0x0E, 0x00, 0x0E, 0x00, 
+0x1B, 0x00, 0x1B, 0x00, 0x31, 0x80, 0x31, 0x80, 0x60, 
+0x80, 0x60, 0xC0, 0x40, 0xC0, 0xC0, 0x60, 0xC0, 0x60, 
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
+0x88, 0x88, 0x88, 0xC0, 0x60, 0xC0, 0x60, 0x40, 0xC0, 
+0x60, 0xC0, 0x60, 0x80, 0x31, 0x80, 0x31, 0x80, 0x1B, 
+0x00, 0x1B, 0x00, 0x0A, 0x00, 0x0E, 0x00, 0x0C, 0x00, 
+0x1C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x60, 0x00, 0x00, 
+0xC0, 0x00, 0x00, 0xC0, 0x39, 0xC0, 0xC0, 0x79, 0xC0, 
+0xC0, 0xC0, 0x00, 0x61, 0x80, 0x00, 0x7F, 0x00, 0x00, 
+0x3E, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0x80, 
+0x07, 0x01, 0xC0, 0x1C, 0x00, 0xE0, 0x18, 0x00, 0x70, 
+0x30, 0x1C, 0x30, 0x60, 0xFE, 0x18, 0x61, 0xFF, 0x18, 
+0x63, 0x83, 0x18, 0xC3, 0x01, 0x98, 0xC2, 0x01, 0x08, 
+0xC6, 0x03, 0x08, 0xC2, 0x06, 0x18, 0xC3, 0xBF, 0x18, 
+0x61, 0xFF, 0x18, 0x63, 0xE1, 0x98, 0x72, 0x01, 0x00, 
+0x38, 0x03, 0x00, 0x1C, 0x07, 0x00, 0x0F, 0x1E, 0x00, 
+0x07, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xC0, 
+0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 
+0x0F, 0xD8, 0x00, 0x7E, 0x18, 0x00, 0xF0, 0x18, 0x00, 
+0xF0, 0x18, 0x00, 0x7E, 0x18, 0x00, 0x1F, 0xD8, 0x00, 
+0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xC0, 
+0x00, 0x01, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0xC0, 0xC0, 
+0x60, 0xC0, 0xC0, 0x71, 0xE0, 0xC0, 0x7F, 0x73, 0x80, 
+0x1E, 0x3F, 0x80, 0x00, 0x1E, 0x00, 0x03, 0xF8, 0x00, 
+0x0F, 0xFE, 0x00, 0x3E, 0x0F, 0x80, 0x70, 0x03, 0x80, 
+0x60, 0x01, 0xC0, 0x60, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 
+0xC0, 0x00, 0x60, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 
+0x60, 0x00, 0xC0, 0x70, 0x01, 0xC0, 0x3C, 0x07, 0x80, 
+0x1C, 0x0F, 0x00, 0x04, 0x0C, 0x00, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 
+0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xE0, 0x00, 0xC0, 
+0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x01, 0x80, 
+0x38, 0x03, 0x80, 0x3F, 0x3F, 0x00, 0x0F, 0xFE, 0x00, 
+0x03, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 
+0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 
+0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 
+0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 
+0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 
+0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 
+0x3E, 0x0F, 0x00, 0x38, 0x03, 0x80, 0x70, 0x01, 0xC0, 
+0x60, 0x00, 0xC0, 0xE0, 0x00, 0xC0, 0xC0, 0x00, 0xE0, 
+0xC0, 0x00, 0x40, 0xC0, 0x60, 0xC0, 0x60, 0x60, 0xC0, 
+0x60, 0x60, 0xC0, 0x70, 0x61, 0x80, 0x3C, 0x67, 0x00, 
+0x1C, 0x7F, 0xC0, 0x04, 0x7F, 0xC0, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 
+0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 
+0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 
+0x00, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 
+0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xC0, 
+0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x40, 
+0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x80, 
+0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 
+0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 
+0x03, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x0E, 0x78, 0x00, 
+0x1C, 0x3C, 0x00, 0x38, 0x0F, 0x00, 0x70, 0x07, 0x80, 
+0xE0, 0x01, 0xC0, 0xC0, 0x00, 0xC0, 0x80, 0x00, 0x00, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xC0, 
+0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 
+0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 
+0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xC0, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 
+0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 
+0x00, 0x03, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x0F, 0xC0, 
+0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 
+0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x78, 0x00, 0x00, 
+0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 
+0x01, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 
+0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 
+0x0F, 0xFE, 0x00, 0x1E, 0x0F, 0x00, 0x38, 0x03, 0x80, 
+0x70, 0x01, 0xC0, 0x60, 0x00, 0xC0, 0xE0, 0x00, 0xC0, 
+0xC0, 0x00, 0xC0, 0xC0, 0x00, 0x60, 0xC0, 0x00, 0xE0, 
+0xE0, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x70, 0x01, 0xC0, 
+0x38, 0x03, 0x80, 0x1F, 0x1F, 0x00, 0x0F, 0xFE, 0x00, 
+0x01, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 
+0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00, 
+0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00, 0x60, 0x60, 0x00, 
+0x60, 0xC0, 0x00, 0x70, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 
+0x3F, 0x80, 0x00, 0x04, 0x00, 0x00, 0x03, 0xF8, 0x00, 
+0x0F, 0xFE, 0x00, 0x1E, 0x0F, 0x00, 0x38, 0x03, 0x80, 
+0x70, 0x01, 0xC0, 0x60, 0x00, 0xC0, 0xE0, 0x00, 0xC0, 
+0xC0, 0x00, 0xC0, 0xC0, 0x00, 0x60, 0xC0, 0x00, 0xC0, 
+0xE0, 0x06, 0xC0, 0x60, 0x03, 0xC0, 0x70, 0x01, 0xC0, 
+0x38, 0x03, 0xC0, 0x1F, 0x9F, 0xE0, 0x0F, 0xFE, 0x60, 
+0x03, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 
+0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 
+0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 
+0x60, 0xE0, 0x00, 0x60, 0xE0, 0x00, 0x71, 0xF0, 0x00, 
+0x7F, 0xBF, 0xC0, 0x3F, 0x1F, 0xC0, 0x00, 0x00, 0x40, 
+0x00, 0x0E, 0x00, 0x3F, 0x0F, 0x80, 0x7F, 0x83, 0x80, 
+0x61, 0x81, 0xC0, 0x61, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 
+0xC0, 0xC0, 0xE0, 0xC0, 0xC0, 0x40, 0xC0, 0xE0, 0xC0, 
+0x60, 0x60, 0xC0, 0x70, 0x60, 0xC0, 0x3C, 0x7B, 0xC0, 
+0x1C, 0x3F, 0x80, 0x00, 0x1E, 0x00, 0xC0, 0x00, 0x00, 
+0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 
+0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 
+0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 
+0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 
+0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xC0, 
+0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xE0, 
+0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 
+0x00, 0x00, 0xC0, 0x00, 0x01, 0xC0, 0xFF, 0xFF, 0x80, 
+0xFF, 0xFF, 0x00, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 
+0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xF0, 0x00, 
+0x00, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xC0, 
+0x00, 0x07, 0xC0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 
+0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0xF8, 0x00, 0x00, 
+0xC0, 0x00, 0x00, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 
+0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x80, 
+0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 
+0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 
+0x00, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xC0, 
+0x00, 0x3F, 0xC0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 
+0xFE, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0xC0, 
+0xE0, 0x01, 0xC0, 0x78, 0x07, 0x80, 0x3C, 0x0F, 0x00, 
+0x0F, 0x1C, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xE0, 0x00, 
+0x01, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x1E, 0x1E, 0x00, 
+0x3C, 0x0F, 0x00, 0xF0, 0x03, 0xC0, 0xE0, 0x01, 0xC0, 
+0x80, 0x00, 0x40, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 
+0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 
+0x0F, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 
+0x00, 0x7F, 0xC0, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 
+0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 
+0xE0, 0x00, 0x00, 0x80, 0x00, 0x00, 0xC0, 0x01, 0xC0, 
+0xC0, 0x03, 0xC0, 0xC0, 0x0F, 0xC0, 0xC0, 0x1E, 0xC0, 
+0xC0, 0x3C, 0xC0, 0xC0, 0x70, 0xC0, 0xC1, 0xE0, 0xC0, 
+0xC3, 0xC0, 0xC0, 0xC7, 0x00, 0xC0, 0xDE, 0x00, 0xC0, 
+0xFC, 0x00, 0xC0, 0xF0, 0x00, 0xC0, 0xE0, 0x00, 0xC0, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xC0, 0x00, 0x06, 
+0xC0, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 
+0x07, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 
+0x00, 0x03, 0xC0, 0x00, 0x00, 0x40, 0xC0, 0x00, 0x06, 
+0xC0, 0x00, 0x06, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 
+0x00, 0x80, 0x03, 0x80, 0x1E, 0x00, 0x78, 0x00, 0xC0, 
+0x00, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0x80, 0x01, 0x80, 
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0x60, 
+0x30, 0x11, 0xF0, 0x71, 0xF8, 0x63, 0x18, 0xC3, 0x08, 
+0xC3, 0x08, 0xC2, 0x08, 0xC2, 0x18, 0xE6, 0x30, 0x7F, 
+0xF8, 0x3F, 0xF8, 0x00, 0x0C, 0x00, 0x08, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xC0, 0x01, 0xE7, 0x80, 0x03, 0x01, 
+0xC0, 0x06, 0x00, 0xC0, 0x06, 0x00, 0x40, 0x06, 0x00, 
+0x40, 0x06, 0x00, 0xC0, 0x07, 0x01, 0xC0, 0x03, 0xE7, 
+0x80, 0x01, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x1F, 0xE0, 
+0x3F, 0xF0, 0x70, 0x38, 0xC0, 0x18, 0xC0, 0x08, 0xC0, 
+0x0C, 0xC0, 0x08, 0xE0, 0x18, 0x78, 0x78, 0x38, 0x70, 
+0x00, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x03, 0x81, 0xC0, 
+0x07, 0x00, 0xC0, 0x06, 0x00, 0xC0, 0x06, 0x00, 0x60, 
+0x06, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x83, 0x80, 
+0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x1F, 0xE0, 0x3F, 
+0xF0, 0x72, 0x38, 0xC2, 0x18, 0xC2, 0x0C, 0xC2, 0x0C, 
+0xC2, 0x08, 0xE2, 0x18, 0x72, 0x38, 0x3E, 0x70, 0x1E, 
+0x40, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x3F, 0xFF, 
+0xC0, 0x7F, 0xFF, 0xC0, 0x66, 0x00, 0x00, 0xC6, 0x00, 
+0x00, 0x1F, 0xE3, 0x00, 0x3F, 0xF3, 0x80, 0x70, 0x39, 
+0xC0, 0xC0, 0x18, 0xC0, 0xC0, 0x08, 0xC0, 0xC0, 0x0C, 
+0xC0, 0xC0, 0x18, 0xC0, 0x60, 0x18, 0xC0, 0x38, 0x73, 
+0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xC0, 0x01, 0xC0, 0x00, 0x03, 0x00, 
+0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 
+0x00, 0x06, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 
+0xC0, 0xE7, 0xFF, 0xC0, 0xE7, 0xFF, 0xC0, 0x00, 0x00, 
+0x06, 0x00, 0x00, 0x06, 0xE7, 0xFF, 0xFE, 0xE7, 0xFF, 
+0xFC, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x00, 0x18, 
+0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0xF8, 
+0x00, 0x01, 0x9E, 0x00, 0x03, 0x0F, 0x00, 0x06, 0x03, 
+0xC0, 0x04, 0x01, 0xC0, 0x00, 0x00, 0x40, 0xFF, 0xFF, 
+0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xF8, 0xFF, 0xF8, 0x38, 
+0x00, 0x60, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 
+0xE0, 0x00, 0x7F, 0xF8, 0x3F, 0xF8, 0x60, 0x00, 0xC0, 
+0x00, 0xC0, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x7F, 0xF8, 
+0x7F, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x38, 0x00, 0x60, 
+0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 
+0xFF, 0xF8, 0x7F, 0xF8, 0x1F, 0xE0, 0x3F, 0xF0, 0x70, 
+0x38, 0xE0, 0x18, 0xC0, 0x08, 0xC0, 0x0C, 0xC0, 0x18, 
+0xE0, 0x18, 0x70, 0x38, 0x3F, 0xF0, 0x1F, 0xC0, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x3C, 0xF0, 0x00, 0x60, 
+0x38, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x08, 0x00, 0xC0, 
+0x0C, 0x00, 0xC0, 0x18, 0x00, 0x60, 0x38, 0x00, 0x7C, 
+0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1F, 
+0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x70, 0x38, 0x00, 0xE0, 
+0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 
+0x18, 0x00, 0x60, 0x18, 0x00, 0x70, 0x70, 0x00, 0xFF, 
+0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xF8, 0xFF, 0xF8, 
+0x3C, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xC0, 0x00, 0x3C, 
+0x70, 0x7E, 0x78, 0xE6, 0x18, 0xC6, 0x18, 0xC3, 0x0C, 
+0xC3, 0x08, 0xC3, 0x18, 0x73, 0x98, 0x71, 0xF8, 0x00, 
+0xE0, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0xFF, 0xFF, 
+0x00, 0xFF, 0xFF, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 
+0x80, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x38, 0x00, 0x1C, 
+0x00, 0x0C, 0x00, 0x08, 0x00, 0x18, 0x00, 0x18, 0xFF, 
+0xE0, 0xFF, 0xF8, 0x80, 0x00, 0xF0, 0x00, 0xFE, 0x00, 
+0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x38, 0x00, 0x78, 0x03, 
+0xE0, 0x1F, 0x80, 0xFC, 0x00, 0xE0, 0x00, 0x80, 0x00, 
+0x80, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xF0, 0x00, 
+0xF8, 0x00, 0xF8, 0x0F, 0xF0, 0xFF, 0x00, 0xE0, 0x00, 
+0xFE, 0x00, 0x1F, 0xE0, 0x01, 0xF8, 0x00, 0x38, 0x03, 
+0xF8, 0x3F, 0x80, 0xFC, 0x00, 0xE0, 0x00, 0xC0, 0x18, 
+0xE0, 0x38, 0x38, 0xF0, 0x1D, 0xC0, 0x07, 0x80, 0x0F, 
+0x80, 0x3D, 0xE0, 0x70, 0x70, 0xE0, 0x38, 0x80, 0x08, 
+0x80, 0x00, 0x00, 0xF0, 0x00, 0xC0, 0x7E, 0x00, 0xC0, 
+0x0F, 0xC1, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0x00, 
+0x00, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x00, 
+0xF8, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x38, 0xC0, 
+0x78, 0xC0, 0xF8, 0xC1, 0xD8, 0xC7, 0x18, 0xCE, 0x18, 
+0xDC, 0x18, 0xF8, 0x18, 0xF0, 0x18, 0xC0, 0x18, 0x00, 
+0x18, 0x00, 0x00, 0x3C, 0x00, 0x7F, 0xEF, 0xFC, 0x7F, 
+0xC3, 0xFE, 0x40, 0x00, 0x06, 0xC0, 0x00, 0x02, 0xFF, 
+0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xC0, 0x00, 0x02, 0xC0, 
+0x00, 0x06, 0x7F, 0xC3, 0xFE, 0x7F, 0xEF, 0xFC, 0x00, 
+0x3C, 0x00, 0x00, 0x18, 0x00, 0xE0, 0xC0, 0x80, 0xC0, 
+0xC0, 0x60, 0x20, 0x30, 0x20, 0xE0, };
+
+
+inline constexpr uint16_t Sans24ColumnIndex[] {
+0, 1, 7, 13, 52, 85, 145, 187, 190, 205, 220, 227, 251, 254, 260, 262, 
+283, 316, 334, 367, 400, 433, 466, 499, 532, 565, 598, 602, 606, 630, 642, 666, 
+696, 762, 804, 843, 888, 930, 966, 1002, 1050, 1089, 1098, 1128, 1170, 1203, 1251, 1293, 
+1344, 1383, 1434, 1476, 1518, 1557, 1596, 1641, 1707, 1749, 1797, 1836, 1848, 1869, 1881, 1899, 
+1914, 1918, 1942, 1978, 1998, 2031, 2053, 2071, 2104, 2134, 2140, 2152, 2185, 2191, 2225, 2245, 
+2267, 2303, 2336, 2348, 2368, 2386, 2406, 2430, 2464, 2484, 2517, 2537, 2555, 2561, 2579, };
+
+
+inline constexpr uint8_t Sans24Widths[] {
+6, 8, 8, 13, 13, 21, 16, 5, 8, 8, 9, 14, 7, 8, 6, 7, 
+13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 6, 6, 14, 14, 14, 13, 
+24, 16, 16, 17, 17, 15, 14, 18, 17, 7, 13, 16, 14, 20, 18, 19, 
+16, 19, 17, 16, 15, 17, 15, 22, 16, 16, 15, 7, 7, 7, 11, 13, 
+6, 13, 13, 12, 13, 13, 7, 13, 13, 5, 6, 12, 5, 19, 13, 13, 
+13, 13, 8, 12, 7, 13, 12, 17, 11, 11, 12, 8, 6, 8, 12, };
+
+
 /****** Font Definition ******/
 
-const BdfFont Sans24 
+inline const BdfFont Sans24 
 {
 	///Start address for bitmaps
 	Sans24Bitmaps,
@@ -442,8 +751,19 @@ const BdfFont Sans24
 	///Highest ASCII encoding
 	126,
 	/// Vertical step
-	23
+	23,
+	/// Start address for column-major bitmaps
+	Sans24Columns,
+	/// Start address for column-major glyph offsets
+	Sans24ColumnIndex,
+	/// Max rise above the baseline
+	18,
+	/// Max drop below the baseline (zero or negative)
+	-5,
+	/// Start address for the advance widths
+	Sans24Widths
 };
 
 /****************************/
 
+
@@ -10,24 +10,74 @@ struct Asset
 	size_t Key;
 	///Byte index into the asset array for this asset
 	size_t Index;
-	///A code for the required font (not used yet)
+	///The font the lines were laid out in (a FontId, zero if there is no precomputed layout)
 	uint8_t FontId;
 	///A code for the required style (not used yet)
 	uint8_t Style;
+	///The length in bytes of the (decoded) asset text, zero if not known
+	uint16_t Length{0};
+	///Position in the Breaks span of the end of this asset's first line
+	uint32_t LineIndex{0};
+	///The number of lines the text wraps to in FontId
+	uint8_t LineCount{0};
+	///Offset in the decoded text of the phrase that names the time
+	uint16_t MarkerStart{0};
+	///The length of the time phrase in bytes, zero if it wasn't found in the text
+	uint8_t MarkerLength{0};
+	///Offset in AssetStack::Credits of the title of the book (zero for none)
+	uint16_t Title{0};
+	///Offset in AssetStack::Credits of the author (zero for none)
+	uint16_t Author{0};
+	///True if the text has bold markup, so its lines are stepped by the bold face too
+	bool Bold{false};
 };
 
+/// <summary>The number of keys in a day of minutes (key = hour * 60 + minute)</summary>
+constexpr uint16_t MINUTES_PER_DAY{24 * 60};
+
+/// <summary>The assets for one minute of the day. The assets in a stack are sorted by key so
+/// all of the assets for a minute are contiguous</summary>
+struct MinuteIndex
+{
+	///Position in the Assets span of the first asset for this minute
+	uint32_t First;
+	///The number of assets for this minute (zero if there are none)
+	uint16_t Count;
+};
+
+/// <summary>Asset text is 7-bit ASCII so a compressed stack uses the bytes from PAIR_BASE up
+/// as codes. Code PAIR_BASE + n stands for Pairs[2n] followed by Pairs[2n + 1], either of
+/// which may itself be a code</summary>
+constexpr uint8_t PAIR_BASE{0x80};
+/// <summary>The deepest a code may nest, which bounds the decoder's stack</summary>
+constexpr uint8_t MAX_PAIR_DEPTH{12};
+
 /// <summary>Declaration for the struct describing the overall stack of assets</summary>
 struct AssetStack
 {
 	///The const char array containing the asset text. Cant be a string_view because we have 
-	/// multiple EOT characters
+	/// multiple EOT characters. Each asset is EOT terminated whether or not it is compressed
 	std::span<const char> Text;
 	///The Asset struct in the array containing the asset details
 	std::span<const Asset> Assets;
 	///The total number of assets in this stack
-	const uint16_t Quantity;
+	const uint32_t Quantity;
 	///The maximum index in the text table (i.e. the compiled length in bytes of the asset text)
 	const uint32_t MaxIndex;
+	///MINUTES_PER_DAY entries mapping each key to its assets. Empty if the generator didn't
+	/// emit one, in which case QuoteServer builds its own
+	std::span<const MinuteIndex> Minutes{};
+	///The byte-pair dictionary (two bytes per code). Empty if the text isn't compressed, in
+	/// which case each asset is plain, EOT terminated text
+	std::span<const uint8_t> Pairs{};
+	///The end (exclusive) of each line of each asset, as an offset into the decoded text. Each
+	/// line starts at the first non-whitespace character after the end of the previous one.
+	/// Empty if the layout wasn't precomputed
+	std::span<const uint16_t> Breaks{};
+	///Every distinct title and author, each stored once and NUL terminated. Asset::Title and
+	/// Asset::Author are offsets into this. It starts with a NUL so offset zero is an empty
+	/// string. Empty if the generator didn't emit credits
+	std::span<const char> Credits{};
 };
 
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cinttypes>
+#include <span>
 
 ///< summary>Definition for individual glyph struct</summary>
 struct BdfGlyph
@@ -33,6 +34,16 @@ struct BdfFont
     uint8_t AsciiStop;
     /// The minimum number of vertical pixels needed (with zero vertical margin)
     uint8_t VerticalStep;
+    /// Start address of the column-major bitmap data (nullptr if the font wasn't generated with -c)
+    const uint8_t *Columns{nullptr};
+    /// Start address of the column-major offsets, one per glyph
+    const uint16_t *ColumnIndex{nullptr};
+    /// The highest any glyph rises above the baseline (zero if the font was generated without metrics)
+    int8_t MaxRise{0};
+    /// The lowest any glyph drops below the baseline (zero or negative)
+    int8_t MaxDrop{0};
+    /// Start address of the advance widths, one per encoding from AsciiStart (nullptr if not generated)
+    const uint8_t *Widths{nullptr};
 };
 
 /// <summary>The vertical characteristics of the selected font. ROW_MARGIN  is added to
@@ -46,3 +57,22 @@ struct Verticals
     /// The minimum vertical step for no gap or overlap
     int8_t verticalStep;
 };
+
+
+/// <summary>A non-owning view of the packed bitmap for a single glyph. Each of the bbh rows
+/// is Stride bytes wide, MSB first, exactly as stored in the font's Bitmaps array. If the font
+/// has column-major data then Columns holds bbw columns of ColumnStride bytes in the
+/// FrameBuffer layout (top row in the MSB), otherwise it is empty</summary>
+struct GlyphBits
+{
+    /// The glyph spec for this bitmap
+    BdfGlyph Glyph;
+    /// The packed row bytes (Stride * bbh bytes)
+    std::span<const uint8_t> Rows;
+    /// The number of bytes in each row
+    uint8_t Stride;
+    /// The packed column bytes (ColumnStride * bbw bytes)
+    std::span<const uint8_t> Columns{};
+    /// The number of bytes in each column
+    uint8_t ColumnStride{0};
+};
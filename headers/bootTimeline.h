@@ -0,0 +1,35 @@
+#pragma once
+
+#include <array>
+#include <cinttypes>
+#include <cstddef>
+#include <iostream>
+#include <string_view>
+#include <utility>
+
+/**
+ * @brief Timestamps the phases of start up (wifi started, RTC restored, panel ready, first
+ * frame...) against a microsecond clock so time-to-first-frame can be tracked from boot to
+ * boot. Marks go in a fixed array - it's used before anything else is up and must not
+ * allocate - and any past the sixteenth are dropped.
+ */
+class BootTimeline
+{
+public:
+    /// @param clock - microseconds since boot (time_us_64 on the badge)
+    explicit BootTimeline(uint64_t (*clock)());
+    void mark(char const *phase);
+    std::pair<bool, uint64_t> at(std::string_view phase) const;
+    size_t size() const { return count; }
+    void report(std::ostream &os) const;
+
+private:
+    struct Phase
+    {
+        char const *name;
+        uint64_t us;
+    };
+    uint64_t (*clock)();
+    std::array<Phase, 16> phases{};
+    size_t count{0};
+};
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cinttypes>
+#include <cstddef>
+#include "picoDatetime.h"
+
+/**
+ * @brief Calendar arithmetic on plain integers - proleptic Gregorian, with days and seconds
+ * counted from 1970-01-01 - so there's no libc, locale or time zone database behind it and
+ * it gives the same answers on the Pico as on the host, at compile time if need be.
+ */
+class CivilTime
+{
+public:
+    static constexpr int32_t secondsPerDay{86400};
+
+    /**
+     * @brief Days since 1970-01-01 (negative before)
+     */
+    static constexpr int32_t daysFromCivil(int32_t year, int32_t month, int32_t day)
+    {
+        // Shift the year to start in March so the leap day is the last day of the year
+        int32_t const y{year - (month <= 2 ? 1 : 0)};
+        int32_t const era{(y >= 0 ? y : y - 399) / 400};
+        int32_t const yoe{y - era * 400};
+        int32_t const doy{(153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1};
+        int32_t const doe{yoe * 365 + yoe / 4 - yoe / 100 + doy};
+        return era * 146097 + doe - 719468;
+    }
+
+    static constexpr int32_t daysFromCivil(datetime_t const &dt)
+    {
+        return daysFromCivil(dt.year, dt.month, dt.day);
+    }
+
+    /**
+     * @brief 0 is Sunday - 1970-01-01 was a Thursday
+     */
+    static constexpr int8_t weekday(int32_t days)
+    {
+        return static_cast<int8_t>(((days % 7) + 11) % 7);
+    }
+
+    /**
+     * @brief The date days after 1970-01-01, at midnight - the inverse of daysFromCivil
+     */
+    static constexpr datetime_t civilFromDays(int32_t days)
+    {
+        int32_t const z{days + 719468};
+        int32_t const era{(z >= 0 ? z : z - 146096) / 146097};
+        int32_t const doe{z - era * 146097};
+        int32_t const yoe{(doe - doe / 1460 + doe / 36524 - doe / 146096) / 365};
+        int32_t const doy{doe - (365 * yoe + yoe / 4 - yoe / 100)};
+        int32_t const mp{(5 * doy + 2) / 153};
+        int32_t const month{mp < 10 ? mp + 3 : mp - 9};
+        return datetime_t{.year = static_cast<int16_t>(yoe + era * 400 + (month <= 2 ? 1 : 0)),
+                          .month = static_cast<int8_t>(month),
+                          .day = static_cast<int8_t>(doy - (153 * mp + 2) / 5 + 1),
+                          .dotw = weekday(days),
+                          .hour = 0,
+                          .min = 0,
+                          .sec = 0};
+    }
+
+    /**
+     * @brief Seconds since 1970-01-01 00:00:00 for dt read as UTC
+     */
+    static constexpr int64_t toSeconds(datetime_t const &dt)
+    {
+        return int64_t{daysFromCivil(dt)} * secondsPerDay + dt.hour * 3600 + dt.min * 60 + dt.sec;
+    }
+
+    /**
+     * @brief The UTC date and time seconds after 1970-01-01 00:00:00 - the inverse of toSeconds
+     */
+    static constexpr datetime_t fromSeconds(int64_t seconds)
+    {
+        int64_t days{seconds / secondsPerDay};
+        int64_t rest{seconds % secondsPerDay};
+        if (rest < 0)
+        {
+            days--;
+            rest += secondsPerDay;
+        }
+        datetime_t dt{civilFromDays(static_cast<int32_t>(days))};
+        dt.hour = static_cast<int8_t>(rest / 3600);
+        dt.min = static_cast<int8_t>(rest / 60 % 60);
+        dt.sec = static_cast<int8_t>(rest % 60);
+        return dt;
+    }
+
+    /**
+     * @brief The day of the week'th Sunday of month - 1 to 4, or 5 for the last
+     */
+    static constexpr int32_t sunday(int32_t year, int32_t month, int32_t week)
+    {
+        if (week >= 5)
+        {
+            int32_t const last{daysFromCivil(month == 12 ? year + 1 : year, month == 12 ? 1 : month + 1, 1) - 1};
+            return last - weekday(last);
+        }
+        int32_t const first{daysFromCivil(year, month, 1)};
+        return first + (7 - weekday(first)) % 7 + 7 * (week - 1);
+    }
+};
+
+/**
+ * @brief When summer time starts or ends - a Sunday of a month at a fixed UTC time
+ */
+struct DstRule
+{
+    int8_t month;       ///< 1..12
+    int8_t week;        ///< 1..4 for the first to fourth Sunday, 5 for the last
+    int32_t utcSeconds; ///< when on the Sunday it changes, from midnight UTC (may be negative)
+
+    constexpr int64_t in(int32_t year) const
+    {
+        return int64_t{CivilTime::sunday(year, month, week)} * CivilTime::secondsPerDay + utcSeconds;
+    }
+};
+
+/**
+ * @brief A zone's offsets from UTC and its summer time rules. start after end in the year
+ * is a southern hemisphere zone, whose summer spans new year
+ */
+struct TimeZone
+{
+    int32_t standardOffset; ///< seconds east of UTC
+    int32_t dstOffset;      ///< seconds added in summer, 0 if the zone has no summer time
+    DstRule start;
+    DstRule end;
+
+    constexpr bool summer(int64_t utc) const
+    {
+        if (dstOffset == 0)
+        {
+            return false;
+        }
+        // the UTC year is the zone's year apart from hours around new year, when no zone changes
+        int32_t const year{CivilTime::fromSeconds(utc).year};
+        int64_t const starts{start.in(year)};
+        int64_t const ends{end.in(year)};
+        return starts < ends ? utc >= starts && utc < ends : utc >= starts || utc < ends;
+    }
+
+    /**
+     * @brief Seconds to add to UTC to get the zone's time at utc
+     */
+    constexpr int32_t offset(int64_t utc) const
+    {
+        return standardOffset + (summer(utc) ? dstOffset : 0);
+    }
+};
+
+namespace zones
+{
+    // The UK and EU have changed on the last Sundays of March and October at 01:00 UTC since 1996
+    inline constexpr TimeZone london{0, 3600, {3, 5, 3600}, {10, 5, 3600}};
+    inline constexpr TimeZone centralEurope{3600, 3600, {3, 5, 3600}, {10, 5, 3600}};
+    inline constexpr TimeZone easternEurope{7200, 3600, {3, 5, 3600}, {10, 5, 3600}};
+    // Since 2008 - the first Sundays of October and April at 02:00 and 03:00 local time
+    inline constexpr TimeZone sydney{36000, 3600, {10, 1, -8 * 3600}, {4, 1, -8 * 3600}};
+}
+
+/**
+ * @brief A zone's summer time changes from First to Last, worked out from its rules at
+ * compile time. An offset is then a binary search of the changes (as 32 bit seconds -
+ * 8 bytes a year) instead of two Sunday calculations; outside those years it falls back
+ * to the rules.
+ */
+template <int16_t First, int16_t Last>
+class DstTable
+{
+    static_assert(First >= 1970 && First <= Last && Last < 2106, "the changes are held as unsigned 32 bit seconds");
+
+public:
+    explicit constexpr DstTable(TimeZone const &zone) : zone{zone}
+    {
+        if (zone.dstOffset == 0)
+        {
+            return;
+        }
+        for (int32_t year{First}; year <= Last; year++)
+        {
+            changes[2 * (year - First)] = static_cast<uint32_t>(zone.start.in(year));
+            changes[2 * (year - First) + 1] = static_cast<uint32_t>(zone.end.in(year));
+        }
+        std::sort(changes.begin(), changes.end());
+        startsFirst = zone.start.in(First) < zone.end.in(First);
+    }
+
+    constexpr int32_t offset(int64_t utc) const
+    {
+        if (zone.dstOffset == 0)
+        {
+            return zone.standardOffset;
+        }
+        if (utc < firstSecond || utc >= endSecond)
+        {
+            return zone.offset(utc);
+        }
+        auto const passed{std::upper_bound(changes.begin(), changes.end(), static_cast<uint32_t>(utc)) - changes.begin()};
+        // in the north summer follows a start; in the south the year begins in summer
+        bool const summer{(passed % 2 == 1) == startsFirst};
+        return zone.standardOffset + (summer ? zone.dstOffset : 0);
+    }
+
+    constexpr std::array<uint32_t, 2 * (Last - First + 1)> const &transitions() const { return changes; }
+
+private:
+    static constexpr int64_t firstSecond{int64_t{CivilTime::daysFromCivil(First, 1, 1)} * CivilTime::secondsPerDay};
+    static constexpr int64_t endSecond{int64_t{CivilTime::daysFromCivil(Last + 1, 1, 1)} * CivilTime::secondsPerDay};
+
+    TimeZone zone;
+    std::array<uint32_t, 2 * (Last - First + 1)> changes{};
+    bool startsFirst{true};
+};
@@ -4,12 +4,32 @@
 #include <iostream>
 #include <span>
 #include "dimensions.h"
+#include "geometry.h"
 
+/**
+ * @brief The interface that LayoutServer draws through. The bulk operations have default
+ * implementations that fall back to set() so a driver only has to override the ones it
+ * can do natively. erase() can't be built from set() so every driver has to provide it.
+ */
 class displayDriver
 {
 public:
     virtual void clear() = 0;
     virtual void set(int x, int y) = 0;
     virtual void update() = 0;
+
+    // ORs a row-major, MSB first, 1-bpp bitmap into the display with its top left at (x,y)
+    virtual void blit(int x, int y, std::span<const uint8_t> bitmap, uint_t width, uint_t height, uint_t stride);
+    // ORs a column-major bitmap (FrameBuffer layout, top row in the MSB) into the display with its top left at (x,y)
+    virtual void blitColumns(int x, int y, std::span<const uint8_t> columns, uint_t width, uint_t height, uint_t columnStride);
+    // Sets a horizontal run of length pixels starting at (x,y)
+    virtual void span(int x, int y, int length);
+    // Sets every pixel in the rectangle
+    virtual void fill(Rect const &r);
+    // Clears every pixel in the rectangle
+    virtual void erase(Rect const &r) = 0;
+    // Replaces the whole display with a frame in the FrameBuffer (column-major) layout
+    virtual void copy(std::span<const uint8_t, FRAMEBUFFERSIZE> frame);
+
     virtual ~displayDriver();
 };
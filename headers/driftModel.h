@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cinttypes>
+#include <cstddef>
+
+/**
+ * @brief Learns how fast the RTC drifts from successive NTP syncs so the clock can be
+ * corrected between them and synced only as often as the error budget needs - the radio is
+ * off in between. The drift (ppm, positive when the clock gains) is a one state Kalman
+ * filter: each sync measures the drift since the one before, weighted by how well the two
+ * syncs pinned the time over that interval, and the estimate is allowed to wander (the
+ * crystal follows the temperature) between syncs. The clock is corrected in whole steps
+ * (the RTC only has seconds), which leaves up to half a step of error whatever the model
+ * knows, so the next sync is due when the error the drift estimate could have let build up
+ * reaches what's left of the budget after that.
+ */
+class DriftModel
+{
+public:
+    /// budgetMs is the worst error allowed, which has to be more than half of stepMs
+    explicit DriftModel(int32_t budgetMs = 1000, int32_t stepMs = 1000, uint32_t minIntervalS = 4 * 3600, uint32_t maxIntervalS = 7 * 86400);
+    void synced(int64_t trueMs, int64_t clockMs, int32_t uncertaintyMs);
+    /// A correction of ms has been applied to the clock since the last sync
+    void corrected(int32_t ms) { appliedMs += ms; }
+    int32_t correctionDue(int64_t sinceSyncMs) const;
+    int32_t stepDue(int64_t sinceSyncMs) const;
+    uint32_t syncInterval() const;
+    int32_t budget() const { return budgetMs; }
+
+    double ppm() const { return drift; }
+    double uncertaintyPpm() const;
+    size_t syncs() const { return count; }
+
+private:
+    /// How far a crystal the model knows nothing about might be out (1 sigma)
+    static constexpr double unknownPpm{50};
+    /// How far the drift might wander in a day
+    static constexpr double wanderPpm{0.5};
+
+    int32_t budgetMs;
+    int32_t stepMs;
+    uint32_t minIntervalS;
+    uint32_t maxIntervalS;
+    double drift{0};
+    double variance{unknownPpm * unknownPpm};
+    int64_t lastTrueMs{0};
+    int32_t lastUncertaintyMs{0};
+    int32_t appliedMs{0};
+    size_t count{0};
+};
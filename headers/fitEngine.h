@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <cinttypes>
+#include <string_view>
+#include "dimensions.h"
+#include "style.h"
+#include "fontServer.h"
+#include "fontRegistry.h"
+
+/// <summary>The font chosen for a quote and the number of lines it wraps to in that font.
+/// Fits is false if even the smallest font overflows the panel. Footer is false for a quote
+/// that only fits by taking the room kept for the footer, which is then left out</summary>
+struct Fit
+{
+	FontId Font;
+	uint8_t Lines;
+	bool Fits;
+	bool Footer;
+};
+
+/// <summary>Picks the largest font whose word wrapped layout fits the panel. The number of
+/// lines each font has room for is worked out once from its stored metrics, so a candidate
+/// is just a line count that stops as soon as it runs out of room, and the candidates are
+/// binary searched (three counts for five fonts). A quote too long for any font above the
+/// footer is searched again with the whole height. textGenerator fits each quote when it
+/// builds the corpus and LayoutServer fits any quote that arrives without a font</summary>
+class FitEngine
+{
+public:
+	/// The fonts tried for quotes, smallest to largest
+	static constexpr std::array<FontId, 5> Candidates{FontId::sans18, FontId::sans20, FontId::sans22,
+													  FontId::sans24, FontId::nimbus28};
+
+	/// footer is the height kept clear at the bottom of the panel for the credits
+	explicit FitEngine(FontRegistry &registry, Style const &style, size_t width = WIDTH, size_t height = HEIGHT, size_t footer = 0);
+	/// withBold is true if the text has bold markup - textGenerator records it per asset, so
+	/// the text isn't searched for it. A highlight is set in the bold face whatever it says
+	Fit fit(std::string_view text, TextSpan highlight = {}, bool withBold = false);
+	/// The number of lines of font that fit between the style's top edge and the footer,
+	/// stepped for bold runs if withBold
+	size_t maxLines(FontId font, bool withBold = false) const;
+	/// The height one line set in style takes, margin included - what a footer keeps clear of the quote
+	static size_t lineHeight(FontServer &fs, Style const &style);
+
+private:
+	FontRegistry &fonts;
+	size_t width;
+	size_t footer;
+	/// The lines each candidate has room for, for plain text and for text with bold runs (which
+	/// steps lines by the taller bold face)
+	struct Limits
+	{
+		std::array<size_t, Candidates.size()> plain;
+		std::array<size_t, Candidates.size()> bold;
+	};
+	/// Above the footer
+	Limits limits;
+	/// With the whole height, for quotes that don't fit above the footer
+	Limits fullLimits;
+	Fit search(Limits const &room, std::string_view text, TextSpan highlight, bool withBold);
+	size_t linesFor(FontServer &fs, std::string_view s, size_t limit, TextSpan highlight);
+};
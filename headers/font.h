@@ -62,6 +62,13 @@ public:
 	/// <returns>The number of Glyphs in the font file</returns>
 	const int GlyphCount() const;
 
+	/// <summary>
+	/// When set the include file also carries the bitmaps pre-transposed into
+	/// FrameBuffer (column-major) order. The row-major bitmaps are always written
+	/// </summary>
+	/// <param name="columns">true to emit the column tables</param>
+	void ColumnMajor(bool columns);
+
 private:
 	/// <summary> 
 	/// /// Loads the glyphs in the BDF
@@ -100,6 +107,19 @@ private:
 	/// <returns></returns>
 	const std::string BitmapDef() const;
 
+	/// <summary>
+	/// Generates the column-major bitmaps and the per glyph index into them
+	/// </summary>
+	/// <returns></returns>
+	const std::string ColumnDef() const;
+
+	/// <summary>
+	/// Generates the dense table of advance widths, one per encoding from the first
+	/// to the last, so FontServer can measure text without touching the glyph specs
+	/// </summary>
+	/// <returns></returns>
+	const std::string WidthDef() const;
+
 	std::string GlyphComment();
 
 	/// <summary>
@@ -174,6 +194,8 @@ private:
 	int dWidthMin;
 	int vExtentMax;
 
+	bool columnMajor_;
+
 	int ParseInt(std::string s);
 
 };
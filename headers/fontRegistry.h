@@ -0,0 +1,33 @@
+#pragma once
+
+#include <array>
+#include <cinttypes>
+#include "bdfFont.h"
+#include "style.h"
+#include "fontServer.h"
+
+/// <summary>A ready-made FontServer for every font compiled into the clock, indexed by FontId
+/// (the byte textGenerator stores in Asset::FontId). The servers are built once so choosing
+/// a font for a minute, or switching font part way through a layout, is an array lookup.
+/// Adding a font means adding a FontId and one line to the constructor.
+/// Each server is paired with its bold face here too, so the registry can't be copied</summary>
+class FontRegistry
+{
+public:
+	explicit FontRegistry();
+	FontRegistry(FontRegistry const &) = delete;
+	FontRegistry &operator=(FontRegistry const &) = delete;
+	/// Returns the server for a font id (asserts if the id isn't registered)
+	FontServer &fontFor(FontId id);
+	/// Returns the server for the font id byte from an asset, or the fallback's server if
+	/// the asset has no font (FontId::none) or names one this build doesn't carry
+	FontServer &fontFor(uint8_t id, FontId fallback);
+	/// True if id names a font held by the registry
+	bool has(uint8_t id) const;
+
+	static constexpr size_t Slots{static_cast<size_t>(FontId::nimbus28) + 1};
+
+private:
+	std::array<FontServer, Slots> servers;
+	std::array<bool, Slots> registered;
+};
@@ -4,6 +4,7 @@
 #include <string>
 #include <cinttypes>
 #include <vector>
+#include <string_view>
 #include "dimensions.h"
 #include "geometry.h"
 #include "style.h"
@@ -15,13 +16,50 @@ public:
 	explicit FontServer(BdfFont aFont);
 	// Returns verticals without the row margin (v.verticalStep = font.VerticalStep + rowMargin)
 	Verticals fontVerticals();
+	// Returns the verticals a line of this font needs. Text with bold runs takes the taller of this
+	// font and its bold face, so a larger bold face doesn't run into the lines either side
+	Verticals lineVerticals(bool const withBold);
 	// Returns the glyph spec for the given character (not the data)
 	// Returns the width in pixels of the given character (zero if not found)
 	size_t widthOf(char const c);
 	size_t widthOf(std::string stg);
 	BdfGlyph glyphFor(char const c);
-	// Returns data bits for the given character. Vector should contain exactly h rows of w bits
+	// Returns a non-owning view of the packed row bytes for the given character (no allocation)
+	GlyphBits bitmapFor(char const c);
+	// Returns data bits for the given character. Vector should contain exactly h rows of w bits.
+	// Allocates on every call so use bitmapFor for rendering
 	std::vector<bool> bitsFor(char const c);
+	// Returns the end (exclusive) of the line starting at pos when s is word wrapped to width pixels.
+	// bold is the markup state at pos and is left as the state at the returned end. Characters in
+	// highlight (e.g. the time marker) are measured in the bold face whatever the markup says
+	size_t lineEnd(std::string_view s, size_t pos, size_t width, bool &bold, TextSpan highlight = {});
+	// Returns the first position at or after start that isn't whitespace (s.size() if there isn't one)
+	static size_t skipWhitespace(std::string_view s, size_t start);
+	// True for the bold on/off markup characters, which are zero width and never drawn
+	static constexpr bool isMarkup(char const c) { return c == boldOn || c == boldOff; }
+	// Sets the font bold runs are measured and drawn in (nullptr for this font)
+	void setBold(FontServer *boldFace);
+	// Returns the server for a run in the given markup state
+	FontServer &face(bool const bold) { return (bold && boldServer != nullptr) ? *boldServer : *this; }
+	// False for the largest face of a family, which sets bold runs in itself
+	bool hasBoldFace() const { return boldServer != nullptr; }
+	// Calls emit(start, end) for each line of s word wrapped to width pixels in this font, with
+	// bold runs and the highlight measured in the bold face. The markup state is carried from line to line so
+	// this is one pass over s with nothing allocated.
+	// textGenerator and LayoutServer both wrap with this so precomputed breaks match the runtime
+	template <typename F>
+	void wrap(std::string_view s, size_t width, F &&emit, TextSpan highlight = {})
+	{
+		bool bold{false};
+		size_t lineStart{skipWhitespace(s, 0)};
+		size_t end{lineEnd(s, lineStart, width, bold, highlight)};
+		while (lineStart < s.size() && (lineStart != end))
+		{
+			emit(lineStart, end);
+			lineStart = skipWhitespace(s, end);
+			end = lineEnd(s, lineStart, width, bold, highlight);
+		}
+	}
 
 	/*
 		Debug Functions
@@ -32,6 +70,7 @@ public:
 
 private:
 	BdfFont font;
+	FontServer *boldServer{nullptr};
 	bool hasChar(char const c) const;
 	uint16_t GlyphIndex(char const c);
 	BdfGlyph GetGlyph(uint16_t glyphIdx);
@@ -3,6 +3,8 @@
 #include <cinttypes>
 #include <cstring>
 #include <memory>
+#include <span>
+#include <utility>
 #include <vector>
 
 #include "dimensions.h"
@@ -19,6 +21,14 @@ public:
     void line(Point const p1, Point const p2);
     void line(Point const p, Orientation orient, uint32_t length);
     void border();
+    void blit(int x, int y, std::span<const uint8_t> bitmap, uint_t width, uint_t height, uint_t stride);
+    void blitColumns(int x, int y, std::span<const uint8_t> columns, uint_t width, uint_t height, uint_t columnStride);
+    void span(int x, int y, int length);
+    void fill(Rect const &r);
+    void erase(Rect const &r);
+    void copy(std::span<const uint8_t, FRAMEBUFFERSIZE> frame);
+    std::pair<bool, Rect> changedFrom(std::span<const uint8_t, FRAMEBUFFERSIZE> previous) const;
+    size_t differingPixels(std::span<const uint8_t, FRAMEBUFFERSIZE> previous) const;
     inline uint_t width() { return WIDTH; }
     inline uint_t height() { return HEIGHT; }
     uint8_t data[FRAMEBUFFERSIZE];
@@ -30,5 +40,6 @@ private:
     const Point bottomRight;
     const Point bottomLeft;
     void set(Pixel p);
+    void columnMasks(Rect const &r, uint_t &firstByte, uint_t &lastByte, uint8_t &firstMask, uint8_t &lastMask);
     void testPattern();
 };
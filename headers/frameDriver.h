@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cinttypes>
+#include <span>
+#include "dimensions.h"
+#include "geometry.h"
+#include "displayDriver.h"
+#include "frameBuffer.h"
+
+/**
+ * @brief A displayDriver with no display - LayoutServer draws straight into a FrameBuffer
+ * that the owner reads back with frame(). Every bulk operation is passed through to
+ * FrameBuffer so a render costs the same as it does on the panel, minus the transfer.
+ * update() only counts the frames so callers can tell a render has finished.
+ */
+class frameDriver : public displayDriver
+{
+public:
+    explicit frameDriver() = default;
+    void clear() override;
+    void set(int x, int y) override;
+    void update() override;
+    void blit(int x, int y, std::span<const uint8_t> bitmap, uint_t width, uint_t height, uint_t stride) override;
+    void blitColumns(int x, int y, std::span<const uint8_t> columns, uint_t width, uint_t height, uint_t columnStride) override;
+    void span(int x, int y, int length) override;
+    void fill(Rect const &r) override;
+    void erase(Rect const &r) override;
+    void copy(std::span<const uint8_t, FRAMEBUFFERSIZE> frame) override;
+    ~frameDriver() override {};
+
+    /// @brief The frame as it stands - complete once update() has been called
+    FrameBuffer const &frame() const { return buffer; }
+    /// @brief The number of times update() has been called
+    uint32_t frames() const { return updates; }
+
+protected:
+    FrameBuffer buffer;
+    uint32_t updates{0};
+};
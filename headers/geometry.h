@@ -151,13 +151,29 @@ private:
 
 std::ostream &operator<<(std::ostream &os, Gradient &s);
 
+/**
+ * @brief An axis aligned rectangle defined by its top left and bottom right corners (both
+ * inclusive). The corners are Points so a Rect is always clamped to the display.
+ */
 class Rect
 {
 
 public:
     Rect();
+    Rect(Point const topLeft, Point const bottomRight);
+
+    inline const uint_t left() const { return tl.xVal(); }
+    inline const uint_t top() const { return tl.yVal(); }
+    inline const uint_t right() const { return br.xVal(); }
+    inline const uint_t bottom() const { return br.yVal(); }
+    inline const uint_t width() const { return br.xVal() - tl.xVal() + 1; }
+    inline const uint_t height() const { return br.yVal() - tl.yVal() + 1; }
+
+    bool operator==(const Rect &rhs) const;
 
 private:
     Point tl;
     Point br;
-};
\ No newline at end of file
+};
+
+std::ostream &operator<<(std::ostream &os, const Rect &rect);
\ No newline at end of file
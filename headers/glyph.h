@@ -35,6 +35,12 @@ public:
 	std::string ToBitMapString() const;
 	std::string ToDescription() const;
 
+	/// <summary>
+	/// The bitmap transposed into the FrameBuffer layout: bbw columns of (bbh + 7) / 8 bytes,
+	/// top row in the MSB of the first byte, unused bits in the last byte zero
+	/// </summary>
+	std::vector<uint8_t> ToColumnBytes() const;
+
 };
 
 #endif
\ No newline at end of file
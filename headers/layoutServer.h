@@ -6,6 +6,8 @@
 #include "picoDatetime.h"
 #include "quoteServer.h"
 #include "fontServer.h"
+#include "fontRegistry.h"
+#include "fitEngine.h"
 #include "bdfFont.h"
 #include "timeQuotes.h"
 #include "topCat.h"
@@ -24,18 +26,24 @@ class LayoutServer
 public:
 	LayoutServer(std::unique_ptr<displayDriver> hardwareDriver);
 	void timeIs(datetime_t const t);
+	void render(datetime_t const t);
+	void show();
 	void cmd(Button const b);
 
+#ifndef TESTING
 private:
+#endif
 	QuoteServer qs;
-	FontServer fs;
+	FontRegistry fonts;
+	/// Picks a font for any quote that arrives without one
+	FitEngine fitter;
+	/// The font being laid out - points into fonts so switching is free
+	FontServer *fs;
 	std::unique_ptr<displayDriver> driver;
-	void renderChar(BdfGlyph glyph, std::vector<bool> v, uint_t x, uint_t y);
-	size_t wrapper(std::string_view s, size_t txt, size_t len);
+	void renderChar(GlyphBits const &bits, int x, int y);
 	std::vector<std::string_view> wordWrap(std::string_view stg, size_t len);
-	size_t skipWhitespace(std::string_view s, size_t start);
-	size_t setFirstCharOrigin(size_t home, char c);
-	void layoutQuote(std::string_view q);
+	void layoutQuote(Quote const &q);
+	void renderFooter(Quote const &q);
 	void layoutClockFace(std::string q);
-	void renderLine(std::string_view line, int originX, int originY);
+	bool renderLine(std::string_view line, int originX, int originY, bool bold, TextSpan highlight = {});
 };
\ No newline at end of file
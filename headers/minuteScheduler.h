@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cinttypes>
+#include <cstddef>
+#include "picoDatetime.h"
+
+/**
+ * @brief Times each minute's update so the panel finishes refreshing on the minute rather
+ * than a render and a refresh after it. An RTC alarm wakes the clock lead seconds before
+ * the minute, the next minute's frame is drawn straight away, and the refresh is started
+ * as late as it can be and still end on the boundary - the driver predicts how long it
+ * will take. How far each refresh landed from the boundary is logged and fed back into
+ * the next start so a steady error (e.g. a slow SPI or render) cancels out.
+ */
+class MinuteScheduler
+{
+public:
+    explicit MinuteScheduler(uint8_t leadSeconds = 6);
+    datetime_t nextAlarm(datetime_t const &now) const;
+    static datetime_t minuteAfter(datetime_t const &now);
+    uint32_t startDelay(int64_t msToBoundary, uint32_t refreshMs) const;
+    void shown(int32_t latencyMs);
+
+    uint8_t lead() const { return leadSeconds; }
+    int32_t last() const { return lastLatency; }
+    /// The furthest any refresh has ended from its boundary, early or late
+    int32_t worst() const { return worstLatency; }
+    size_t minutes() const { return count; }
+
+private:
+    uint8_t leadSeconds;
+    /// Running mean of the latency (ms), taken off the next start delay
+    int32_t bias{0};
+    int32_t lastLatency{0};
+    int32_t worstLatency{0};
+    size_t count{0};
+};
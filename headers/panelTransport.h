@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cinttypes>
+#include <functional>
+#include <span>
+
+/**
+ * @brief The wires between UC8151 and the panel controller - SPI out, chip select,
+ * data/command, reset and BUSY. UC8151 speaks the controller's command set through this so
+ * the same driver runs on the badge (picoTransport) and against the host emulator
+ * (uc8151Emulator), which decodes the traffic instead of driving pins.
+ */
+class PanelTransport
+{
+public:
+    // Drives chip select (true selects the controller)
+    virtual void select(bool selected) = 0;
+    // Drives data/command - true for parameter or image data, false for a command byte
+    virtual void dataMode(bool data) = 0;
+    // Writes bytes to the controller, returning once they are sent
+    virtual void write(std::span<const uint8_t> bytes) = 0;
+    // Reads bytes back from the controller after a command (e.g. the temperature after TSC)
+    virtual void read(std::span<uint8_t> bytes) = 0;
+    // Drives the reset line - false holds the controller in reset
+    virtual void reset(bool run) = 0;
+    // True while the controller holds BUSY low (e.g. for the whole of a refresh)
+    virtual bool busy() = 0;
+    // Waits ms milliseconds
+    virtual void sleep(uint32_t ms) = 0;
+
+    // Starts writing bytes in the background (DMA on the badge) and returns at once. The
+    // bytes must stay put and the other lines left alone until writing() is false. The
+    // default is an ordinary write
+    virtual void startWrite(std::span<const uint8_t> bytes) { write(bytes); }
+    // True while a started write is still going out
+    virtual bool writing() { return false; }
+    // Calls event, in interrupt context, when a started write finishes or BUSY is released.
+    // An empty event turns the interrupts off. Transports without interrupts ignore this
+    // and the driver has to be polled
+    virtual void onEvent(std::function<void()>) {}
+
+    virtual ~PanelTransport() = default;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+#include <cinttypes>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include "picoDatetime.h"
+
+/**
+ * @brief One erasable sector of flash. Erasing sets every byte to 0xFF and programming
+ * can only clear bits, a page at a time.
+ */
+class FlashSector
+{
+public:
+    static constexpr size_t sectorSize{4096};
+    static constexpr size_t pageSize{256};
+
+    virtual void read(size_t offset, std::span<uint8_t> bytes) = 0;
+    virtual void erase() = 0;
+    // Programs one page - offset is a multiple of pageSize and bytes is pageSize long
+    virtual void program(size_t offset, std::span<const uint8_t> bytes) = 0;
+
+    virtual ~FlashSector() = default;
+};
+
+/**
+ * @brief Keeps the last known time in flash so a power cut (the RP2040's RTC isn't battery
+ * backed) comes back to roughly the right time instead of a fixed default. Each save takes
+ * the next page of one of two sectors; when that sector is used up the saves move on to
+ * the other, which is erased first, so one of the two is erased every sixteen saves and
+ * the sector holding the newest record never is. A record carries a sequence number and a
+ * checksum; the newest good one wins, so a save torn by the power going - erase included -
+ * leaves the one before.
+ */
+class PersistedTime
+{
+public:
+    explicit PersistedTime(FlashSector &first, FlashSector &second);
+    std::pair<bool, datetime_t> load();
+    bool save(datetime_t const &dt);
+
+private:
+    struct Record
+    {
+        uint32_t magic;
+        uint32_t sequence;
+        datetime_t time;
+        uint32_t check;
+    };
+    static constexpr uint32_t recordMagic{0x54494D45}; // "TIME"
+    static constexpr size_t pages{FlashSector::sectorSize / FlashSector::pageSize};
+    /// The pages of both sectors, numbered on from the first sector's into the second's
+    static constexpr size_t slots{2 * pages};
+
+    static uint32_t checksum(Record const &record);
+    void scan();
+    FlashSector &sectorOf(size_t slot) { return *sectors[slot / pages]; }
+    static size_t offsetOf(size_t slot) { return slot % pages * FlashSector::pageSize; }
+    bool blank(size_t slot, size_t count);
+
+    std::array<FlashSector *, 2> sectors;
+    bool scanned{false};
+    /// The slot holding the newest good record and its sequence, slots if there isn't one
+    size_t newest{slots};
+    Record latest{};
+};
@@ -1,11 +1,45 @@
 #pragma once
 #define TESTING
 #include <iostream>
+#include <array>
+#include <memory>
 #include <string>
 #include <string_view>
 #include "asset.h"
 #include "picoDatetime.h"
 #include "dimensions.h"
+#include "topCat.h"
+#include "style.h"
+
+/// <summary>How QuoteServer chooses between the quotes for a minute that has more than one.
+/// Every policy is constant time and works from the date alone, so asking for a minute again
+/// (a re-render, a repeat request) always gets the same quote</summary>
+enum class Rotation
+{
+	/// Always the first quote for the minute
+	first,
+	/// A different quote each day. Over Count days each quote is shown once, in an order
+	/// shuffled afresh for each cycle
+	dayShuffle,
+	/// The next quote in corpus order each day
+	roundRobin
+};
+
+/// <summary>A quote ready for layout. Breaks holds the precomputed end of each line (see
+/// AssetStack::Breaks) and is empty if the quote has to be wrapped at runtime. Marker is the
+/// phrase that names the time (empty if the generator didn't find one). Title and Author
+/// point into the stack's credits and are empty if it has none. Bold is true if any of the
+/// text (the marker included) is set in the bold face</summary>
+struct Quote
+{
+	std::string_view Text;
+	std::span<const uint16_t> Breaks;
+	uint8_t FontId;
+	TextSpan Marker{};
+	std::string_view Title{};
+	std::string_view Author{};
+	bool Bold{false};
+};
 
 class QuoteServer
 {
@@ -14,6 +48,9 @@ public:
 	explicit QuoteServer(AssetStack assets);
 	
 	std::pair<bool, std::string_view> quoteFor(datetime_t dt);
+	std::pair<bool, Quote> quoteAt(datetime_t dt);
+	void rotateBy(Rotation r);
+	Rotation rotation() const;
 
 	bool isDelimiter(char const c) const;
 	bool isLineBreak(char const c) const;
@@ -23,13 +60,24 @@ public:
 private:
 #endif
 	AssetStack stack;
+	/// Only allocated if the stack doesn't carry a generated minute index
+	std::unique_ptr<std::array<MinuteIndex, MINUTES_PER_DAY>> builtMinutes;
+	Rotation policy;
+	/// The last quote decoded from a compressed stack. quoteFor returns views into this
+	std::array<char, MAX_TEXT_LEN + 1> decoded;
 	bool isValidStack(AssetStack const asset) const;
+	bool buildMinutes();
+	MinuteIndex const &minuteFor(size_t key) const;
 
 	bool hasKey(const size_t key);
 	int keyFrom(datetime_t dt);
 
 	std::pair<bool, const Asset> GetAssetByKey(size_t key);
+	std::pair<bool, const Asset> GetAssetFor(datetime_t const &dt);
+	uint16_t choose(size_t key, uint16_t count, datetime_t const &dt);
 	std::pair<bool, std::string_view> const GetAssetText(const Asset asset);
+	std::string_view creditAt(uint16_t offset) const;
 	std::pair<bool, size_t> textCheck(size_t start);
 	std::pair<bool, size_t> lengthCheck(size_t start);
+	std::pair<bool, size_t> decode(size_t start);
 };
\ No newline at end of file
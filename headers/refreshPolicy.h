@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cinttypes>
+#include <cstddef>
+#include "dimensions.h"
+
+/// The UC8151 waveforms, slowest and cleanest first. The values are UC8151's update speeds
+enum class Waveform : uint8_t
+{
+    clean = 0,  ///< the panel's own OTP waveform - ~4.5s of flashing but no ghosts
+    medium = 1, ///< ~2.5s
+    fast = 2,   ///< ~0.5s
+    turbo = 3   ///< ~0.13s, leaves a faint ghost of what was there before
+};
+
+/**
+ * @brief Picks the waveform for each refresh. The fast waveforms only work when the panel
+ * is warm, and each one leaves a little ghosting that builds up until a clean refresh
+ * clears it, so the choice weighs the panel's temperature, how much of the frame changed
+ * and how many fast refreshes have been done since the last clean one. Most minutes get
+ * turbo, a big change gets fast, and a clean refresh is forced before the ghosting gets
+ * bad - early if a big change comes along once half the allowance has been used.
+ */
+class RefreshPolicy
+{
+public:
+    Waveform choose(int8_t celsius, size_t changedPixels) const;
+    void refreshed(Waveform waveform);
+    uint_t fastUpdates() const { return fastSinceClean; }
+
+    /// Fast refreshes allowed between clean ones
+    static constexpr uint_t maxFastUpdates{15};
+    /// Below this the fast waveforms don't drive the ink fully (degrees C)
+    static constexpr int8_t coldBelow{10};
+    /// Below this medium is the fastest that's safe (degrees C)
+    static constexpr int8_t coolBelow{18};
+    /// A change of more than 1 / bigChange of the panel ghosts badly on turbo
+    static constexpr size_t bigChange{8};
+
+private:
+    /// Starts spent - the panel's contents are unknown at power up so the first is clean
+    uint_t fastSinceClean{maxFastUpdates};
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <cinttypes>
+#include "dimensions.h"
+#include "picoDatetime.h"
+#include "frameDriver.h"
+#include "layoutServer.h"
+#include "spscSlot.h"
+
+/// A rendered minute, in the FrameBuffer (column-major) layout
+struct Frame
+{
+    datetime_t minute;
+    uint8_t pixels[FRAMEBUFFERSIZE];
+};
+
+/**
+ * @brief Renders minutes on one core for the panel on the other. The refreshing side asks
+ * for a minute with request() and collects it with ready(); the rendering side calls
+ * renderNext() in its loop, which draws each requested minute into a free frame with its
+ * own LayoutServer. Requests and frames each go through an SpscSlot so neither side ever
+ * waits on a lock - with two frames the renderer can be a minute ahead while the panel
+ * shows the current one.
+ */
+class RenderPipeline
+{
+public:
+    explicit RenderPipeline();
+
+    // refreshing side
+    bool request(datetime_t const &minute);
+    Frame const *ready(datetime_t const &minute);
+    Frame const &frameFor(datetime_t const &minute);
+    void release();
+
+    // rendering side
+    bool renderNext();
+    uint32_t rendered() const { return renders.load(std::memory_order_relaxed); }
+
+    static bool sameMinute(datetime_t const &a, datetime_t const &b);
+
+private:
+    frameDriver *drawing;
+    LayoutServer lo;
+    SpscSlot<datetime_t, 4> requests;
+    SpscSlot<Frame, 2> frames;
+    /// The last minute asked for, so frameFor() doesn't ask twice
+    datetime_t lastRequest{};
+    std::atomic<uint32_t> renders{0};
+};
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <array>
+#include <cinttypes>
+#include <cstddef>
+#include <utility>
+#include "udpTransport.h"
+
+/// One exchange with a time server, in microseconds
+struct SntpSample
+{
+    /// UTC (since 1970) minus the local clock
+    int64_t offsetUs;
+    /// Round trip, less the time the server held the request
+    int64_t delayUs;
+    uint8_t stratum;
+    /// The server's own round trip and error to its reference clock
+    uint32_t rootDelayUs;
+    uint32_t rootDispersionUs;
+
+    int64_t utcUs(uint64_t localUs) const { return static_cast<int64_t>(localUs) + offsetUs; }
+    /// How far the offset might be out - the path could be wholly one way, plus the server's error
+    uint32_t uncertaintyUs() const { return static_cast<uint32_t>(delayUs / 2) + rootDelayUs / 2 + rootDispersionUs; }
+};
+
+/**
+ * @brief SNTP (RFC 4330) over a UdpTransport. Each query uses all four timestamps - sent
+ * and received on the local clock, received and sent on the server's - so the offset
+ * allows for the round trip and the time the server took, to the microsecond rather than
+ * the whole transmit second. Replies that aren't an answer to this request (the origin
+ * timestamp must echo it) or come from an unsynchronised server are dropped. best() takes
+ * a burst of samples and keeps the one with the shortest round trip: queueing only ever
+ * adds delay, and the least delayed path is the least asymmetric.
+ */
+class SntpClient
+{
+public:
+    static constexpr uint16_t port{123};
+    static constexpr size_t packetSize{48};
+
+    explicit SntpClient(UdpTransport &udp);
+    std::pair<bool, SntpSample> query(uint32_t timeoutMs = 2000);
+    std::pair<bool, SntpSample> best(size_t samples = 4, uint32_t spacingMs = 2000, uint32_t timeoutMs = 2000);
+
+    static uint64_t toNtp(int64_t unixUs);
+    static int64_t fromNtp(uint64_t ntp);
+
+private:
+    UdpTransport &udp;
+
+    static uint64_t read64(std::array<uint8_t, packetSize> const &packet, size_t at);
+    static void write64(std::array<uint8_t, packetSize> &packet, size_t at, uint64_t value);
+    static uint32_t shortUs(std::array<uint8_t, packetSize> const &packet, size_t at);
+};
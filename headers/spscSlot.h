@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cinttypes>
+#include <cstddef>
+
+/**
+ * @brief A lock-free hand-over between one producer and one consumer (e.g. RP2040 core 1
+ * rendering and core 0 refreshing, or two std::threads on linux). It is a ring of N slots
+ * that are written in place - the producer claims a free slot, fills it and publishes it;
+ * the consumer peeks at the oldest published slot, uses it and releases it. Nothing is
+ * copied and nothing blocks: claim() and peek() return nullptr when there is nothing to do.
+ *
+ * head is only written by the producer and tail only by the consumer, so the only atomic
+ * operations needed are 32 bit loads and stores - the Cortex-M0+ has no read-modify-write
+ * instructions, but aligned word loads and stores with barriers (release/acquire) are safe
+ * between its cores.
+ */
+template <typename T, size_t N>
+class SpscSlot
+{
+    static_assert(N > 0 && (N & (N - 1)) == 0, "N must be a power of two so the counters can wrap");
+    // Not is_always_lock_free - GCC reports armv6-m ints as only sometimes lock free because
+    // it has no read-modify-write. All this needs is a plain aligned word to load and store
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) && alignof(std::atomic<uint32_t>) == alignof(uint32_t));
+
+public:
+    /// Producer - a free slot to fill, or nullptr if the consumer holds them all
+    T *claim()
+    {
+        auto const h{head.load(std::memory_order_relaxed)};
+        if (h - tail.load(std::memory_order_acquire) == N)
+        {
+            return nullptr;
+        }
+        return &slots[h % N];
+    }
+
+    /// Producer - hands the claimed slot over
+    void publish()
+    {
+        head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /// Consumer - the oldest published slot, or nullptr if there isn't one
+    T const *peek() const
+    {
+        auto const t{tail.load(std::memory_order_relaxed)};
+        if (head.load(std::memory_order_acquire) == t)
+        {
+            return nullptr;
+        }
+        return &slots[t % N];
+    }
+
+    /// Consumer - gives the peeked slot back to the producer
+    void release()
+    {
+        tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /// How many slots are published and not yet released (exact from either side's own
+    /// point of view, a snapshot from anywhere else)
+    size_t size() const
+    {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+private:
+    std::array<T, N> slots{};
+    // on separate cache lines on a host so the two sides don't false share
+    alignas(64) std::atomic<uint32_t> head{0};
+    alignas(64) std::atomic<uint32_t> tail{0};
+};
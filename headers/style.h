@@ -1,11 +1,53 @@
 #pragma once
 
+#include <cinttypes>
+#include <cstddef>
 #include "bdfFont.h"
 
+/// <summary>Identifies the font a quote was laid out in by textGenerator (stored in Asset::FontId).
+/// none means the asset has no precomputed layout</summary>
+enum class FontId : uint8_t
+{
+    none = 0,
+    sans22 = 1,
+    sans24 = 2,
+    font112 = 3,
+    sans18 = 4,
+    sans20 = 5,
+    nimbus28 = 6
+};
+
+/// <summary>Inline markup in quote text. The run between them is set in the bold face of the
+/// quote's font; the markers themselves take no room and are never drawn</summary>
+constexpr char boldOn = '<';
+constexpr char boldOff = '>';
+
+/// <summary>A run of bytes in a quote, e.g. the phrase that names the time. Length zero
+/// means there isn't one</summary>
+struct TextSpan
+{
+    uint16_t Start{0};
+    uint16_t Length{0};
+
+    constexpr bool contains(size_t pos) const { return pos >= Start && pos < static_cast<size_t>(Start) + Length; }
+    /// The part of the span at or after origin, counted from origin (e.g. from the start of a line)
+    constexpr TextSpan from(size_t origin) const
+    {
+        size_t const end{static_cast<size_t>(Start) + Length};
+        if (Length == 0 || end <= origin)
+        {
+            return TextSpan{};
+        }
+        size_t const start{Start > origin ? Start : origin};
+        return TextSpan{static_cast<uint16_t>(start - origin), static_cast<uint16_t>(end - start)};
+    }
+};
+
 struct Style
 {
     BdfFont font;
     BdfFont bold;
+    FontId fontId;
     int homeX;
     int homeY;
     int topMargin;
@@ -4,13 +4,12 @@
 #include "font112.h"
 #include "sans22.h"
 #include "sans24.h"
-
-constexpr char boldOn = '<';
-constexpr char boldOff = '>';
+#include "Sans18.h"
 
 Style clockStyle{
     .font = font112,
     .bold = Sans24,
+    .fontId = FontId::font112,
     .homeX = 0,
     .homeY = 10,
     .topMargin = 0,
@@ -22,10 +21,24 @@ Style clockStyle{
 Style quoteStyle{
     .font = Sans22,
     .bold = Sans24,
+    .fontId = FontId::sans22,
     .homeX = 0,
     .homeY = 10,
     .topMargin = 0,
     .leftMargin = 0,
     .originX = 0,
     .originY = 0,
-    .rowMargin = 1};
\ No newline at end of file
+    .rowMargin = 1};
+
+/// The credit along the bottom of a quote. topMargin is the gap kept between it and the quote
+Style footerStyle{
+    .font = Sans18,
+    .bold = Sans18,
+    .fontId = FontId::sans18,
+    .homeX = 0,
+    .homeY = 0,
+    .topMargin = 2,
+    .leftMargin = 0,
+    .originX = 0,
+    .originY = 0,
+    .rowMargin = 0};
\ No newline at end of file
@@ -6,10 +6,13 @@
 #include <ctime>
 #include <chrono>
 #include "picoDatetime.h"
+#include "civilTime.h"
 
 /**
  * @brief converts a standard C time_t (i.e. seconds since 1970) to a Pico dateTime_t or
- * a standard C tm struct (broken out time).
+ * a standard C tm struct (broken out time) in UK time. The conversions are CivilTime
+ * arithmetic plus a table of British Summer Time changes, so they don't depend on a
+ * locale or a tz database (the Pico has neither).
  */
 class TopCat
 {
@@ -29,9 +32,36 @@ public:
     static std::string toClockTime(datetime_t &dt);
     static std::string toClockTime(const tm &ttm);
 
+    /**
+     * @brief Days since 1970-01-01 for the date part of dt (no libc, no time zone)
+     */
+    static constexpr int32_t dayNumber(datetime_t const &dt)
+    {
+        return CivilTime::daysFromCivil(dt);
+    }
+
+    /// UK summer time changes for this century, generated at compile time (800 bytes)
+    static constexpr DstTable<2000, 2099> summerTime{zones::london};
+
+    /**
+     * @brief Seconds to add to UTC for UK time at tt
+     */
+    static constexpr int32_t utcOffset(time_t tt)
+    {
+        return summerTime.offset(tt);
+    }
+
+    /**
+     * @brief UK time at tt, with the day of the week set
+     */
+    static constexpr datetime_t ukTime(time_t tt)
+    {
+        return CivilTime::fromSeconds(tt + utcOffset(tt));
+    }
+
 private:
     datetime_t startup;
-    time_t picoch;
+    int64_t picoch;
 
     /**
      * @brief returns the number of the last day in the given month
@@ -55,8 +85,6 @@ private:
     static void rawCopy_dt(tm const *tmt, datetime_t *dt);
 
     static datetime_t default_dt();
-
-    static inline void setGBLocale() { setlocale(LC_TIME, "en_GB.utf8"); };
 };
 
 std::ostream &operator<<(std::ostream &os, datetime_t dt);
\ No newline at end of file
@@ -0,0 +1,112 @@
+#pragma once
+#include <climits>
+#include <cinttypes>
+#include <cstddef>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include "dimensions.h"
+#include "geometry.h"
+#include "frameBuffer.h"
+#include "panelTransport.h"
+#include "refreshPolicy.h"
+
+/// Where an update is - idle, streaming the frame to the controller or waiting on BUSY
+enum class UpdateStatus
+{
+    idle,
+    sending,
+    refreshing
+};
+
+/**
+ * @brief displayDriver for the UC8151 e-paper controller. It only knows the controller's
+ * command set - the pins, SPI and timing belong to the PanelTransport it is given, so the
+ * same driver runs on the badge and against the host emulator.
+ */
+class UC8151 : public displayDriver
+{
+public:
+    explicit UC8151(std::unique_ptr<PanelTransport> panel);
+    void update() override;
+    void clear() override;
+    void set(int x, int y) override;
+    void blit(int x, int y, std::span<const uint8_t> bitmap, uint_t width, uint_t height, uint_t stride) override;
+    void blitColumns(int x, int y, std::span<const uint8_t> columns, uint_t width, uint_t height, uint_t columnStride) override;
+    void span(int x, int y, int length) override;
+    void fill(Rect const &r) override;
+    void erase(Rect const &r) override;
+    void copy(std::span<const uint8_t, FRAMEBUFFERSIZE> frame) override;
+    ~UC8151() override {};
+
+    void setBlocking(bool wait);
+    UpdateStatus status() const { return state; }
+    void onComplete(std::function<void()> done) { completed = std::move(done); }
+    void poll();
+    /// True when an interrupt has left poll() something to do
+    bool pollDue() const { return (state == UpdateStatus::sending && lastSent) || (state == UpdateStatus::refreshing && released); }
+    int8_t temperature();
+    uint32_t refreshTime() const;
+
+private:
+    void initDriver();
+    void command(uint8_t reg, size_t len, const uint8_t *data);
+    void command(uint8_t reg, std::initializer_list<uint8_t> values);
+    void command(uint8_t reg) { command(reg, 0, nullptr); };
+    void data(size_t len, const uint8_t *data);
+    void off();
+    void read(uint8_t reg, size_t len, uint8_t *data);
+    void busy_wait();
+    void startUpdate();
+    void interrupt();
+    bool sendColumn();
+    void finishSending();
+    void finishRefresh();
+    void reset();
+    bool is_busy();
+    void power_off();
+    bool set_update_speed(int update_speed);
+    void useWaveform(Waveform waveform);
+    uint8_t psrSetting() const;
+    void loadLuts();
+
+    void default_luts();
+    void medium_luts();
+    void fast_luts();
+    void turbo_luts();
+    static uint32_t update_time(uint8_t speed);
+    uint8_t get_update_speed();
+    uint8_t update_speed;
+
+    FrameBuffer buffer;
+    /// What the panel is showing, so update() can send just the part that changed
+    std::array<uint8_t, FRAMEBUFFERSIZE> shown{};
+    /// False until the first full update - the panel's contents are unknown before that
+    bool shownValid{false};
+
+    bool inverted{false};
+    bool blocking{true};
+
+    /// The update in flight - shown is what's being sent, window the part of it going out
+    /// (all of it unless partial) and column the next column to send. Only update() and
+    /// poll() change state; the interrupt reads it and moves column on
+    std::atomic<UpdateStatus> state{UpdateStatus::idle};
+    /// Set by update() while another is in flight so the latest frame follows it. update() and
+    /// poll() both run in the main loop, so it's a plain flag
+    bool pending{false};
+    /// Set by the interrupt once the last column has gone and once BUSY is released. Only
+    /// loads and stores - the Cortex-M0+ has no atomic read-modify-write
+    std::atomic<bool> lastSent{false};
+    std::atomic<bool> released{false};
+    Rect window;
+    bool partial{false};
+    uint_t column{0};
+    std::function<void()> completed;
+    /// Picks the waveform for each refresh
+    RefreshPolicy policy;
+    /// The temperature at the last update, for predicting the next
+    int8_t panelTemperature{20};
+
+    std::unique_ptr<PanelTransport> panel;
+};
\ No newline at end of file
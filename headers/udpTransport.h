@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cinttypes>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+/**
+ * @brief Datagrams to and from one remote host and port, with the local clock they're
+ * timed against. SntpClient talks to a time server through this so the same client runs
+ * on the badge (lwipUdp, over the cyw43 radio) and on the host (posixUdp, sockets) against
+ * a local fake server.
+ */
+class UdpTransport
+{
+public:
+    /// A datagram as received - its length and when it arrived on the local clock
+    struct Datagram
+    {
+        size_t size;
+        uint64_t atUs;
+    };
+
+    // Looks host up and sends to (and only receives from) it on port
+    virtual bool open(char const *host, uint16_t port) = 0;
+    // Sends bytes as one datagram
+    virtual bool send(std::span<const uint8_t> bytes) = 0;
+    // Waits up to timeoutMs for a datagram, copying as much as fits into bytes
+    virtual std::pair<bool, Datagram> receive(std::span<uint8_t> bytes, uint32_t timeoutMs) = 0;
+    virtual void close() = 0;
+    // The local clock - microseconds from any fixed point (boot on the badge)
+    virtual uint64_t nowUs() = 0;
+    // Waits ms milliseconds
+    virtual void sleep(uint32_t ms) = 0;
+
+    virtual ~UdpTransport() = default;
+};
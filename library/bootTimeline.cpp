@@ -0,0 +1,50 @@
+#include <iomanip>
+#include "bootTimeline.h"
+
+BootTimeline::BootTimeline(uint64_t (*clock)()) : clock{clock}
+{
+}
+
+/**
+ * @brief Records that phase has been reached now
+ * @param phase - a string that outlives the timeline (a literal)
+ */
+void BootTimeline::mark(char const *phase)
+{
+    if (count < phases.size())
+    {
+        phases[count++] = {phase, clock()};
+    }
+}
+
+/**
+ * @brief When phase was reached, in microseconds since boot
+ * @return first is false if it never was
+ */
+std::pair<bool, uint64_t> BootTimeline::at(std::string_view phase) const
+{
+    for (size_t i{0}; i < count; i++)
+    {
+        if (phase == phases[i].name)
+        {
+            return {true, phases[i].us};
+        }
+    }
+    return {false, 0};
+}
+
+/**
+ * @brief One line per phase - when it was reached and how long after the one before
+ */
+void BootTimeline::report(std::ostream &os) const
+{
+    uint64_t previous{0};
+    os << "Boot timeline (ms since boot, +ms since the previous phase)\n\r";
+    for (size_t i{0}; i < count; i++)
+    {
+        auto const &phase{phases[i]};
+        os << std::setw(8) << phase.us / 1000 << " +" << std::setw(6) << (phase.us - previous) / 1000
+           << "  " << phase.name << "\n\r";
+        previous = phase.us;
+    }
+}
@@ -4,3 +4,102 @@ displayDriver::~displayDriver()
 {
     std::cout << "~~displayDriver destructor~~" << std::endl;
 }
+
+/**
+ * @brief Fallback blit - one call to set() for each lit pixel that lands on the display
+ */
+void displayDriver::blit(int x, int y, std::span<const uint8_t> bitmap, uint_t width, uint_t height, uint_t stride)
+{
+    if (bitmap.size() < static_cast<size_t>(stride) * height)
+    {
+        return;
+    }
+    for (uint_t row{0}; row < height; row++)
+    {
+        int const py{y + row};
+        if (py < 0 || py > MAX_Y_BITS)
+        {
+            continue;
+        }
+        for (uint_t col{0}; col < width; col++)
+        {
+            int const px{x + col};
+            if ((bitmap[row * stride + (col >> 3)] & (0b10000000 >> (col & 0b111))) && px >= 0 && px <= MAX_X)
+            {
+                set(px, py);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Fallback column blit - one call to set() for each lit pixel that lands on the display
+ */
+void displayDriver::blitColumns(int x, int y, std::span<const uint8_t> columns, uint_t width, uint_t height, uint_t columnStride)
+{
+    if (columns.size() < static_cast<size_t>(columnStride) * width)
+    {
+        return;
+    }
+    for (uint_t col{0}; col < width; col++)
+    {
+        int const px{x + col};
+        if (px < 0 || px > MAX_X)
+        {
+            continue;
+        }
+        for (uint_t row{0}; row < height; row++)
+        {
+            int const py{y + row};
+            if ((columns[col * columnStride + (row >> 3)] & (0b10000000 >> (row & 0b111))) && py >= 0 && py <= MAX_Y_BITS)
+            {
+                set(px, py);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Fallback span - one call to set() per pixel
+ */
+void displayDriver::span(int x, int y, int length)
+{
+    if (y < 0 || y > MAX_Y_BITS)
+    {
+        return;
+    }
+    for (int px{std::max(x, 0)}; px < x + length && px <= MAX_X; px++)
+    {
+        set(px, y);
+    }
+}
+
+/**
+ * @brief Fallback fill - one span per row
+ */
+void displayDriver::fill(Rect const &r)
+{
+    for (uint_t y{r.top()}; y <= r.bottom(); y++)
+    {
+        span(r.left(), y, r.width());
+    }
+}
+
+/**
+ * @brief Fallback copy - clears the display and then sets each lit pixel in the frame
+ */
+void displayDriver::copy(std::span<const uint8_t, FRAMEBUFFERSIZE> frame)
+{
+    clear();
+    constexpr uint_t columnBytes{HEIGHT / 8};
+    for (uint_t i{0}; i < FRAMEBUFFERSIZE; i++)
+    {
+        for (uint8_t bit{0}; bit < 8; bit++)
+        {
+            if (frame[i] & (0b10000000 >> bit))
+            {
+                set(i / columnBytes, (i % columnBytes) * 8 + bit);
+            }
+        }
+    }
+}
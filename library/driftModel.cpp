@@ -0,0 +1,91 @@
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include "driftModel.h"
+#include "debug.h"
+
+DriftModel::DriftModel(int32_t budgetMs, int32_t stepMs, uint32_t minIntervalS, uint32_t maxIntervalS) : budgetMs{budgetMs},
+                                                                                                         stepMs{stepMs},
+                                                                                                         minIntervalS{minIntervalS},
+                                                                                                         maxIntervalS{maxIntervalS}
+{
+    assert(stepMs > 0 && 2 * budgetMs > stepMs);
+}
+
+/**
+ * @brief Records a sync, after which the clock is set to the true time
+ *
+ * @param trueMs - the time from NTP
+ * @param clockMs - what the clock read at that moment, corrections included
+ * @param uncertaintyMs - how far trueMs might be out
+ */
+void DriftModel::synced(int64_t trueMs, int64_t clockMs, int32_t uncertaintyMs)
+{
+    auto const intervalMs{trueMs - lastTrueMs};
+    if (count > 0 && intervalMs > 0)
+    {
+        // the drift since the last sync, without the corrections applied on the way
+        double const measured{static_cast<double>(clockMs - appliedMs - trueMs) * 1e6 / static_cast<double>(intervalMs)};
+        double const noise{std::hypot(lastUncertaintyMs, uncertaintyMs) * 1e6 / static_cast<double>(intervalMs)};
+        variance += wanderPpm * wanderPpm * static_cast<double>(intervalMs) / 86'400'000.0;
+
+        // anything wildly out is the clock being set some other way, not drift
+        if (std::abs(measured - drift) > 5 * std::sqrt(variance + noise * noise))
+        {
+            dbg("Ignoring a drift of " << measured << "ppm (expected " << drift << "ppm)" << std::endl);
+        }
+        else
+        {
+            double const gain{variance / (variance + noise * noise)};
+            drift += gain * (measured - drift);
+            variance *= 1 - gain;
+        }
+    }
+    lastTrueMs = trueMs;
+    lastUncertaintyMs = uncertaintyMs;
+    appliedMs = 0;
+    count++;
+    dbg("RTC drift " << drift << " +/- " << uncertaintyPpm() << "ppm, next sync in " << syncInterval() / 60 << " minutes" << std::endl);
+}
+
+double DriftModel::uncertaintyPpm() const
+{
+    return std::sqrt(variance);
+}
+
+/**
+ * @brief The correction still to be applied to the clock, sinceSyncMs after the last sync
+ */
+int32_t DriftModel::correctionDue(int64_t sinceSyncMs) const
+{
+    return static_cast<int32_t>(std::lround(-drift * static_cast<double>(sinceSyncMs) / 1e6)) - appliedMs;
+}
+
+/**
+ * @brief The correction to apply now in whole steps - zero until at least half a step is due
+ */
+int32_t DriftModel::stepDue(int64_t sinceSyncMs) const
+{
+    auto const due{correctionDue(sinceSyncMs)};
+    return (due + (due > 0 ? stepMs / 2 : -stepMs / 2)) / stepMs * stepMs;
+}
+
+/**
+ * @brief Seconds from the last sync to the next - the longest (to the hour) over which the
+ * drift estimate, allowed to wander, keeps the clock within the budget less the half step
+ * the corrections can leave
+ */
+uint32_t DriftModel::syncInterval() const
+{
+    uint32_t interval{minIntervalS};
+    for (uint32_t next{minIntervalS + 3600}; next <= maxIntervalS; next += 3600)
+    {
+        double const sigma{std::sqrt(variance + wanderPpm * wanderPpm * next / 86'400.0)};
+        if (sigma * next / 1000.0 > budgetMs - stepMs / 2.0)
+        {
+            break;
+        }
+        interval = next;
+    }
+    return interval;
+}
@@ -0,0 +1,108 @@
+#include <algorithm>
+#include "fitEngine.h"
+
+FitEngine::FitEngine(FontRegistry &registry, Style const &style, size_t width, size_t height, size_t footer) : fonts{registry},
+																											   width{width},
+																											   footer{footer},
+																											   limits{},
+																											   fullLimits{}
+{
+	auto const limit{[&](FontServer &fs, size_t bottom, bool withBold)
+					 {
+						 auto v{fs.lineVerticals(withBold)};
+						 // LayoutServer puts the first baseline maxRise below homeY and steps down by the
+						 // vertical step plus the row margin. The last line's descenders have to stay above bottom
+						 int const room{static_cast<int>(bottom) - style.homeY - v.maxRise + v.maxDrop};
+						 int const step{v.verticalStep + style.rowMargin};
+						 return (room < 0 || step <= 0) ? size_t{0} : static_cast<size_t>(room / step + 1);
+					 }};
+	for (size_t i{0}; i < Candidates.size(); i++)
+	{
+		FontServer &fs{fonts.fontFor(Candidates[i])};
+		limits.plain[i] = limit(fs, height - footer, false);
+		limits.bold[i] = limit(fs, height - footer, true);
+		fullLimits.plain[i] = limit(fs, height, false);
+		fullLimits.bold[i] = limit(fs, height, true);
+	}
+}
+
+/// @brief Picks the largest font the text fits above the footer in, or failing that the
+/// largest it fits the whole height in, with no footer
+/// @param text - The quote
+/// @param highlight - The time marker, which is set in the bold face
+/// @param withBold - True if the text has bold markup
+/// @return - The font and line count, or the smallest font with Fits false if nothing fits
+Fit FitEngine::fit(std::string_view text, TextSpan highlight, bool withBold)
+{
+	withBold = withBold || highlight.Length > 0;
+	Fit best{search(limits, text, highlight, withBold)};
+	if (!best.Fits && footer > 0)
+	{
+		Fit const whole{search(fullLimits, text, highlight, withBold)};
+		if (whole.Fits)
+		{
+			return Fit{whole.Font, whole.Lines, true, false};
+		}
+	}
+	if (!best.Fits)
+	{
+		best.Lines = static_cast<uint8_t>(std::min<size_t>(linesFor(fonts.fontFor(best.Font), text, UINT8_MAX, highlight), UINT8_MAX));
+	}
+	return best;
+}
+
+size_t FitEngine::maxLines(FontId font, bool withBold) const
+{
+	auto const it{std::find(Candidates.begin(), Candidates.end(), font)};
+	return it == Candidates.end() ? 0 : (withBold ? limits.bold : limits.plain)[it - Candidates.begin()];
+}
+
+size_t FitEngine::lineHeight(FontServer &fs, Style const &style)
+{
+	auto const v{fs.fontVerticals()};
+	return static_cast<size_t>(style.topMargin + v.maxRise - v.maxDrop);
+}
+
+/// @brief Binary searches the candidates for the largest font the text fits in. Assumes a
+/// larger font never needs fewer lines, which holds for the candidates
+Fit FitEngine::search(Limits const &room, std::string_view text, TextSpan highlight, bool withBold)
+{
+	Fit best{Candidates.front(), 0, false, true};
+	auto const &lines{withBold ? room.bold : room.plain};
+	size_t lo{0};
+	size_t hi{Candidates.size()};
+	while (lo < hi)
+	{
+		size_t const mid{(lo + hi) / 2};
+		size_t const count{linesFor(fonts.fontFor(Candidates[mid]), text, lines[mid], highlight)};
+		if (count <= lines[mid])
+		{
+			best = Fit{Candidates[mid], static_cast<uint8_t>(count), true, true};
+			lo = mid + 1;
+		}
+		else
+		{
+			hi = mid;
+		}
+	}
+	return best;
+}
+
+/// @brief Counts the lines FontServer::wrap would produce but gives up once there are more
+/// than limit. A word wider than the panel can't be laid out so it counts as too many
+size_t FitEngine::linesFor(FontServer &fs, std::string_view s, size_t limit, TextSpan highlight)
+{
+	size_t lines{0};
+	bool bold{false};
+	size_t start{FontServer::skipWhitespace(s, 0)};
+	while (start < s.size())
+	{
+		size_t const end{fs.lineEnd(s, start, width, bold, highlight)};
+		if (end == start || ++lines > limit)
+		{
+			return limit + 1;
+		}
+		start = FontServer::skipWhitespace(s, end);
+	}
+	return lines;
+}
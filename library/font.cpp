@@ -1,4 +1,5 @@
 #include <climits>
+#include <iomanip>
 #include "font.h"
 
 using std::string;
@@ -43,6 +44,7 @@ Font::Font() : glyphs{}
 	dWidthMax = INT_MIN;
 	dWidthMin = INT_MAX;
 	vExtentMax = INT_MIN;
+	columnMajor_ = false;
 }
 
 void Font::LoadFont(std::vector<string> tokens)
@@ -188,7 +190,7 @@ const string Font::BitmapDef() const
 	int cursorPos{0};
 
 	stringstream ss;
-	ss << "\nconstexpr uint8_t " << tag_.c_str() << "Bitmaps[] {\n";
+	ss << "\ninline constexpr uint8_t " << tag_.c_str() << "Bitmaps[] {\n";
 
 	for (auto const &glyph : glyphs)
 	{
@@ -212,6 +214,64 @@ const string Font::BitmapDef() const
 	return ss.str().c_str();
 }
 
+const string Font::ColumnDef() const
+{
+	int maxLineLength{50};
+	int cursorPos{0};
+
+	stringstream ss;
+	ss << "\ninline constexpr uint8_t " << tag_.c_str() << "Columns[] {\n";
+	for (auto const &glyph : glyphs)
+	{
+		for (auto const b : glyph.ToColumnBytes())
+		{
+			ss << "0x" << std::hex << std::uppercase << std::setw(2) << std::setfill('0')
+			   << static_cast<int>(b) << std::dec << ", ";
+			cursorPos += 6;
+			if (cursorPos >= maxLineLength)
+			{
+				ss << "\n";
+				cursorPos = 0;
+			}
+		}
+	}
+	ss << "};\n\n";
+
+	ss << "\ninline constexpr uint16_t " << tag_.c_str() << "ColumnIndex[] {\n";
+	unsigned int index{0};
+	cursorPos = 0;
+	for (auto const &glyph : glyphs)
+	{
+		ss << index << ", ";
+		index += RoundToByte(glyph.bbh) * glyph.bbw;
+		if (++cursorPos == 16)
+		{
+			ss << "\n";
+			cursorPos = 0;
+		}
+	}
+	ss << "};\n\n";
+	return ss.str().c_str();
+}
+
+const string Font::WidthDef() const
+{
+	stringstream ss;
+	ss << "\ninline constexpr uint8_t " << tag_.c_str() << "Widths[] {\n";
+	int cursorPos{0};
+	for (auto const &glyph : glyphs)
+	{
+		ss << glyph.dWidth << ", ";
+		if (++cursorPos == 16)
+		{
+			ss << "\n";
+			cursorPos = 0;
+		}
+	}
+	ss << "};\n\n";
+	return ss.str().c_str();
+}
+
 string Font::GlyphComment()
 {
 	stringstream ss;
@@ -229,7 +289,7 @@ string Font::GlyphComment()
 const string Font::GlyphSpecDef() const
 {
 	stringstream ss;
-	ss << "\n constexpr BdfGlyph " << tag_.c_str() << "Glyphs[] {\n";
+	ss << "\n inline constexpr BdfGlyph " << tag_.c_str() << "Glyphs[] {\n";
 
 	unsigned int index{0};
 	for (auto const &glyph : glyphs)
@@ -285,6 +345,16 @@ string Font::FontDeclaration()
 	   << "\n\tuint8_t AsciiStop;"
 	   << "\n\t/// The minimum number of vertical pixels needed (with zero vertical margin)"
 	   << "\n\tuint8_t VerticalStep;"
+	   << "\n\t/// Start address of the column-major bitmap data (nullptr if not generated)"
+	   << "\n\tconst uint8_t* Columns{nullptr};"
+	   << "\n\t/// Start address of the column-major offsets, one per glyph"
+	   << "\n\tconst uint16_t* ColumnIndex{nullptr};"
+	   << "\n\t/// The highest any glyph rises above the baseline (zero if not generated)"
+	   << "\n\tint8_t MaxRise{0};"
+	   << "\n\t/// The lowest any glyph drops below the baseline (zero or negative)"
+	   << "\n\tint8_t MaxDrop{0};"
+	   << "\n\t/// Start address of the advance widths, one per encoding from AsciiStart (nullptr if not generated)"
+	   << "\n\tconst uint8_t* Widths{nullptr};"
 	   << "\n};\n";
 	return ss.str().c_str();
 }
@@ -311,7 +381,7 @@ const string Font::FontDefinitionBlock() const
 const string Font::FontDefinition() const
 {
 	stringstream ss;
-	ss << "\n\nconst BdfFont "
+	ss << "\n\ninline const BdfFont "
 	   << tag_.c_str() << " \n{\n"
 	   << "\t///Start address for bitmaps\n"
 	   << "\t" << tag_.c_str() << "Bitmaps,\n"
@@ -322,7 +392,29 @@ const string Font::FontDefinition() const
 	   << "\t///Highest ASCII encoding\n"
 	   << "\t" << glyphs.at(glyphs.size() - 1).encoding << ",\n"
 	   << "\t/// Vertical step\n"
-	   << "\t" << vStep
+	   << "\t" << vStep;
+	if (columnMajor_)
+	{
+		ss << ",\n"
+		   << "\t/// Start address for column-major bitmaps\n"
+		   << "\t" << tag_.c_str() << "Columns,\n"
+		   << "\t/// Start address for column-major glyph offsets\n"
+		   << "\t" << tag_.c_str() << "ColumnIndex";
+	}
+	else
+	{
+		ss << ",\n"
+		   << "\t/// No column-major bitmaps\n"
+		   << "\tnullptr,\n"
+		   << "\tnullptr";
+	}
+	ss << ",\n"
+	   << "\t/// Max rise above the baseline\n"
+	   << "\t" << vExtentMax << ",\n"
+	   << "\t/// Max drop below the baseline (zero or negative)\n"
+	   << "\t" << bbyMin << ",\n"
+	   << "\t/// Start address for the advance widths\n"
+	   << "\t" << tag_.c_str() << "Widths"
 	   << "\n};\n\n";
 	return ss.str().c_str();
 }
@@ -390,6 +482,8 @@ const string Font::ToIncludeFile() const
 		<< FontSummary()
 		<< GlyphSpecDef()
 		<< BitmapDef()
+		<< (columnMajor_ ? ColumnDef() : "")
+		<< WidthDef()
 		<< FontDefinitionBlock()
 		<< "\n";
 	return ss.str();
@@ -414,3 +508,8 @@ const int Font::GlyphCount() const
 {
 	return glyphs.size();
 }
+
+void Font::ColumnMajor(bool columns)
+{
+	columnMajor_ = columns;
+}
@@ -0,0 +1,47 @@
+#include <cassert>
+#include "fontRegistry.h"
+#include "font112.h"
+#include "sans22.h"
+#include "sans24.h"
+#include "Sans18.h"
+#include "Sans20.h"
+#include "Nimbus.h"
+
+FontRegistry::FontRegistry() : registered{}
+{
+	auto add{[this](FontId id, BdfFont const &font)
+			 {
+				 servers[static_cast<size_t>(id)] = FontServer(font);
+				 registered[static_cast<size_t>(id)] = true;
+			 }};
+	add(FontId::sans22, Sans22);
+	add(FontId::sans24, Sans24);
+	add(FontId::font112, font112);
+	add(FontId::sans18, Sans18);
+	add(FontId::sans20, Sans20);
+	add(FontId::nimbus28, Nimbus28);
+
+	// There are no bold cuts so bold is the next size up in the same family, as the style
+	// sheets pair Sans22 with Sans24. The largest of each family sets bold runs in itself
+	auto embolden{[this](FontId id, FontId bold)
+				  { fontFor(id).setBold(&fontFor(bold)); }};
+	embolden(FontId::sans18, FontId::sans20);
+	embolden(FontId::sans20, FontId::sans22);
+	embolden(FontId::sans22, FontId::sans24);
+}
+
+FontServer &FontRegistry::fontFor(FontId id)
+{
+	assert(has(static_cast<uint8_t>(id)));
+	return servers[static_cast<size_t>(id)];
+}
+
+FontServer &FontRegistry::fontFor(uint8_t id, FontId fallback)
+{
+	return has(id) ? servers[id] : fontFor(fallback);
+}
+
+bool FontRegistry::has(uint8_t id) const
+{
+	return id < Slots && registered[id];
+}
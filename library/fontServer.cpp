@@ -1,3 +1,4 @@
+#include <algorithm>
 #include "fontServer.h"
 
 #pragma region public
@@ -22,11 +23,24 @@ FontServer::FontServer(BdfFont aFont) : font{aFont}
 {
 }
 
+/// @brief Pairs this font with the one its bold runs are set in. FontRegistry does this for
+/// every font it holds so a quote's bold face follows whatever size it was fitted to
+/// @param boldFace - The bold font, or nullptr to set bold runs in this font
+void FontServer::setBold(FontServer *boldFace)
+{
+	boldServer = boldFace;
+}
+
 /// <summary>Sets the vertical extents needed for layout from the passed font</summary>
 /// <param name= font>The font to examine </param>
 /// <returns>Verticals A completed struct with the rise, drop and vertical step values</returns>
 Verticals FontServer::fontVerticals()
 {
+	// fontGenerator stores the extents in the font so there's nothing to scan
+	if (font.MaxRise > 0)
+	{
+		return Verticals{font.MaxRise, font.MaxDrop, static_cast<int8_t>(font.VerticalStep)};
+	}
 	// Get the extent of the font
 	uint16_t glyphCount = font.AsciiStop - font.AsciiStart;
 	Verticals v;
@@ -47,9 +61,31 @@ Verticals FontServer::fontVerticals()
 	return v;
 }
 
+/// <summary>The line metrics for text that may switch to the bold face part way through a
+/// line. FitEngine and LayoutServer both step lines by these so the precomputed fit holds</summary>
+/// <param name= withBold>False if nothing in the text is set in the bold face</param>
+/// <returns>Verticals The larger rise, drop and step of this font and its bold face</returns>
+Verticals FontServer::lineVerticals(bool const withBold)
+{
+	auto v{fontVerticals()};
+	if (!withBold || boldServer == nullptr)
+	{
+		return v;
+	}
+	auto const b{boldServer->fontVerticals()};
+	v.maxRise = std::max(v.maxRise, b.maxRise);
+	v.maxDrop = std::min(v.maxDrop, b.maxDrop);
+	v.verticalStep = std::max(v.verticalStep, b.verticalStep);
+	return v;
+}
+
 size_t FontServer::widthOf(char const c)
 {
 	char chr{hasChar(c) ? c : ERROR_CHAR};
+	if (font.Widths != nullptr)
+	{
+		return font.Widths[chr - font.AsciiStart];
+	}
 	return font.Glyphs[GlyphIndex(chr)].DWidth;
 }
 
@@ -72,6 +108,31 @@ BdfGlyph FontServer::glyphFor(char const c)
 	return GetGlyph(GlyphIndex(chr));
 }
 
+/// @brief Returns a view of the bitmap for the passed character without copying it out
+/// of the font data. Nothing is allocated so this is safe to call per character per minute
+/// @param c - The character we want the bitmap for
+/// @return - The glyph spec, the packed rows and the row stride for c (or for "#" if c is not found)
+/// plus the packed columns and column stride if the font carries column-major data
+GlyphBits FontServer::bitmapFor(char const c)
+{
+	auto g{glyphFor(c)};
+	uint8_t stride{RoundToByte(g.bbw)};
+	size_t lengthInBytes{stride * static_cast<size_t>(g.bbh)};
+	if (font.Bitmaps == nullptr)
+	{
+		return GlyphBits{g, std::span<const uint8_t>{}, stride};
+	}
+	GlyphBits bits{g, std::span<const uint8_t>{font.Bitmaps + g.Index, lengthInBytes}, stride};
+	if (font.Columns != nullptr && font.ColumnIndex != nullptr)
+	{
+		char chr{hasChar(c) ? c : ERROR_CHAR};
+		bits.ColumnStride = RoundToByte(g.bbh);
+		bits.Columns = std::span<const uint8_t>{font.Columns + font.ColumnIndex[GlyphIndex(chr)],
+												bits.ColumnStride * static_cast<size_t>(g.bbw)};
+	}
+	return bits;
+}
+
 // Returns a vector<bool> containing the bits comprising the character c
 std::vector<bool> FontServer::bitsFor(char const c)
 {
@@ -85,6 +146,63 @@ std::vector<bool> FontServer::bitsFor(char const c)
 	return Vectorize(start, lengthInBytes);
 }
 
+/// @brief Finds the end of a line of word wrapped text. The line ends at a line break, or at
+/// the last delimiter before the text gets wider than width, or at the end of the text.
+/// Bold markup switches the font each run is measured in and takes no room itself. The
+/// highlight is always measured in the bold face so the time marker wraps as it is drawn
+/// @param s - The text being wrapped
+/// @param pos - The start of the line
+/// @param width - The maximum width of the line in pixels
+/// @param bold - The markup state at pos, updated to the state at the end of the line
+/// @param highlight - The characters to measure in the bold face (empty for none)
+/// @return - The position one past the last character of the line
+size_t FontServer::lineEnd(std::string_view s, size_t pos, size_t width, bool &bold, TextSpan highlight)
+{
+	size_t last{pos};
+	bool lastBold{bold};
+	size_t w{0};
+
+	while (pos < s.size())
+	{
+		if (w > width)
+		{
+			bold = lastBold;
+			return last;
+		}
+		char const c{s[pos]};
+		if (c == CR || c == LF)
+		{
+			return pos;
+		}
+		if (c == SPACE || c == EOT)
+		{
+			last = pos;
+			lastBold = bold;
+		}
+		if (isMarkup(c))
+		{
+			bold = c == boldOn;
+		}
+		else
+		{
+			w += face(bold || highlight.contains(pos)).widthOf(c);
+		}
+		pos++;
+	}
+	if (w > width)
+	{
+		bold = lastBold;
+		return last;
+	}
+	return s.size();
+}
+
+size_t FontServer::skipWhitespace(std::string_view s, size_t start)
+{
+	auto pos{s.find_first_not_of(WHITESPACE, start)};
+	return (pos == std::string_view::npos) ? s.size() : pos;
+}
+
 #pragma endregion
 
 #pragma region private
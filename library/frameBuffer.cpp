@@ -1,3 +1,4 @@
+#include <bit>
 #include "frameBuffer.h"
 
 FrameBuffer::FrameBuffer() : data{},
@@ -22,6 +23,12 @@ void FrameBuffer::clear()
 
 void FrameBuffer::line(Point const p1, Point const p2)
 {
+    // Axis aligned lines (e.g. the border) are just a span or a one pixel wide rect
+    if (p1.yVal() == p2.yVal() || p1.xVal() == p2.xVal())
+    {
+        fill(Rect(p1, p2));
+        return;
+    }
     Gradient g(p1, p2);
     set(p1);
     for (auto index{0}; index < g.steps(); index++)
@@ -58,6 +65,253 @@ void FrameBuffer::border()
     line(origin, bottomLeft);
 }
 
+/**
+ * @brief ORs a row-major, MSB first, 1-bpp bitmap (e.g. a glyph) into the buffer with its top
+ * left corner at (x,y). Each source row sets the same bit in a run of column bytes so we
+ * work out the mask and byte offset once per row and skip empty source bytes. Pixels that
+ * fall outside the buffer are clipped rather than clamped. Nothing is allocated.
+ *
+ * @param x - the horizontal position of the left edge of the bitmap (may be negative)
+ * @param y - the vertical position of the top edge of the bitmap (may be negative)
+ * @param bitmap - the packed rows (at least stride * height bytes)
+ * @param width - the width of the bitmap in pixels
+ * @param height - the number of rows in the bitmap
+ * @param stride - the number of bytes in each row
+ */
+void FrameBuffer::blit(int x, int y, std::span<const uint8_t> bitmap, uint_t width, uint_t height, uint_t stride)
+{
+    if (bitmap.size() < static_cast<size_t>(stride) * height)
+    {
+        return;
+    }
+    constexpr int columnBytes{HEIGHT / 8};
+    for (uint_t row{0}; row < height; row++)
+    {
+        int const py{y + row};
+        if (py < 0 || py > MAX_Y_BITS)
+        {
+            continue;
+        }
+        uint8_t const mask{static_cast<uint8_t>(0b10000000 >> (py & 0b111))};
+        uint8_t *const rowBase{data + (py >> 3)};
+        uint8_t const *const src{bitmap.data() + row * stride};
+        for (uint_t byte{0}; byte < stride; byte++)
+        {
+            uint8_t bits{src[byte]};
+            int px{x + static_cast<int>(byte * 8)};
+            for (; bits != 0; bits <<= 1, px++)
+            {
+                if ((bits & 0b10000000) && px >= 0 && px <= MAX_X && (px - x) < width)
+                {
+                    rowBase[px * columnBytes] |= mask;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief ORs a column-major bitmap (FontServer::bitmapFor(c).Columns) into the buffer with its
+ * top left corner at (x,y). The source columns are already packed the same way as the buffer
+ * so each source byte lands in at most two buffer bytes: shifted right by the bit offset of y
+ * into one and left into the next. Bytes that fall outside the buffer are clipped.
+ *
+ * @param x - the horizontal position of the left edge of the bitmap (may be negative)
+ * @param y - the vertical position of the top edge of the bitmap (may be negative)
+ * @param columns - the packed columns (at least columnStride * width bytes)
+ * @param width - the width of the bitmap in pixels (the number of columns)
+ * @param height - the height of the bitmap in pixels (bits beyond this must be zero)
+ * @param columnStride - the number of bytes in each column, (height + 7) / 8
+ */
+void FrameBuffer::blitColumns(int x, int y, std::span<const uint8_t> columns, uint_t width, uint_t height, uint_t columnStride)
+{
+    if (columns.size() < static_cast<size_t>(columnStride) * width || columnStride * 8 < height)
+    {
+        return;
+    }
+    constexpr int columnBytes{HEIGHT / 8};
+    int const firstByte{y >> 3};
+    int const shift{y & 0b111};
+    int const first{std::max(0, -x)};
+    int const last{std::min(static_cast<int>(width), static_cast<int>(MAX_X) + 1 - x)};
+    for (int col{first}; col < last; col++)
+    {
+        uint8_t *const column{data + (x + col) * columnBytes};
+        uint8_t const *const src{columns.data() + col * columnStride};
+        for (int b{0}; b < static_cast<int>(columnStride); b++)
+        {
+            uint8_t const bits{src[b]};
+            if (bits == 0)
+            {
+                continue;
+            }
+            int const dest{firstByte + b};
+            if (dest >= 0 && dest < columnBytes)
+            {
+                column[dest] |= bits >> shift;
+            }
+            if (shift != 0 && dest + 1 >= 0 && dest + 1 < columnBytes)
+            {
+                column[dest + 1] |= static_cast<uint8_t>(bits << (8 - shift));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Sets a horizontal run of pixels. In the column-major buffer that's the same bit in
+ * consecutive columns so we step through the buffer HEIGHT/8 bytes at a time
+ *
+ * @param x - the left end of the run (may be negative)
+ * @param y - the row
+ * @param length - the number of pixels in the run
+ */
+void FrameBuffer::span(int x, int y, int length)
+{
+    if (y < 0 || y > MAX_Y_BITS || length <= 0)
+    {
+        return;
+    }
+    int const first{std::max(x, 0)};
+    int const last{std::min(x + length - 1, static_cast<int>(MAX_X))};
+    uint8_t const mask{static_cast<uint8_t>(0b10000000 >> (y & 0b111))};
+    for (int px{first}; px <= last; px++)
+    {
+        data[px * (HEIGHT / 8) + (y >> 3)] |= mask;
+    }
+}
+
+/**
+ * @brief Sets every pixel in the rectangle. Each column of the rect is a run of whole bytes
+ * with (possibly) partial bytes at either end
+ */
+void FrameBuffer::fill(Rect const &r)
+{
+    uint_t firstByte, lastByte;
+    uint8_t firstMask, lastMask;
+    columnMasks(r, firstByte, lastByte, firstMask, lastMask);
+    for (uint_t x{r.left()}; x <= r.right(); x++)
+    {
+        uint8_t *column{data + x * (HEIGHT / 8)};
+        column[firstByte] |= firstMask;
+        for (uint_t b = firstByte + 1; b < lastByte; b++)
+        {
+            column[b] = 0xFF;
+        }
+        column[lastByte] |= lastMask;
+    }
+}
+
+/**
+ * @brief Clears every pixel in the rectangle
+ */
+void FrameBuffer::erase(Rect const &r)
+{
+    uint_t firstByte, lastByte;
+    uint8_t firstMask, lastMask;
+    columnMasks(r, firstByte, lastByte, firstMask, lastMask);
+    for (uint_t x{r.left()}; x <= r.right(); x++)
+    {
+        uint8_t *column{data + x * (HEIGHT / 8)};
+        column[firstByte] &= ~firstMask;
+        for (uint_t b = firstByte + 1; b < lastByte; b++)
+        {
+            column[b] = 0;
+        }
+        column[lastByte] &= ~lastMask;
+    }
+}
+
+/**
+ * @brief Replaces the buffer with a complete frame in the same layout
+ */
+void FrameBuffer::copy(std::span<const uint8_t, FRAMEBUFFERSIZE> frame)
+{
+    memcpy(data, frame.data(), FRAMEBUFFERSIZE);
+}
+
+/**
+ * @brief Finds the bounding box of every pixel that differs from a previous frame (e.g. the
+ * one the panel is showing). Whole columns are compared first to find the first and last
+ * columns that changed, then the bytes of those columns are XORed together to find the rows.
+ * The box is widened to whole bytes vertically because that's what the panel is sent
+ *
+ * @param previous - the earlier frame in the same layout
+ * @return - first is false if nothing changed, otherwise second is the changed region
+ */
+std::pair<bool, Rect> FrameBuffer::changedFrom(std::span<const uint8_t, FRAMEBUFFERSIZE> previous) const
+{
+    constexpr uint_t columnBytes{HEIGHT / 8};
+    auto const columnChanged{[&](uint_t x)
+                             { return memcmp(data + x * columnBytes, previous.data() + x * columnBytes, columnBytes) != 0; }};
+    uint_t first{0};
+    while (first < WIDTH && !columnChanged(first))
+    {
+        first++;
+    }
+    if (first == WIDTH)
+    {
+        return {false, Rect()};
+    }
+    uint_t last{MAX_X};
+    while (!columnChanged(last))
+    {
+        last--;
+    }
+    uint8_t rows[columnBytes]{};
+    for (uint_t x{first}; x <= last; x++)
+    {
+        for (uint_t b{0}; b < columnBytes; b++)
+        {
+            rows[b] |= data[x * columnBytes + b] ^ previous[x * columnBytes + b];
+        }
+    }
+    uint_t top{0};
+    while (rows[top] == 0)
+    {
+        top++;
+    }
+    uint_t bottom{columnBytes - 1};
+    while (rows[bottom] == 0)
+    {
+        bottom--;
+    }
+    return {true, Rect(Point(first, top * 8), Point(last, bottom * 8 + 7))};
+}
+
+/**
+ * @brief Counts the pixels that differ from a previous frame, set or cleared
+ *
+ * @param previous - the earlier frame in the same layout
+ */
+size_t FrameBuffer::differingPixels(std::span<const uint8_t, FRAMEBUFFERSIZE> previous) const
+{
+    size_t count{0};
+    for (size_t i{0}; i < FRAMEBUFFERSIZE; i++)
+    {
+        count += std::popcount(static_cast<uint8_t>(data[i] ^ previous[i]));
+    }
+    return count;
+}
+
+/**
+ * @brief Works out the range of bytes in a column covered by the rows of r and the masks
+ * for the partial bytes at each end. If the rect starts and ends in the same byte then both
+ * masks are the same
+ */
+void FrameBuffer::columnMasks(Rect const &r, uint_t &firstByte, uint_t &lastByte, uint8_t &firstMask, uint8_t &lastMask)
+{
+    firstByte = r.top() >> 3;
+    lastByte = r.bottom() >> 3;
+    firstMask = 0xFF >> (r.top() & 0b111);
+    lastMask = static_cast<uint8_t>(0xFF << (7 - (r.bottom() & 0b111)));
+    if (firstByte == lastByte)
+    {
+        firstMask &= lastMask;
+        lastMask = firstMask;
+    }
+}
+
 void FrameBuffer::testPattern()
 {
     line(bottomRight, origin);
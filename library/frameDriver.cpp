@@ -0,0 +1,50 @@
+#include "frameDriver.h"
+
+void frameDriver::clear()
+{
+    buffer.clear();
+}
+
+void frameDriver::set(int x, int y)
+{
+    if (x < 0 || x > MAX_X || y < 0 || y > MAX_Y_BITS)
+    {
+        return;
+    }
+    buffer.set(Point(x, y));
+}
+
+void frameDriver::update()
+{
+    updates++;
+}
+
+void frameDriver::blit(int x, int y, std::span<const uint8_t> bitmap, uint_t width, uint_t height, uint_t stride)
+{
+    buffer.blit(x, y, bitmap, width, height, stride);
+}
+
+void frameDriver::blitColumns(int x, int y, std::span<const uint8_t> columns, uint_t width, uint_t height, uint_t columnStride)
+{
+    buffer.blitColumns(x, y, columns, width, height, columnStride);
+}
+
+void frameDriver::span(int x, int y, int length)
+{
+    buffer.span(x, y, length);
+}
+
+void frameDriver::fill(Rect const &r)
+{
+    buffer.fill(r);
+}
+
+void frameDriver::erase(Rect const &r)
+{
+    buffer.erase(r);
+}
+
+void frameDriver::copy(std::span<const uint8_t, FRAMEBUFFERSIZE> frame)
+{
+    buffer.copy(frame);
+}
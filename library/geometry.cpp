@@ -13,6 +13,12 @@ std::ostream &operator<<(std::ostream &os, const Pixel &pixel)
     return os;
 }
 
+std::ostream &operator<<(std::ostream &os, const Rect &rect)
+{
+    os << '[' << Point(rect.left(), rect.top()) << ',' << Point(rect.right(), rect.bottom()) << ']';
+    return os;
+}
+
 std::ostream &operator<<(std::ostream &os, Gradient &g)
 {
     os << " steps = " << g.steps();
@@ -148,3 +154,24 @@ Point Gradient::next()
     return Point(x >> shift, y >> shift);
 }
 
+#pragma region Rect
+
+Rect::Rect() : tl{}, br{}
+{
+}
+
+/**
+ * @brief Construct a new Rect from two corners. The corners are re-ordered if necessary so that
+ * tl is always above and to the left of br
+ */
+Rect::Rect(Point const a, Point const b) : tl{std::min(a.xVal(), b.xVal()), std::min(a.yVal(), b.yVal())},
+                                           br{std::max(a.xVal(), b.xVal()), std::max(a.yVal(), b.yVal())}
+{
+}
+
+bool Rect::operator==(const Rect &rhs) const
+{
+    return (tl == rhs.tl) && (br == rhs.br);
+}
+
+#pragma end region
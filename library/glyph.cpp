@@ -98,3 +98,28 @@ std::string Glyph::ToDescription() const
 		<< "\n";
 	return tss.str().c_str();
 }
+
+std::vector<uint8_t> Glyph::ToColumnBytes() const
+{
+	size_t const columnBytes{static_cast<size_t>((bbh + 7) / 8)};
+	std::vector<uint8_t> result(columnBytes * bbw, 0);
+	for (int row{0}; row < static_cast<int>(ScanLines.size()) && row < bbh; row++)
+	{
+		auto const &line{ScanLines.at(row)};
+		for (int col{0}; col < bbw; col++)
+		{
+			// Each scan line is hex, two characters per byte, MSB first
+			size_t const nibble{static_cast<size_t>(col / 4)};
+			if (nibble >= line.length())
+			{
+				break;
+			}
+			int const value{std::stoi(line.substr(nibble, 1), nullptr, 16)};
+			if (value & (0b1000 >> (col % 4)))
+			{
+				result.at(col * columnBytes + row / 8) |= 0b10000000 >> (row % 8);
+			}
+		}
+	}
+	return result;
+}
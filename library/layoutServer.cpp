@@ -4,18 +4,32 @@
 #include "displayDriver.h"
 #include "debug.h"
 
-LayoutServer::LayoutServer(std::unique_ptr<displayDriver> hardwareDriver) : qs{QuoteServer(AssetStack(timeText, timeAssets, 3108, 671829))},
-                                                                            fs{},
+LayoutServer::LayoutServer(std::unique_ptr<displayDriver> hardwareDriver) : qs{QuoteServer(timeStack)},
+                                                                            fonts{},
+                                                                            fitter{fonts, quoteStyle, WIDTH, HEIGHT,
+                                                                                   FitEngine::lineHeight(fonts.fontFor(footerStyle.fontId), footerStyle)},
+                                                                            fs{&fonts.fontFor(quoteStyle.fontId)},
                                                                             driver{std::move(hardwareDriver)}
 {
+    qs.rotateBy(Rotation::dayShuffle);
     dbg("Layout server instantiated" << std::endl);
 }
 
 void LayoutServer::timeIs(datetime_t t)
+{
+    render(t);
+    show();
+}
+
+/**
+ * @brief Draws the frame for t without showing it, so the caller can choose when the panel
+ * starts to refresh (see MinuteScheduler)
+ */
+void LayoutServer::render(datetime_t t)
 {
     dbg("Time is " << (int)t.hour << ":" << (int)t.min << std::endl);
     driver->clear();
-    auto [quoteFound, quote]{qs.quoteFor(t)};
+    auto [quoteFound, quote]{qs.quoteAt(t)};
     if (quoteFound)
     {
         layoutQuote(quote);
@@ -24,6 +38,10 @@ void LayoutServer::timeIs(datetime_t t)
     {
         layoutClockFace(TopCat::toClockTime(t));
     }
+}
+
+void LayoutServer::show()
+{
     driver->update();
 }
 
@@ -32,13 +50,16 @@ void LayoutServer::cmd(Button const b)
     dbg("\n\rGot button " << static_cast<int>(b) << std::endl);
 }
 
-void LayoutServer::layoutQuote(std::string_view q)
+void LayoutServer::layoutQuote(Quote const &q)
 {
     int rowMargin = quoteStyle.rowMargin;
-    // This is where we set the font for this layout
-    // TODO - Add a second font for the timestring (e.g. Bold)
-    fs = FontServer(quoteStyle.font);
-    auto verts{fs.fontVerticals()};
+    // textGenerator records the font it fitted the quote to. Use it if we carry it,
+    // otherwise fit the quote now and wrap at runtime. Either way the time marker is set
+    // in the bold face of that font
+    FontId const fontId{fonts.has(q.FontId) ? static_cast<FontId>(q.FontId) : fitter.fit(q.Text, q.Marker, q.Bold).Font};
+    fs = &fonts.fontFor(fontId);
+    // lines with bold runs are stepped by the taller of the font and its bold face, as FitEngine counted them
+    auto verts{fs->lineVerticals(q.Bold)};
     int vStep{rowMargin + verts.verticalStep};
 
     // home isn't used yet but we may add border gap etc from style sheet later
@@ -51,121 +72,183 @@ void LayoutServer::layoutQuote(std::string_view q)
     int maxLine = WIDTH;
     // End of page setup
 
-    std::vector<std::string_view> lines{wordWrap(q, maxLine)};
-    for (auto const &line : lines)
+    // textGenerator wrapped the quote with the same algorithm and font so use its line breaks.
+    // Bold markup can run over a line break so the state is carried from line to line
+    bool bold{false};
+    size_t lines{0};
+    if (!q.Breaks.empty() && q.FontId == static_cast<uint8_t>(fontId))
     {
-        renderLine(line, originX, originY);
-        originY = originY + vStep;
+        size_t lineEnd{0};
+        for (auto const nextEnd : q.Breaks)
+        {
+            size_t lineStart{FontServer::skipWhitespace(q.Text, lineEnd)};
+            lineEnd = nextEnd;
+            if (lineStart < lineEnd)
+            {
+                bold = renderLine(q.Text.substr(lineStart, lineEnd - lineStart), originX, originY, bold, q.Marker.from(lineStart));
+            }
+            originY = originY + vStep;
+        }
+        lines = q.Breaks.size();
+    }
+    else
+    {
+        // Otherwise each line is drawn as soon as it is found so nothing is collected
+        fs->wrap(
+            q.Text, maxLine, [&](size_t lineStart, size_t lineEnd)
+            {
+                bold = renderLine(q.Text.substr(lineStart, lineEnd - lineStart), originX, originY, bold, q.Marker.from(lineStart));
+                originY = originY + vStep;
+                lines++; },
+            q.Marker);
+    }
+
+    // A quote that only fits by running into the footer's room is drawn without credits
+    if (lines <= fitter.maxLines(fontId, q.Bold))
+    {
+        renderFooter(q);
     }
 }
 
 void LayoutServer::layoutClockFace(std::string timeString)
 {
-    fs = FontServer(clockStyle.font);
-    auto verts{fs.fontVerticals()};
+    fs = &fonts.fontFor(clockStyle.fontId);
+    auto verts{fs->fontVerticals()};
     int originY = clockStyle.homeY + clockStyle.originY + verts.maxRise;
 
     int originX = clockStyle.homeX + clockStyle.originX;
-    renderLine(timeString, originX, originY);
+    renderLine(timeString, originX, originY, false);
 }
 
-size_t LayoutServer::setFirstCharOrigin(size_t home, char c)
+/// @brief Render the passed line by passing each char to the renderChar function. The bold
+/// on "<" and bold off ">" markup switches between the font and its bold face and is not drawn.
+/// The highlight (the time marker) is drawn in the bold face too - or underlined in a font with
+/// no bold face, where it would otherwise look like the rest of the quote
+/// @param line - The text of the line
+/// @param originX - The left edge of the line
+/// @param originY - The baseline of the line
+/// @param bold - The markup state at the start of the line
+/// @param highlight - The characters of the line to set in the bold face, counted from its start
+/// @return - The markup state at the end of the line
+bool LayoutServer::renderLine(std::string_view line, int originX, int originY, bool bold, TextSpan highlight)
 {
-    int firstCharOffset{fs.glyphFor(c).bbx};
-    if (firstCharOffset < 0)
-    {
-        return home - firstCharOffset; // e.g. if offset is -2 return home + 2
-    }
-    return home;
-}
-
-/// @brief  Render the passed line by passing each char to the renderChar function.
-/// @todo Detect the Bold on "<" and Bold off ">" chars and switch fontserver accordingly.
-/// @param line 
-/// @param originX 
-/// @param originY 
-void LayoutServer::renderLine(std::string_view line, int originX, int originY)
-{
-    originX = setFirstCharOrigin(originX, line.at(0));
+    bool first{true};
     int startX{0};
     int startY{0};
-    for (auto const c : line)
+    int underlineFrom{0};
+    int underlineTo{0};
+    for (size_t i{0}; i < line.size(); i++)
     {
-        auto glyph{fs.glyphFor(c)};
+        char const c{line[i]};
+        if (FontServer::isMarkup(c))
+        {
+            bold = c == boldOn;
+            continue;
+        }
+        auto bits{fs->face(bold || highlight.contains(i)).bitmapFor(c)};
+        auto const &glyph{bits.Glyph};
+        // Keep a first character that overhangs its origin (negative bbx) on the panel
+        if (first && glyph.bbx < 0)
+        {
+            originX = originX - glyph.bbx;
+        }
+        first = false;
         startX = originX + glyph.bbx;
         startY = originY - (glyph.bbh + glyph.bby);
-        renderChar(glyph, fs.bitsFor(c), startX, startY);
+        renderChar(bits, startX, startY);
+        if (highlight.contains(i))
+        {
+            underlineFrom = underlineTo == underlineFrom ? originX : underlineFrom;
+            underlineTo = originX + glyph.DWidth;
+        }
         originX = originX + glyph.DWidth;
     }
+    // two rows under the baseline, inside the descent every font has
+    if (!fs->hasBoldFace() && underlineTo > underlineFrom)
+    {
+        driver->span(underlineFrom, originY + 1, underlineTo - underlineFrom);
+        driver->span(underlineFrom, originY + 2, underlineTo - underlineFrom);
+    }
+    return bold;
 }
 
-void LayoutServer::renderChar(BdfGlyph g, std::vector<bool> v, uint_t x, uint_t y)
+/// @brief Credits the quote on one line along the bottom of the panel, in the room FitEngine
+/// keeps clear of the quote (when the quote fitted above it). A title too long to fit with the author is cut short with "..."
+/// @param q - The quote, drawn with no footer if it has neither a title nor an author
+void LayoutServer::renderFooter(Quote const &q)
 {
-    size_t widthInBytes = (g.bbw + 7) >> 3;
-    size_t widthInBits{widthInBytes * 8};
-    size_t totalBits{widthInBits * g.bbh};
-    if (totalBits != v.size())
+    if (q.Title.empty() && q.Author.empty())
     {
         return;
     }
-    uint_t col{x};
-    uint_t row{y};
-    for (auto b : v)
+    constexpr std::string_view separator{", "};
+    constexpr std::string_view ellipsis{"..."};
+    FontServer &footer{fonts.fontFor(footerStyle.fontId)};
+    auto const measure{[&](std::string_view s)
+                       {
+                           size_t w{0};
+                           for (auto const c : s)
+                           {
+                               w += footer.widthOf(c);
+                           }
+                           return w;
+                       }};
+    int x{footerStyle.homeX + footerStyle.leftMargin};
+    int const originY{HEIGHT + footer.fontVerticals().maxDrop};
+    auto const draw{[&](std::string_view s)
+                    {
+                        for (auto const c : s)
+                        {
+                            auto bits{footer.bitmapFor(c)};
+                            auto const &glyph{bits.Glyph};
+                            renderChar(bits, x + glyph.bbx, originY - (glyph.bbh + glyph.bby));
+                            x += glyph.DWidth;
+                        }
+                    }};
+
+    std::string_view const sep{(q.Title.empty() || q.Author.empty()) ? std::string_view{} : separator};
+    size_t const room{WIDTH - static_cast<size_t>(x)};
+    size_t const tail{measure(sep) + measure(q.Author)};
+    std::string_view title{q.Title};
+    bool const cut{measure(title) + tail > room};
+    if (cut)
     {
-        if (b)
-        {
-            driver->set(col, row);
-        }
-        col++;
-        if (col == x + widthInBits)
+        size_t w{measure(ellipsis) + tail};
+        size_t keep{0};
+        while (keep < title.size() && w + footer.widthOf(title[keep]) <= room)
         {
-            col = x;
-            row++;
+            w += footer.widthOf(title[keep]);
+            keep++;
         }
+        title = title.substr(0, keep);
     }
+    draw(title);
+    draw(cut ? ellipsis : std::string_view{});
+    draw(sep);
+    draw(q.Author);
 }
 
-size_t LayoutServer::skipWhitespace(std::string_view raw, size_t start)
+/// @brief Pushes a whole glyph to the driver in one call. The driver ORs the packed columns
+/// (or rows if the font has no column data) straight out of the font data into its own
+/// buffer so nothing is allocated
+/// @param bits - The view of the glyph bitmap from FontServer::bitmapFor
+/// @param x - The left edge of the glyph bounding box
+/// @param y - The top edge of the glyph bounding box
+void LayoutServer::renderChar(GlyphBits const &bits, int x, int y)
 {
-    auto pos{raw.find_first_not_of(WHITESPACE, start)};
-    return (pos == std::string_view::npos) ? raw.size() : pos;
+    auto const &g{bits.Glyph};
+    if (!bits.Columns.empty())
+    {
+        driver->blitColumns(x, y, bits.Columns, g.bbw, g.bbh, bits.ColumnStride);
+        return;
+    }
+    driver->blit(x, y, bits.Rows, g.bbw, g.bbh, bits.Stride);
 }
 
 std::vector<std::string_view> LayoutServer::wordWrap(std::string_view s, size_t len)
 {
     std::vector<std::string_view> result;
-    size_t lineStart{skipWhitespace(s, 0)};
-    size_t lineEnd{wrapper(s, lineStart, len)};
-    while (lineStart < s.size() && (lineStart != lineEnd))
-    {
-        result.push_back(s.substr(lineStart, lineEnd - lineStart));
-        lineStart = skipWhitespace(s, lineEnd);
-        lineEnd = wrapper(s, lineStart, len);
-    }
+    fs->wrap(s, len, [&](size_t lineStart, size_t lineEnd)
+            { result.push_back(s.substr(lineStart, lineEnd - lineStart)); });
     return result;
 }
-
-size_t LayoutServer::wrapper(std::string_view s, size_t pos, size_t len)
-{
-    size_t last{pos};
-    size_t w{0};
-
-    while (pos < s.size())
-    {
-        if (w > len)
-        {
-            return last;
-        }
-        if (qs.isLineBreak(s.at(pos)))
-        {
-            return pos;
-        }
-        if (qs.isDelimiter(s.at(pos)))
-        {
-            last = pos;
-        }
-        w += fs.widthOf(s.at(pos));
-        pos++;
-    }
-    return (w > len) ? last : s.size();
-}
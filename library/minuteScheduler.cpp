@@ -0,0 +1,74 @@
+#include <cstdlib>
+#include <iostream>
+#include "minuteScheduler.h"
+#include "topCat.h"
+#include "debug.h"
+
+MinuteScheduler::MinuteScheduler(uint8_t leadSeconds) : leadSeconds{leadSeconds}
+{
+}
+
+/**
+ * @brief The next RTC alarm - lead seconds before the first minute boundary that is still
+ * at least that far off. Only the time of day is set so it can be passed to rtc_set_alarm
+ *
+ * @param now - the RTC time
+ */
+datetime_t MinuteScheduler::nextAlarm(datetime_t const &now) const
+{
+    int const second{60 - leadSeconds};
+    int minute{now.hour * 60 + now.min + (now.sec < second ? 0 : 1)};
+    minute %= 24 * 60;
+    return {.year = -1,
+            .month = -1,
+            .day = -1,
+            .dotw = -1,
+            .hour = static_cast<int8_t>(minute / 60),
+            .min = static_cast<int8_t>(minute % 60),
+            .sec = static_cast<int8_t>(second)};
+}
+
+/**
+ * @brief The start of the minute after now - the one to draw when the alarm goes off.
+ * Midnight rolls the date over
+ */
+datetime_t MinuteScheduler::minuteAfter(datetime_t const &now)
+{
+    datetime_t next{now};
+    next.sec = 0;
+    if (++next.min < 60)
+    {
+        return next;
+    }
+    next.min = 0;
+    if (++next.hour < 24)
+    {
+        return next;
+    }
+    next = CivilTime::civilFromDays(CivilTime::daysFromCivil(next) + 1);
+    return next;
+}
+
+/**
+ * @brief How long to wait, once the frame is drawn, before starting the refresh
+ *
+ * @param msToBoundary - time left to the minute
+ * @param refreshMs - how long the driver expects the refresh to take
+ */
+uint32_t MinuteScheduler::startDelay(int64_t msToBoundary, uint32_t refreshMs) const
+{
+    auto const delay{msToBoundary - refreshMs - bias};
+    return delay > 0 ? static_cast<uint32_t>(delay) : 0;
+}
+
+/**
+ * @brief Records where a refresh ended relative to its minute (negative is early)
+ */
+void MinuteScheduler::shown(int32_t latencyMs)
+{
+    lastLatency = latencyMs;
+    worstLatency = std::abs(latencyMs) > std::abs(worstLatency) ? latencyMs : worstLatency;
+    bias += (latencyMs - bias) / 4;
+    count++;
+    dbg("Refreshed " << latencyMs << "ms from the minute (worst " << worstLatency << "ms over " << count << ")" << std::endl);
+}
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include "persistedTime.h"
+
+PersistedTime::PersistedTime(FlashSector &first, FlashSector &second) : sectors{&first, &second}
+{
+}
+
+/**
+ * @brief FNV-1a over the record up to its checksum
+ */
+uint32_t PersistedTime::checksum(Record const &record)
+{
+    uint8_t bytes[offsetof(Record, check)];
+    std::memcpy(bytes, &record, sizeof(bytes));
+    uint32_t hash{0x811c9dc5};
+    for (auto const b : bytes)
+    {
+        hash = (hash ^ b) * 0x01000193;
+    }
+    return hash;
+}
+
+/**
+ * @brief Finds the newest good record in the two sectors
+ */
+void PersistedTime::scan()
+{
+    scanned = true;
+    newest = slots;
+    for (size_t slot{0}; slot < slots; slot++)
+    {
+        Record record;
+        sectorOf(slot).read(offsetOf(slot), {reinterpret_cast<uint8_t *>(&record), sizeof(record)});
+        if (record.magic != recordMagic || record.check != checksum(record))
+        {
+            continue;
+        }
+        if (newest == slots || record.sequence > latest.sequence)
+        {
+            newest = slot;
+            latest = record;
+        }
+    }
+}
+
+/**
+ * @brief True if count pages from slot (in the same sector) are erased
+ */
+bool PersistedTime::blank(size_t slot, size_t count)
+{
+    std::array<uint8_t, FlashSector::pageSize> buffer;
+    for (size_t i{0}; i < count; i++)
+    {
+        sectorOf(slot + i).read(offsetOf(slot + i), buffer);
+        if (std::any_of(buffer.begin(), buffer.end(), [](uint8_t b)
+                        { return b != 0xFF; }))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief The last time saved
+ * @return first is false if nothing good has been saved
+ */
+std::pair<bool, datetime_t> PersistedTime::load()
+{
+    if (!scanned)
+    {
+        scan();
+    }
+    if (newest == slots)
+    {
+        return {false, {}};
+    }
+    return {true, latest.time};
+}
+
+/**
+ * @brief Saves dt in the page after the newest record. Past the end of a sector, or at a
+ * page that can't be programmed (a torn save), it moves on to the start of the other
+ * sector, erasing that first - it only holds older records
+ * @return false if it didn't read back
+ */
+bool PersistedTime::save(datetime_t const &dt)
+{
+    if (!scanned)
+    {
+        scan();
+    }
+    size_t slot{newest == slots ? 0 : (newest + 1) % slots};
+    Record record{recordMagic, newest == slots ? 1 : latest.sequence + 1, dt, 0};
+    record.check = checksum(record);
+
+    if (slot % pages != 0 && !blank(slot, 1))
+    {
+        slot = (slot / pages + 1) % 2 * pages;
+    }
+    if (slot % pages == 0 && !blank(slot, pages))
+    {
+        sectorOf(slot).erase();
+    }
+    std::array<uint8_t, FlashSector::pageSize> buffer;
+    buffer.fill(0xFF);
+    std::memcpy(buffer.data(), &record, sizeof(record));
+    sectorOf(slot).program(offsetOf(slot), buffer);
+
+    Record check;
+    sectorOf(slot).read(offsetOf(slot), {reinterpret_cast<uint8_t *>(&check), sizeof(check)});
+    if (std::memcmp(&check, &record, sizeof(record)) != 0)
+    {
+        scanned = false;
+        return false;
+    }
+    newest = slot;
+    latest = record;
+    return true;
+}
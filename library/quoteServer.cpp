@@ -2,13 +2,65 @@
 #include <cassert>
 #include "debug.h"
 
-QuoteServer::QuoteServer(AssetStack assets) : stack{assets}
+namespace
+{
+	/// Avalanching integer hash (lowbias32) so neighbouring minutes and days get unrelated seeds
+	constexpr uint32_t mix(uint32_t x)
+	{
+		x ^= x >> 16;
+		x *= 0x7feb352d;
+		x ^= x >> 15;
+		x *= 0x846ca68b;
+		x ^= x >> 16;
+		return x;
+	}
+
+	constexpr uint32_t gcd(uint32_t a, uint32_t b)
+	{
+		while (b != 0)
+		{
+			auto t{a % b};
+			a = b;
+			b = t;
+		}
+		return a;
+	}
+
+	/// The position of i in a shuffle of 0..n-1 chosen by seed. The shuffle is the affine map
+	/// (a * i + c) mod n, which is a permutation whenever a and n are coprime, so it needs no
+	/// table. The search for a coprime a only ever takes a few steps
+	constexpr uint16_t shuffle(uint16_t i, uint16_t n, uint32_t seed)
+	{
+		if (n < 2)
+		{
+			return 0;
+		}
+		uint32_t a{mix(seed) % (n - 1U) + 1U};
+		while (gcd(a, n) != 1)
+		{
+			a = (a % (n - 1U)) + 1U;
+		}
+		uint32_t const c{mix(seed ^ 0x9E3779B9) % n};
+		return static_cast<uint16_t>((static_cast<uint64_t>(a) * i + c) % n);
+	}
+}
+
+QuoteServer::QuoteServer(AssetStack assets) : stack{assets}, policy{Rotation::first}, decoded{}
 {
 	if (!isValidStack(stack))
 	{
 		dbg("Stack is not valid" << std::endl);
 		assert(isValidStack(stack));
 	}
+	if (stack.Minutes.empty())
+	{
+		builtMinutes = std::make_unique<std::array<MinuteIndex, MINUTES_PER_DAY>>();
+		if (!buildMinutes())
+		{
+			dbg("Assets are not sorted by key" << std::endl);
+			assert(false);
+		}
+	}
 }
 
 /**
@@ -19,18 +71,56 @@ QuoteServer::QuoteServer(AssetStack assets) : stack{assets}
  */
 std::pair<bool, std::string_view> QuoteServer::quoteFor(datetime_t dt)
 {
-	int key{keyFrom(dt)};
-	if (hasKey(key))
+	auto [ok, quote]{quoteAt(dt)};
+	return {ok, quote.Text};
+}
+
+/**
+ * @brief Gets the quote for a given dt along with its precomputed layout (if any)
+ * @param dt The datetime we want a quote for
+ * @return std::pair<bool, Quote> first is true if a quote has been found. The Breaks span
+ * is empty if the stack has no layout for the quote or it doesn't fit the text, and so is
+ * the Marker if the asset has none or it runs off the end of the text
+ */
+std::pair<bool, Quote> QuoteServer::quoteAt(datetime_t dt)
+{
+	if (auto [assetOk, asset]{GetAssetFor(dt)}; assetOk)
 	{
-		if (auto [assetOk, asset]{GetAssetByKey(key)}; assetOk)
+		if (auto [textOk, sv]{GetAssetText(asset)}; textOk)
 		{
-			if (auto [textOk, sv]{GetAssetText(asset)}; textOk)
+			Quote q{sv, std::span<const uint16_t>{}, asset.FontId};
+			if (asset.MarkerLength > 0 && asset.MarkerStart + asset.MarkerLength <= sv.size())
+			{
+				q.Marker = TextSpan{asset.MarkerStart, asset.MarkerLength};
+			}
+			q.Bold = asset.Bold || q.Marker.Length > 0;
+			q.Title = creditAt(asset.Title);
+			q.Author = creditAt(asset.Author);
+			if (asset.LineCount > 0 && asset.LineIndex + asset.LineCount <= stack.Breaks.size())
 			{
-				return {true, sv};
+				q.Breaks = stack.Breaks.subspan(asset.LineIndex, asset.LineCount);
+				if (q.Breaks.back() > sv.size())
+				{
+					q.Breaks = std::span<const uint16_t>{};
+				}
 			}
+			return {true, q};
 		}
 	}
-	return {false, std::string_view{}};
+	return {false, Quote{}};
+}
+
+/**
+ * @brief Sets the policy for choosing between the quotes for a minute
+ */
+void QuoteServer::rotateBy(Rotation r)
+{
+	policy = r;
+}
+
+Rotation QuoteServer::rotation() const
+{
+	return policy;
 }
 
 std::string_view QuoteServer::removeLeading(std::string_view sv)
@@ -49,7 +139,42 @@ bool QuoteServer::isValidStack(AssetStack const stack) const
 	auto sz{stack.Text.size()};
 	auto szb{stack.Text.size_bytes()};
 	auto isTerminated{isEndOfText(stack.Text.back())};
-	return sz == expected && szb == expected && isTerminated;
+	auto hasMinutes{stack.Minutes.empty() || stack.Minutes.size() == MINUTES_PER_DAY};
+	auto hasPairs{stack.Pairs.size() % 2 == 0 && stack.Pairs.size() <= 2 * (0x100 - PAIR_BASE)};
+	return sz == expected && szb == expected && isTerminated && hasMinutes && hasPairs;
+}
+
+/// <summary>Builds the minute index for a stack that doesn't have a generated one. One pass
+/// over the assets, which have to be sorted by key so each minute's assets are contiguous</summary>
+/// <returns>true If every key was in range and the keys never decreased</returns>
+/// <returns>false If the assets can't be indexed (builtMinutes is left empty)</returns>
+bool QuoteServer::buildMinutes()
+{
+	size_t lastKey{0};
+	for (uint32_t i{0}; i < stack.Assets.size(); i++)
+	{
+		auto const key{stack.Assets[i].Key};
+		if (key >= MINUTES_PER_DAY || key < lastKey)
+		{
+			builtMinutes->fill(MinuteIndex{0, 0});
+			return false;
+		}
+		auto &m{(*builtMinutes)[key]};
+		if (m.Count == 0)
+		{
+			m.First = i;
+		}
+		m.Count++;
+		lastKey = key;
+	}
+	return true;
+}
+
+/// <summary>The index entry for a key from the generated table if there is one, or the
+/// table built at construction if not</summary>
+MinuteIndex const &QuoteServer::minuteFor(size_t key) const
+{
+	return stack.Minutes.empty() ? (*builtMinutes)[key] : stack.Minutes[key];
 }
 
 /// <summary>Check that the key is present in the asset stack</summary>
@@ -59,14 +184,7 @@ bool QuoteServer::isValidStack(AssetStack const stack) const
 /// <returns>false If the key wasn't found </returns>
 bool QuoteServer::hasKey(const size_t key)
 {
-	for (auto const a : stack.Assets)
-	{
-		if (a.Key == key)
-		{
-			return true;
-		}
-	}
-	return false;
+	return key < MINUTES_PER_DAY && minuteFor(key).Count > 0;
 }
 
 int QuoteServer::keyFrom(datetime_t dt)
@@ -80,6 +198,19 @@ int QuoteServer::keyFrom(datetime_t dt)
 /// <returns>const char* A Flash memory pointer to the first char in the quote with the given key or nullptr if not found</returns>
 std::pair<bool, std::string_view> const QuoteServer::GetAssetText(const Asset asset)
 {
+	if (!stack.Pairs.empty())
+	{
+		if (auto [ok, length]{decode(asset.Index)}; ok)
+		{
+			return {true, std::string_view(decoded.data(), length)};
+		}
+		return {false, std::string_view{}};
+	}
+	if (asset.Length > 0 && asset.Index + asset.Length < stack.Text.size())
+	{
+		// The generator recorded the length so there's no need to scan for the terminator
+		return {asset.Length <= MAX_TEXT_LEN, std::string_view(&stack.Text[asset.Index], asset.Length)};
+	}
 	if (auto [ok, length]{lengthCheck(asset.Index)}; ok)
 	{
 		std::string_view stg(&stack.Text[asset.Index]);
@@ -88,6 +219,19 @@ std::pair<bool, std::string_view> const QuoteServer::GetAssetText(const Asset as
 	return {false, std::string_view{}};
 }
 
+/// <summary>Gets a title or author from the stack's credits without copying it</summary>
+/// <param name= offset>The offset from Asset::Title or Asset::Author</param>
+/// <returns>A view of the NUL terminated credit, empty if there are no credits or the offset is out of range</returns>
+std::string_view QuoteServer::creditAt(uint16_t offset) const
+{
+	if (offset >= stack.Credits.size())
+	{
+		return std::string_view{};
+	}
+	std::string_view const rest(stack.Credits.data() + offset, stack.Credits.size() - offset);
+	return rest.substr(0, rest.find('\0'));
+}
+
 /**
  * @brief Checks that the pointer start is the first char of a valid string
  * of less than the maximum allowed length
@@ -100,20 +244,99 @@ std::pair<bool, size_t> QuoteServer::lengthCheck(size_t start)
  	return {quotesv.size()<= MAX_TEXT_LEN, quotesv.size()};
 }
 
+/**
+ * @brief Expands the byte-pair encoded quote at start into decoded. Each output character
+ * costs at most MAX_PAIR_DEPTH pushes so the time is bounded by MAX_TEXT_LEN and nothing is
+ * allocated
+ * @param start - The index of the first byte of the compressed quote
+ * @return std::pair<bool, size_t> - true and the decoded length, or false if the quote
+ * would be longer than MAX_TEXT_LEN or uses a code that isn't in the dictionary
+ */
+std::pair<bool, size_t> QuoteServer::decode(size_t start)
+{
+	size_t const codes{stack.Pairs.size() / 2};
+	size_t length{0};
+	for (size_t i{start}; i < stack.Text.size() && !isEndOfText(stack.Text[i]); i++)
+	{
+		// Codes expand left to right so the right hand byte of each pair waits on the stack
+		uint8_t pending[MAX_PAIR_DEPTH + 1];
+		size_t depth{0};
+		pending[depth++] = static_cast<uint8_t>(stack.Text[i]);
+		while (depth > 0)
+		{
+			uint8_t const b{pending[--depth]};
+			if (b < PAIR_BASE)
+			{
+				if (length == MAX_TEXT_LEN)
+				{
+					return {false, length};
+				}
+				decoded[length++] = static_cast<char>(b);
+			}
+			else if (static_cast<size_t>(b - PAIR_BASE) < codes && depth + 2 <= MAX_PAIR_DEPTH + 1)
+			{
+				pending[depth++] = stack.Pairs[2 * (b - PAIR_BASE) + 1];
+				pending[depth++] = stack.Pairs[2 * (b - PAIR_BASE)];
+			}
+			else
+			{
+				return {false, length};
+			}
+		}
+	}
+	decoded[length] = EOT;
+	return {true, length};
+}
+
 /// <summary>Gets a reference to a quote from a quotestack in memory using its key</summary>
 /// <param name= stack>A reference to the quote stack in Flash memory</param>
 /// <param name= key>The 16-bit key for the quote required</param>
 /// <returns>Asset The reference to the required quote (in Flash) or nullptr otherwise</returns>
 std::pair<bool, const Asset> QuoteServer::GetAssetByKey(size_t key)
 {
-	for (auto const asset : stack.Assets)
+	if (hasKey(key))
 	{
-		if (asset.Key == key)
-			return {true, asset};
+		return {true, stack.Assets[minuteFor(key).First]};
 	}
 	return {false, Asset{}};
 }
 
+/// <summary>Gets the asset to show at dt according to the rotation policy</summary>
+/// <param name= dt>The datetime we want a quote for (the date is used by dayShuffle and roundRobin)</param>
+/// <returns>The chosen asset or false if there are no quotes for the minute</returns>
+std::pair<bool, const Asset> QuoteServer::GetAssetFor(datetime_t const &dt)
+{
+	size_t const key{static_cast<size_t>(keyFrom(dt))};
+	if (!hasKey(key))
+	{
+		return {false, Asset{}};
+	}
+	auto const &m{minuteFor(key)};
+	return {true, stack.Assets[m.First + choose(key, m.Count, dt)]};
+}
+
+/// <summary>Picks one of the count quotes for a minute. Constant time (the shuffle's coprime
+/// search aside) and stateless - the choice follows from the date</summary>
+/// <returns>The offset of the chosen quote from the minute's first asset</returns>
+uint16_t QuoteServer::choose(size_t key, uint16_t count, datetime_t const &dt)
+{
+	switch (policy)
+	{
+	case Rotation::dayShuffle:
+	{
+		// A fresh shuffle for every cycle of count days, stepped through a day at a time
+		uint32_t const day{static_cast<uint32_t>(TopCat::dayNumber(dt))};
+		uint32_t const seed{mix(static_cast<uint32_t>(key) ^ mix(day / count))};
+		return shuffle(static_cast<uint16_t>(day % count), count, seed);
+	}
+	case Rotation::roundRobin:
+		return static_cast<uint16_t>(static_cast<uint32_t>(TopCat::dayNumber(dt)) % count);
+	case Rotation::first:
+	default:
+		return 0;
+	}
+}
+
 bool QuoteServer::isDelimiter(char const c) const
 {
 	return (c == SPACE) || (c == EOT);
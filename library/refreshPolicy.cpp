@@ -0,0 +1,31 @@
+#include <algorithm>
+#include "refreshPolicy.h"
+
+/**
+ * @brief The waveform for the next refresh
+ *
+ * @param celsius - the panel's temperature
+ * @param changedPixels - how many pixels the refresh changes
+ */
+Waveform RefreshPolicy::choose(int8_t celsius, size_t changedPixels) const
+{
+    if (celsius < coldBelow || fastSinceClean >= maxFastUpdates)
+    {
+        return Waveform::clean;
+    }
+    bool const big{changedPixels * bigChange > size_t{WIDTH} * HEIGHT};
+    if (big && fastSinceClean * 2 >= maxFastUpdates)
+    {
+        return Waveform::clean;
+    }
+    Waveform const waveform{big ? Waveform::fast : Waveform::turbo};
+    return celsius < coolBelow ? std::min(waveform, Waveform::medium) : waveform;
+}
+
+/**
+ * @brief Records the waveform a refresh used
+ */
+void RefreshPolicy::refreshed(Waveform waveform)
+{
+    fastSinceClean = waveform == Waveform::clean ? 0 : fastSinceClean + 1;
+}
@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <memory>
+#include "renderPipeline.h"
+
+RenderPipeline::RenderPipeline() : drawing{new frameDriver()},
+                                   lo{std::unique_ptr<displayDriver>(drawing)}
+{
+}
+
+bool RenderPipeline::sameMinute(datetime_t const &a, datetime_t const &b)
+{
+    return a.year == b.year && a.month == b.month && a.day == b.day && a.hour == b.hour && a.min == b.min;
+}
+
+/**
+ * @brief Asks for a minute to be rendered
+ * @return false if the renderer is already four requests behind
+ */
+bool RenderPipeline::request(datetime_t const &minute)
+{
+    auto *slot{requests.claim()};
+    if (slot == nullptr)
+    {
+        return false;
+    }
+    *slot = minute;
+    requests.publish();
+    lastRequest = minute;
+    return true;
+}
+
+/**
+ * @brief The frame for minute if it has been rendered. Older frames (or any other minute,
+ * e.g. after the clock has been set) are dropped on the way
+ */
+Frame const *RenderPipeline::ready(datetime_t const &minute)
+{
+    while (auto const *frame{frames.peek()})
+    {
+        if (sameMinute(frame->minute, minute))
+        {
+            if (sameMinute(lastRequest, minute))
+            {
+                lastRequest = {};
+            }
+            return frame;
+        }
+        frames.release();
+    }
+    return nullptr;
+}
+
+/**
+ * @brief The frame for minute, asking for it if it hasn't been and waiting for it if it
+ * isn't ready. Give it back with release() once it's been copied out
+ */
+Frame const &RenderPipeline::frameFor(datetime_t const &minute)
+{
+    while (true)
+    {
+        if (auto const *frame{ready(minute)})
+        {
+            return *frame;
+        }
+        if (!sameMinute(lastRequest, minute))
+        {
+            request(minute);
+        }
+    }
+}
+
+void RenderPipeline::release()
+{
+    frames.release();
+}
+
+/**
+ * @brief Renders the oldest requested minute if there is a frame free for it
+ * @return true if a frame was rendered
+ */
+bool RenderPipeline::renderNext()
+{
+    auto const *minute{requests.peek()};
+    if (minute == nullptr)
+    {
+        return false;
+    }
+    auto *frame{frames.claim()};
+    if (frame == nullptr)
+    {
+        return false;
+    }
+    frame->minute = *minute;
+    requests.release();
+    lo.render(frame->minute);
+    auto const &drawn{drawing->frame()};
+    std::copy(std::begin(drawn.data), std::end(drawn.data), std::begin(frame->pixels));
+    frames.publish();
+    renders.store(renders.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    return true;
+}
@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <iostream>
+#include "sntpClient.h"
+#include "debug.h"
+
+namespace
+{
+    // seconds from 1900 (NTP's era 0) to 1970
+    constexpr int64_t ntpToUnix{2'208'988'800};
+    // LI 0 (no warning), version 4, mode 3 (client)
+    constexpr uint8_t clientRequest{0x23};
+    constexpr uint8_t serverMode{4};
+    constexpr uint8_t unsynchronised{3};
+
+    constexpr size_t rootDelayAt{4};
+    constexpr size_t rootDispersionAt{8};
+    constexpr size_t originateAt{24};
+    constexpr size_t receiveAt{32};
+    constexpr size_t transmitAt{40};
+}
+
+SntpClient::SntpClient(UdpTransport &udp) : udp{udp}
+{
+}
+
+/**
+ * @brief NTP's 32.32 fixed point seconds since 1900 (wrapping in 2036) for a unix time
+ */
+uint64_t SntpClient::toNtp(int64_t unixUs)
+{
+    int64_t seconds{unixUs / 1'000'000};
+    int64_t us{unixUs % 1'000'000};
+    if (us < 0)
+    {
+        seconds--;
+        us += 1'000'000;
+    }
+    uint64_t const ntpSeconds{static_cast<uint32_t>(seconds + ntpToUnix)};
+    return ntpSeconds << 32 | (static_cast<uint64_t>(us) << 32) / 1'000'000;
+}
+
+/**
+ * @brief The unix time of an NTP timestamp. The top bit tells the eras apart, which holds
+ * from 1968 to 2104
+ */
+int64_t SntpClient::fromNtp(uint64_t ntp)
+{
+    int64_t seconds{static_cast<int64_t>(ntp >> 32)};
+    if ((seconds & 0x80000000) == 0)
+    {
+        seconds += int64_t{1} << 32;
+    }
+    // rounded so a time survives toNtp and back
+    return (seconds - ntpToUnix) * 1'000'000 + static_cast<int64_t>(((ntp & 0xFFFFFFFF) * 1'000'000 + 0x80000000) >> 32);
+}
+
+uint64_t SntpClient::read64(std::array<uint8_t, packetSize> const &packet, size_t at)
+{
+    uint64_t value{0};
+    for (size_t i{0}; i < 8; i++)
+    {
+        value = value << 8 | packet[at + i];
+    }
+    return value;
+}
+
+void SntpClient::write64(std::array<uint8_t, packetSize> &packet, size_t at, uint64_t value)
+{
+    for (size_t i{8}; i-- > 0;)
+    {
+        packet[at + i] = static_cast<uint8_t>(value);
+        value >>= 8;
+    }
+}
+
+/**
+ * @brief A 16.16 fixed point root delay or dispersion in microseconds
+ */
+uint32_t SntpClient::shortUs(std::array<uint8_t, packetSize> const &packet, size_t at)
+{
+    uint64_t const value{uint64_t{packet[at]} << 24 | uint64_t{packet[at + 1]} << 16 | uint64_t{packet[at + 2]} << 8 | packet[at + 3]};
+    return static_cast<uint32_t>((value * 1'000'000) >> 16);
+}
+
+/**
+ * @brief One request and its reply
+ * @return first is false if no good reply came within timeoutMs
+ */
+std::pair<bool, SntpSample> SntpClient::query(uint32_t timeoutMs)
+{
+    std::array<uint8_t, packetSize> packet{};
+    packet[0] = clientRequest;
+    // the server echoes the transmit timestamp as the origin, so any unique value will do -
+    // the local clock's is, and it's T1
+    uint64_t const sentUs{udp.nowUs()};
+    write64(packet, transmitAt, sentUs);
+    if (!udp.send(packet))
+    {
+        dbg("Unable to send an NTP request" << std::endl);
+        return {false, {}};
+    }
+
+    uint64_t const deadlineUs{sentUs + timeoutMs * 1000ull};
+    while (udp.nowUs() < deadlineUs)
+    {
+        std::array<uint8_t, packetSize> reply{};
+        auto const [received, datagram]{udp.receive(reply, static_cast<uint32_t>((deadlineUs - udp.nowUs() + 999) / 1000))};
+        if (!received)
+        {
+            break;
+        }
+        uint8_t const leap{static_cast<uint8_t>(reply[0] >> 6)};
+        uint8_t const mode{static_cast<uint8_t>(reply[0] & 0x7)};
+        uint8_t const stratum{reply[1]};
+        if (datagram.size < packetSize || mode != serverMode || read64(reply, originateAt) != sentUs)
+        {
+            // not the answer to this request - a late one to the last, or not NTP at all
+            continue;
+        }
+        if (leap == unsynchronised || stratum == 0 || stratum > 15 || read64(reply, transmitAt) == 0)
+        {
+            dbg("NTP server isn't synchronised (stratum " << static_cast<int>(stratum) << ")" << std::endl);
+            return {false, {}};
+        }
+
+        int64_t const t1{static_cast<int64_t>(sentUs)};
+        int64_t const t2{fromNtp(read64(reply, receiveAt))};
+        int64_t const t3{fromNtp(read64(reply, transmitAt))};
+        int64_t const t4{static_cast<int64_t>(datagram.atUs)};
+        SntpSample sample{.offsetUs = ((t2 - t1) + (t3 - t4)) / 2,
+                          .delayUs = std::max<int64_t>((t4 - t1) - (t3 - t2), 0),
+                          .stratum = stratum,
+                          .rootDelayUs = shortUs(reply, rootDelayAt),
+                          .rootDispersionUs = shortUs(reply, rootDispersionAt)};
+        return {true, sample};
+    }
+    dbg("No reply from the NTP server" << std::endl);
+    return {false, {}};
+}
+
+/**
+ * @brief The sample with the shortest round trip from a burst of queries spacingMs apart
+ * @return first is false if none were answered
+ */
+std::pair<bool, SntpSample> SntpClient::best(size_t samples, uint32_t spacingMs, uint32_t timeoutMs)
+{
+    std::pair<bool, SntpSample> chosen{false, {}};
+    for (size_t i{0}; i < samples; i++)
+    {
+        if (i > 0)
+        {
+            udp.sleep(spacingMs);
+        }
+        auto const [ok, sample]{query(timeoutMs)};
+        if (ok && (!chosen.first || sample.delayUs < chosen.second.delayUs))
+        {
+            chosen = {true, sample};
+        }
+    }
+    if (chosen.first)
+    {
+        dbg("NTP offset " << chosen.second.offsetUs << "us, delay " << chosen.second.delayUs << "us, stratum "
+                          << static_cast<int>(chosen.second.stratum) << std::endl);
+    }
+    return chosen;
+}
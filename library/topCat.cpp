@@ -11,22 +11,20 @@ TopCat::TopCat(datetime_t startupTime) : picoch{0}
         startup = default_dt();
     }
 
-    tm startup_tm;
-    if (toTm(&startup, &startup_tm))
-    {
-        picoch = mktime(&startup_tm);
-    }
+    picoch = CivilTime::toSeconds(startup);
 }
 
+/**
+ * @brief Seconds from the startup time to dt, both read on the same (local) clock
+ */
 time_t TopCat::elapsed(const datetime_t dt)
 {
-    tm now_tm;
-    time_t now_t{0};
-    if (toTm(&dt, &now_tm))
+    int64_t now_t{0};
+    if (dtIsValid(&dt))
     {
-        now_t = mktime(&now_tm);
+        now_t = CivilTime::toSeconds(dt);
     }
-    return now_t - picoch;
+    return static_cast<time_t>(now_t - picoch);
 }
 
 /**
@@ -37,10 +35,14 @@ time_t TopCat::elapsed(const datetime_t dt)
  */
 bool TopCat::toTm(time_t const *tt, tm *ttm)
 {
-    setGBLocale();
-    // localtime_r return the buffer pointer on sucess or null pointer otherwise
-    tm *localtm{localtime_r(tt, ttm)};
-    return (localtm == ttm);
+    datetime_t dt;
+    if (!toDateTime(tt, &dt) || !toTm(&dt, ttm))
+    {
+        return false;
+    }
+    ttm->tm_yday = CivilTime::daysFromCivil(dt) - CivilTime::daysFromCivil(dt.year, 1, 1);
+    ttm->tm_isdst = utcOffset(*tt) != zones::london.standardOffset;
+    return true;
 }
 
 /**
@@ -76,14 +78,8 @@ bool TopCat::toDateTime(tm const *ttm, datetime_t *dt)
 
 bool TopCat::toDateTime(const time_t *tt, datetime_t *dt)
 {
-    tm ttm;
-    setGBLocale();
-    bool ok{false};
-    if (toTm(tt, &ttm))
-    {
-        ok = toDateTime(&ttm, dt);
-    }
-    return ok;
+    *dt = ukTime(*tt);
+    return dtIsValid(dt);
 }
 
 std::string TopCat::toString(const datetime_t *dt)
@@ -1,36 +1,36 @@
 
 #include <cstdlib>
 #include <math.h>
+#include <algorithm>
+#include <iterator>
 #include "uc8151.h"
 #include "uc8151Defs.h"
 
-UC8151::UC8151() : update_speed{3}, buffer{}
+UC8151::UC8151(std::unique_ptr<PanelTransport> panel) : update_speed{0}, buffer{}, panel{std::move(panel)}
 {
-    initPico();
-    sleep_ms(500);
+    // a reset pulse and BUSY say when the controller is ready - no need for fixed waits
+    reset();
     initDriver();
-    sleep_ms(500);
 }
 
 bool UC8151::is_busy()
 {
-    return !gpio_get(busy);
+    return panel->busy();
 }
 
 void UC8151::busy_wait()
 {
     while (is_busy())
     {
-        tight_loop_contents();
     }
 }
 
 void UC8151::reset()
 {
-    gpio_put(resetPin, 0);
-    sleep_ms(10);
-    gpio_put(resetPin, 1);
-    sleep_ms(10);
+    panel->reset(false);
+    panel->sleep(10);
+    panel->reset(true);
+    panel->sleep(10);
     busy_wait();
 }
 
@@ -124,6 +124,8 @@ void UC8151::medium_luts()
                      0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
                      0x00, 0x00, 0x00, 0x00, 0x00, 0x00});
 
+    command(PLL, {HZ_100});
+
     busy_wait();
 }
 
@@ -225,41 +227,23 @@ void UC8151::turbo_luts()
     busy_wait();
 }
 
-void UC8151::initPico()
+/**
+ * @brief PSR with the LUTs taken from OTP for the clean waveform and from the LUT
+ * registers for the others - the controller ignores uploaded LUTs without LUT_REG
+ */
+uint8_t UC8151::psrSetting() const
 {
-    // configure spi interface and pins
-    spi_init(spi0, 12'000'000);
-
-    gpio_set_function(DC, GPIO_FUNC_SIO);
-    gpio_set_dir(DC, GPIO_OUT);
-
-    gpio_set_function(CS, GPIO_FUNC_SIO);
-    gpio_set_dir(CS, GPIO_OUT);
-    gpio_put(CS, 1);
-
-    gpio_set_function(resetPin, GPIO_FUNC_SIO);
-    gpio_set_dir(resetPin, GPIO_OUT);
-    gpio_put(resetPin, 1);
-
-    gpio_set_function(busy, GPIO_FUNC_SIO);
-    gpio_set_dir(busy, GPIO_IN);
-    gpio_set_pulls(busy, true, false);
-
-    gpio_set_function(SCK, GPIO_FUNC_SPI);
-    gpio_set_function(MOSI, GPIO_FUNC_SPI);
-};
+    return RES_128x296 | FORMAT_BW | BOOSTER_ON | RESET_NONE | SHIFT_RIGHT | SCAN_DOWN |
+           (update_speed == 0 ? LUT_OTP : LUT_REG);
+}
 
-void UC8151::initDriver()
+/**
+ * @brief Uploads the LUTs and frame rate for the current update speed
+ */
+void UC8151::loadLuts()
 {
-    uint8_t psr_setting = RES_128x296 | FORMAT_BW | BOOSTER_ON | RESET_NONE | LUT_OTP | SHIFT_RIGHT | SCAN_DOWN;
-
-    command(PSR, 1, &psr_setting);
-
     switch (update_speed)
     {
-    case 0:
-        // Use the predefined default luts
-        break;
     case 1:
         medium_luts();
         break;
@@ -270,8 +254,40 @@ void UC8151::initDriver()
         turbo_luts();
         break;
     default:
+        // the OTP waveform
+        command(PLL, {HZ_100});
         break;
     }
+}
+
+/**
+ * @brief Switches waveform, touching the controller only if it's a change
+ */
+void UC8151::useWaveform(Waveform waveform)
+{
+    if (static_cast<uint8_t>(waveform) == update_speed)
+    {
+        return;
+    }
+    update_speed = static_cast<uint8_t>(waveform);
+    command(PSR, {psrSetting()});
+    loadLuts();
+}
+
+/**
+ * @brief The panel's temperature in whole degrees from its internal sensor
+ */
+int8_t UC8151::temperature()
+{
+    uint8_t reading[2]{};
+    read(TSC, sizeof(reading), reading);
+    return static_cast<int8_t>(reading[0]);
+}
+
+void UC8151::initDriver()
+{
+    command(PSR, {psrSetting()});
+    loadLuts();
 
     command(PWR, {VDS_INTERNAL | VDG_INTERNAL,
                   VCOM_VD | VGHL_16V,
@@ -295,8 +311,6 @@ void UC8151::initDriver()
     command(TCON, {0x22});                                             // tcon setting
     command(CDI, {(uint8_t)(inverted ? 0b10'01'1100 : 0b01'00'1100)}); // vcom and data interval
 
-    command(PLL, {HZ_100});
-
     command(POF);
     busy_wait();
 }
@@ -306,59 +320,47 @@ void UC8151::power_off()
     command(POF);
 }
 
+/**
+ * @brief Sends a command and reads len bytes of its reply (e.g. the temperature after TSC)
+ */
 void UC8151::read(uint8_t reg, size_t len, uint8_t *data)
 {
-    gpio_put(CS, 0);
+    panel->select(true);
 
-    gpio_put(DC, 0); // command mode
-    spi_write_blocking(spi0, &reg, 1);
+    panel->dataMode(false); // command mode
+    panel->write({&reg, 1});
 
     if (len > 0)
     {
-        gpio_put(DC, 1); // data mode
-        gpio_set_function(SCK, GPIO_FUNC_SIO);
-        gpio_set_dir(SCK, GPIO_OUT);
-        gpio_set_function(MOSI, GPIO_FUNC_SIO);
-        gpio_set_dir(MOSI, GPIO_IN);
-        for (auto i = 0u; i < len; i++)
-        {
-            int byte = i / 8;
-            int bit = i % 8;
-            gpio_put(SCK, true);
-            bool value = gpio_get(MOSI);
-            data[byte] |= value << (7 - bit);
-            gpio_put(SCK, false);
-        }
-
-        gpio_set_function(SCK, GPIO_FUNC_SPI);
-        gpio_set_function(MOSI, GPIO_FUNC_SPI);
+        panel->dataMode(true); // data mode
+        panel->read({data, len});
     }
 
-    gpio_put(CS, 1);
+    panel->select(false);
 }
 
 void UC8151::command(uint8_t reg, size_t len, const uint8_t *data)
 {
-    gpio_put(CS, 0);
+    panel->select(true);
 
-    gpio_put(DC, 0); // command mode
-    spi_write_blocking(spi0, &reg, 1);
+    panel->dataMode(false); // command mode
+    panel->write({&reg, 1});
 
     if (len > 0)
     {
-        gpio_put(DC, 1); // data mode
-        spi_write_blocking(spi0, (const uint8_t *)data, len);
+        panel->dataMode(true); // data mode
+        panel->write({data, len});
     }
 
-    gpio_put(CS, 1);
+    panel->select(false);
 }
 
 void UC8151::data(size_t len, const uint8_t *data)
 {
-    gpio_put(CS, 0);
-    gpio_put(DC, 1); // data mode
-    spi_write_blocking(spi0, (const uint8_t *)data, len);
-    gpio_put(CS, 1);
+    panel->select(true);
+    panel->dataMode(true); // data mode
+    panel->write({data, len});
+    panel->select(false);
 }
 
 void UC8151::command(uint8_t reg, std::initializer_list<uint8_t> values)
@@ -373,37 +375,250 @@ bool UC8151::set_update_speed(int update_speed)
     return true;
 }
 
-uint32_t UC8151::update_time()
+/**
+ * @brief How long a refresh takes at an update speed in ms - the OTP waveform's quoted time,
+ * otherwise the frames in the LUTs at their frame rate (e.g. turbo is 26 frames at 200Hz)
+ */
+uint32_t UC8151::update_time(uint8_t speed)
 {
-    switch (update_speed)
+    switch (speed)
     {
     case 0:
         return 4500;
     case 1:
-        return 2000;
+        return 2540;
     case 2:
-        return 800;
+        return 465;
     case 3:
-        return 250;
+        return 130;
     default:
         return 4500;
     }
 }
 
+/**
+ * @brief How long update() would keep the panel busy for the frame in the buffer now, in ms -
+ * the waveform the refresh policy would pick at the last temperature read. Zero if nothing
+ * has changed. Lets a caller start the update so that it ends when it wants
+ */
+uint32_t UC8151::refreshTime() const
+{
+    if (shownValid && !buffer.changedFrom(shown).first)
+    {
+        return 0;
+    }
+    size_t const changedPixels{shownValid ? buffer.differingPixels(shown) : size_t{WIDTH} * HEIGHT};
+    return update_time(static_cast<uint8_t>(policy.choose(panelTemperature, changedPixels)));
+}
+
+/**
+ * @brief Shows the buffer. Only the bounding box of what changed since the last update is
+ * sent and refreshed, using the controller's partial window, so a minute where two digits
+ * change moves a few hundred bytes and doesn't flash the whole panel. Nothing is sent if
+ * nothing changed, and the first update is always a full one.
+ * When blocking this returns once the panel has refreshed. Otherwise it returns as soon as
+ * the frame has started streaming out - the transport's interrupts stream the rest and
+ * poll() finishes the refresh. An update asked for while one is in flight follows it with
+ * the latest frame
+ */
 void UC8151::update()
 {
+    if (state != UpdateStatus::idle)
+    {
+        pending = true;
+    }
+    else
+    {
+        startUpdate();
+    }
     if (blocking)
     {
-        busy_wait();
+        while (state != UpdateStatus::idle)
+        {
+            poll();
+        }
+    }
+}
+
+/**
+ * @brief Blocking updates poll the panel until it's done. Non-blocking ones let the
+ * transport's interrupts start each column as the last one goes, so the caller can get on
+ * with something else and call poll() when it wakes
+ */
+void UC8151::setBlocking(bool wait)
+{
+    blocking = wait;
+    if (blocking)
+    {
+        panel->onEvent({});
+    }
+    else
+    {
+        panel->onEvent([this]()
+                       { interrupt(); });
+    }
+}
+
+/**
+ * @brief Moves the update in flight on - the next column once the last has gone, DRF once
+ * they all have and power off once BUSY is released, then the frame that came in meanwhile.
+ * Non-blocking, the columns are started by interrupt(), which flags the last one going and
+ * BUSY's release for this to act on. Safe to call at any time from the thread that calls
+ * update(), never from an interrupt
+ */
+void UC8151::poll()
+{
+    switch (state)
+    {
+    case UpdateStatus::sending:
+        if (blocking ? !panel->writing() && !sendColumn() : lastSent.load())
+        {
+            finishSending();
+        }
+        break;
+    case UpdateStatus::refreshing:
+        if (blocking ? !panel->busy() : released.load())
+        {
+            finishRefresh();
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief The transport's interrupt - a write has finished or BUSY has been released. Only
+ * starts the next column's DMA, which is all that can't wait, and sets the flags poll()
+ * looks at. Sending commands and waiting on BUSY are left to poll() in the main loop, which
+ * the interrupt has woken
+ */
+void UC8151::interrupt()
+{
+    switch (state)
+    {
+    case UpdateStatus::sending:
+        if (!panel->writing() && !sendColumn())
+        {
+            lastSent = true;
+        }
+        break;
+    case UpdateStatus::refreshing:
+        released = !panel->busy();
+        break;
+    default:
+        break;
     }
+}
+
+/**
+ * @brief Snapshots the buffer into shown, which is what the transport streams from, so
+ * drawing the next frame can start straight away. The refresh policy picks the waveform
+ * from the panel's temperature and how much changed. The controller's gate lines are our
+ * columns (x) and its source bytes are the bytes of a column, so a partial window is
+ * columns window.left() to window.right() and bytes window.top() / 8 to window.bottom() / 8
+ * of each. changedFrom() has already aligned the rows to whole bytes
+ */
+void UC8151::startUpdate()
+{
+    auto const [changed, box]{buffer.changedFrom(shown)};
+    if (shownValid && !changed)
+    {
+        return;
+    }
+    partial = shownValid && (box.width() != WIDTH || box.height() != HEIGHT);
+    window = partial ? box : Rect(Point(0, 0), Point(WIDTH - 1, HEIGHT - 1));
+    column = window.left();
+    size_t const changedPixels{shownValid ? buffer.differingPixels(shown) : size_t{WIDTH} * HEIGHT};
+    std::copy(std::begin(buffer.data), std::end(buffer.data), shown.begin());
+    shownValid = true;
+
+    busy_wait();
     command(PON);
-    command(PTOU);
-    command(DTM2, FRAMEBUFFERSIZE, buffer.data);
+    busy_wait();
+    panelTemperature = temperature();
+    auto const waveform{policy.choose(panelTemperature, changedPixels)};
+    useWaveform(waveform);
+    policy.refreshed(waveform);
+    if (partial)
+    {
+        command(PTIN); // partial mode on
+        command(PTL, {static_cast<uint8_t>(window.top()),             // HRST - a multiple of 8
+                      static_cast<uint8_t>(window.bottom() | 0b111),  // HRED - ends on a byte
+                      static_cast<uint8_t>(window.left() >> 8),       // VRST
+                      static_cast<uint8_t>(window.left()),
+                      static_cast<uint8_t>(window.right() >> 8),      // VRED
+                      static_cast<uint8_t>(window.right()),
+                      0b00000001});                                   // PT_SCAN - gates outside the window are left alone
+    }
+    else
+    {
+        command(PTOU);
+    }
+    // DTM2 stays selected while its data streams out
+    uint8_t const reg{DTM2};
+    panel->select(true);
+    panel->dataMode(false);
+    panel->write({&reg, 1});
+    panel->dataMode(true);
+    lastSent = false;
+    state = UpdateStatus::sending;
+    sendColumn();
+}
+
+/**
+ * @brief Starts the next piece of image data - the whole frame in one go for a full update,
+ * a column of the window at a time for a partial one. False once it has all gone
+ */
+bool UC8151::sendColumn()
+{
+    constexpr uint_t columnBytes{HEIGHT / 8};
+    if (column > window.right())
+    {
+        return false;
+    }
+    if (!partial)
+    {
+        column = WIDTH;
+        panel->startWrite(shown);
+        return true;
+    }
+    size_t const firstByte{window.top() / 8u};
+    size_t const bytes{window.height() / 8u};
+    column++;
+    panel->startWrite({shown.data() + (column - 1) * columnBytes + firstByte, bytes});
+    return true;
+}
+
+void UC8151::finishSending()
+{
+    panel->select(false);
     command(DSP);
+    released = false;
     command(DRF);
-    if (blocking)
+    state = UpdateStatus::refreshing;
+}
+
+/**
+ * @brief BUSY has gone - leaves partial mode, powers off and reports. A frame that came in
+ * meanwhile goes out next
+ */
+void UC8151::finishRefresh()
+{
+    if (partial)
     {
-        off();
+        command(PTOU); // partial mode off
+    }
+    command(POF); // turn off
+    state = UpdateStatus::idle;
+    if (completed)
+    {
+        completed();
+    }
+    if (pending)
+    {
+        pending = false;
+        startUpdate();
     }
 }
 
@@ -417,6 +632,36 @@ void UC8151::set(int x, int y)
     buffer.set(Point(x,y));
 }
 
+void UC8151::blit(int x, int y, std::span<const uint8_t> bitmap, uint_t width, uint_t height, uint_t stride)
+{
+    buffer.blit(x, y, bitmap, width, height, stride);
+}
+
+void UC8151::blitColumns(int x, int y, std::span<const uint8_t> columns, uint_t width, uint_t height, uint_t columnStride)
+{
+    buffer.blitColumns(x, y, columns, width, height, columnStride);
+}
+
+void UC8151::span(int x, int y, int length)
+{
+    buffer.span(x, y, length);
+}
+
+void UC8151::fill(Rect const &r)
+{
+    buffer.fill(r);
+}
+
+void UC8151::erase(Rect const &r)
+{
+    buffer.erase(r);
+}
+
+void UC8151::copy(std::span<const uint8_t, FRAMEBUFFERSIZE> frame)
+{
+    buffer.copy(frame);
+}
+
 void UC8151::off()
 {
     busy_wait();
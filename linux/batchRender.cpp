@@ -0,0 +1,261 @@
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <cstdio>
+
+#include "dimensions.h"
+#include "layoutServer.h"
+#include "topCat.h"
+#include "imageDriver.h"
+
+/**
+ * @brief Renders a range of minutes (all of them by default) the same way the clock does and
+ * writes each frame as an image, or tiles them all onto one contact sheet, so a corpus change
+ * can be reviewed without an X server. Every worker thread has its own LayoutServer and
+ * imageDriver so nothing is shared but the work counter and (for a contact sheet) disjoint
+ * tiles of the sheet.
+ *
+ * batchRender DESTINATION [-f HH:MM] [-t HH:MM] [-d YYYY-MM-DD] [-n DAYS] [-j THREADS] [-p] [-c COLUMNS]
+ *  DESTINATION - a directory for one image per minute, or a .png/.pbm file for a contact sheet
+ *  -f, -t      - the first and last minute to render (default 00:00 to 23:59)
+ *  -d          - the date to render for, which picks the quote when a minute has several (default today)
+ *  -n          - render this many consecutive days from the date (default 1)
+ *  -j          - worker threads (default every core)
+ *  -p          - write PBM rather than PNG frames
+ *  -c          - frames per row on the contact sheet (default 12)
+ */
+
+using namespace std;
+namespace fs = std::filesystem;
+
+/**
+ * @brief Swallows what's written to it. A stream with no buffer at all goes bad on every
+ * write, which from several threads at once is a race on the stream's state
+ */
+struct NullBuffer : std::streambuf
+{
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(char const *, std::streamsize n) override { return n; }
+};
+
+/**
+ * @brief Gap between the frames on a contact sheet. A multiple of 8 keeps every frame on
+ * byte boundaries so the workers never write to the same byte.
+ */
+constexpr size_t sheet_gutter{8};
+
+struct Options
+{
+    fs::path destination;
+    int first{0};
+    int last{MINUTES_PER_DAY - 1};
+    datetime_t date{};
+    int days{1};
+    unsigned threads{0};
+    bool pbm{false};
+    size_t columns{12};
+};
+
+pair<bool, int> parseMinute(string_view s)
+{
+    int hour{0};
+    int min{0};
+    if (sscanf(string(s).c_str(), "%d:%d", &hour, &min) != 2 || hour < 0 || hour > 23 || min < 0 || min > 59)
+    {
+        return {false, 0};
+    }
+    return {true, hour * 60 + min};
+}
+
+pair<bool, datetime_t> parseDate(string_view s)
+{
+    int year{0};
+    int month{0};
+    int day{0};
+    if (sscanf(string(s).c_str(), "%d-%d-%d", &year, &month, &day) != 3 || month < 1 || month > 12 || day < 1 || day > 31)
+    {
+        return {false, {}};
+    }
+    // a day past the end of its month (2023-02-31) comes back as a different date
+    datetime_t const dt{CivilTime::civilFromDays(CivilTime::daysFromCivil(year, month, day))};
+    if (dt.year != year || dt.month != month || dt.day != day)
+    {
+        return {false, {}};
+    }
+    return {true, dt};
+}
+
+pair<bool, Options> parseArgs(vector<string_view> const &args)
+{
+    Options opt;
+    const time_t now{TopCat::timeNow()};
+    datetime_t today;
+    if (TopCat::toDateTime(&now, &today))
+    {
+        opt.date = CivilTime::civilFromDays(TopCat::dayNumber(today));
+    }
+    bool ok{true};
+    for (size_t i{0}; i < args.size() && ok; i++)
+    {
+        auto const arg{args[i]};
+        bool const hasValue{i + 1 < args.size()};
+        if (arg == "-p")
+        {
+            opt.pbm = true;
+        }
+        else if (arg == "-f" && hasValue)
+        {
+            tie(ok, opt.first) = parseMinute(args[++i]);
+        }
+        else if (arg == "-t" && hasValue)
+        {
+            tie(ok, opt.last) = parseMinute(args[++i]);
+        }
+        else if (arg == "-d" && hasValue)
+        {
+            tie(ok, opt.date) = parseDate(args[++i]);
+        }
+        else if (arg == "-n" && hasValue)
+        {
+            opt.days = stoi(string(args[++i]));
+            ok = opt.days > 0;
+        }
+        else if (arg == "-j" && hasValue)
+        {
+            opt.threads = stoul(string(args[++i]));
+        }
+        else if (arg == "-c" && hasValue)
+        {
+            opt.columns = stoul(string(args[++i]));
+            ok = opt.columns > 0;
+        }
+        else if (arg.starts_with("-") || !opt.destination.empty())
+        {
+            ok = false;
+        }
+        else
+        {
+            opt.destination = arg;
+        }
+    }
+    ok = ok && !opt.destination.empty() && opt.first <= opt.last;
+    if (opt.threads == 0)
+    {
+        opt.threads = max(1u, thread::hardware_concurrency());
+    }
+    return {ok, opt};
+}
+
+/// @brief e.g. 20230219-0907.png
+string frameName(datetime_t const &dt, bool pbm)
+{
+    ostringstream name;
+    name << setfill('0') << setw(4) << dt.year << setw(2) << (int)dt.month << setw(2) << (int)dt.day << "-"
+         << setw(2) << (int)dt.hour << setw(2) << (int)dt.min << (pbm ? ".pbm" : ".png");
+    return name.str();
+}
+
+int main(int argc, char *argv[])
+{
+    auto [ok, opt]{parseArgs(vector<string_view>(argv + 1, argv + argc))};
+    if (!ok)
+    {
+        cerr << "usage: batchRender DESTINATION [-f HH:MM] [-t HH:MM] [-d YYYY-MM-DD] [-n DAYS] [-j THREADS] [-p] [-c COLUMNS]" << endl;
+        return 1;
+    }
+    auto const ext{opt.destination.extension()};
+    bool const sheet{ext == ".png" || ext == ".pbm"};
+    if (!sheet)
+    {
+        error_code ec;
+        fs::create_directories(opt.destination, ec);
+        if (ec)
+        {
+            cerr << "Can't create " << opt.destination << ": " << ec.message() << endl;
+            return 1;
+        }
+    }
+
+    size_t const perDay{static_cast<size_t>(opt.last - opt.first + 1)};
+    size_t const total{perDay * opt.days};
+    size_t const tileWidth{WIDTH + sheet_gutter};
+    size_t const tileHeight{HEIGHT + sheet_gutter};
+    size_t const columns{min(opt.columns, total)};
+    MonoImage contactSheet{sheet ? MonoImage(columns * tileWidth + sheet_gutter, ((total + columns - 1) / columns) * tileHeight + sheet_gutter)
+                                 : MonoImage(0, 0)};
+    int32_t const firstDay{TopCat::dayNumber(opt.date)};
+
+    // LayoutServer traces every render to cout which would swamp the progress report
+    NullBuffer sink;
+    auto const coutBuf{cout.rdbuf(&sink)};
+
+    atomic<size_t> next{0};
+    atomic<size_t> failed{0};
+    auto worker{[&]()
+                {
+                    auto driver{make_unique<imageDriver>()};
+                    auto &frames{*driver};
+                    LayoutServer lo(std::move(driver));
+                    for (size_t i{next++}; i < total; i = next++)
+                    {
+                        int const minute{opt.first + static_cast<int>(i % perDay)};
+                        datetime_t dt{CivilTime::civilFromDays(firstDay + static_cast<int32_t>(i / perDay))};
+                        dt.hour = static_cast<int8_t>(minute / 60);
+                        dt.min = static_cast<int8_t>(minute % 60);
+                        lo.timeIs(dt);
+                        if (sheet)
+                        {
+                            size_t const x{sheet_gutter + (i % columns) * tileWidth};
+                            size_t const y{sheet_gutter + (i / columns) * tileHeight};
+                            contactSheet.paste(frames.frame(), x, y);
+                        }
+                        else if (!frames.write(opt.destination / frameName(dt, opt.pbm)))
+                        {
+                            failed++;
+                        }
+                    }
+                }};
+
+    auto const start{chrono::steady_clock::now()};
+    vector<thread> workers;
+    for (unsigned t{0}; t < min<size_t>(opt.threads, total); t++)
+    {
+        workers.emplace_back(worker);
+    }
+    for (auto &w : workers)
+    {
+        w.join();
+    }
+    auto const elapsed{chrono::duration<double>(chrono::steady_clock::now() - start).count()};
+    cout.rdbuf(coutBuf);
+
+    if (sheet)
+    {
+        // Neighbouring outlines share gutter bytes so they are drawn once the workers are done
+        for (size_t i{0}; i < total; i++)
+        {
+            contactSheet.border(sheet_gutter + (i % columns) * tileWidth, sheet_gutter + (i / columns) * tileHeight, WIDTH, HEIGHT);
+        }
+    }
+    if (sheet && !contactSheet.write(opt.destination))
+    {
+        cerr << "Can't write " << opt.destination << endl;
+        return 1;
+    }
+    cerr << "Rendered " << total << " frames on " << workers.size() << " threads in "
+         << fixed << setprecision(2) << elapsed << " s";
+    if (failed > 0)
+    {
+        cerr << " - " << failed << " frames could not be written";
+    }
+    cerr << endl;
+    return failed == 0 ? 0 : 1;
+}
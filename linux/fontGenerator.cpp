@@ -34,18 +34,24 @@ void PrintArguments()
 {
     std::cout << "Optional Usage: "
               << "FontGenerator"
-              << "  [SOURCE]  [DESTINATION]  [-r(ecursive)]" << std::endl;
+              << "  [SOURCE]  [DESTINATION]  [-r(ecursive)]  [-c(olumns)]" << std::endl;
+    std::cout << "  -c also writes the bitmaps pre-transposed into FrameBuffer (column-major) order" << std::endl;
 }
 
-void ParseArguments(int argc, char *argv[], std::string &inStg, std::string &outStg, bool &recursive)
+void ParseArguments(int argc, char *argv[], std::string &inStg, std::string &outStg, bool &recursive, bool &columns)
 {
     if (argc > 2)
     {
         inStg = std::string(argv[1]);
         outStg = std::string(argv[2]);
-        if (argc == 4)
+        // Flags can follow the paths in any order
+        for (int i{3}; i < argc; i++)
         {
-            recursive = ((argv[3][0] == '-') && (argv[3][1] == 'r'));
+            if (argv[i][0] == '-')
+            {
+                recursive = recursive || (argv[i][1] == 'r');
+                columns = columns || (argv[i][1] == 'c');
+            }
         }
     }
     else
@@ -296,10 +302,11 @@ int main(int argc, char *argv[])
     using namespace std;
 
     bool recursive{false};
+    bool columns{false};
     std::string inString{DefaultDirArg()};
     std::string outString{inString};
 
-    ParseArguments(argc, argv, inString, outString, recursive);
+    ParseArguments(argc, argv, inString, outString, recursive, columns);
 
     std::vector<std::filesystem::path> sourceFilePaths{GetSourceFiles(inString, recursive)};
     ListFiles(sourceFilePaths);
@@ -308,6 +315,7 @@ int main(int argc, char *argv[])
     {
         std::vector<std::string> bdfTokens{TokenizeBdf(GetFileContent(p), GlyphCountLimit)};
         auto font{MakeFont(std::move(bdfTokens), p.stem().string())};
+        font.ColumnMajor(columns);
 
         std::filesystem::path fontFilePath{MakeFontFilePath(outString, font.Tag())};
         std::cout << "Writing " << font.Tag() << " to " << fontFilePath << std::endl;
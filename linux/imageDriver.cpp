@@ -0,0 +1,241 @@
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include "imageDriver.h"
+
+/**
+ * @brief The largest payload a stored (uncompressed) deflate block can carry
+ */
+constexpr size_t max_stored_block{65535};
+
+/**
+ * @brief Byte table for the reflected CRC-32 polynomial 0xEDB88320 used by PNG
+ */
+static constexpr std::array<uint32_t, 256> crcTable{[]()
+                                                    {
+                                                        std::array<uint32_t, 256> table{};
+                                                        for (uint32_t n{0}; n < 256; n++)
+                                                        {
+                                                            uint32_t c{n};
+                                                            for (int k{0}; k < 8; k++)
+                                                            {
+                                                                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                                                            }
+                                                            table[n] = c;
+                                                        }
+                                                        return table;
+                                                    }()};
+
+uint32_t crc32(std::span<const uint8_t> data, uint32_t crc)
+{
+    crc = ~crc;
+    for (auto const b : data)
+    {
+        crc = crcTable[(crc ^ b) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+uint32_t adler32(std::span<const uint8_t> data, uint32_t adler)
+{
+    constexpr uint32_t mod_adler{65521};
+    uint32_t a{adler & 0xFFFF};
+    uint32_t b{adler >> 16};
+    for (auto const d : data)
+    {
+        a = (a + d) % mod_adler;
+        b = (b + a) % mod_adler;
+    }
+    return (b << 16) | a;
+}
+
+MonoImage::MonoImage(size_t width, size_t height) : imageWidth{width},
+                                                    imageHeight{height},
+                                                    stride{(width + 7) / 8},
+                                                    bits(stride * height, 0)
+{
+}
+
+void MonoImage::set(size_t x, size_t y)
+{
+    if (x >= imageWidth || y >= imageHeight)
+    {
+        return;
+    }
+    bits[y * stride + x / 8] |= 0b10000000 >> (x % 8);
+}
+
+bool MonoImage::at(size_t x, size_t y) const
+{
+    if (x >= imageWidth || y >= imageHeight)
+    {
+        return false;
+    }
+    return bits[y * stride + x / 8] & (0b10000000 >> (x % 8));
+}
+
+/**
+ * @brief Transposes a column-major frame into the image with its top left at (x,y).
+ * Anything that falls off the image is dropped.
+ */
+void MonoImage::paste(FrameBuffer const &frame, size_t x, size_t y)
+{
+    constexpr size_t column_bytes{HEIGHT / 8};
+    for (size_t col{0}; col < WIDTH; col++)
+    {
+        for (size_t byte{0}; byte < column_bytes; byte++)
+        {
+            uint8_t const b{frame.data[col * column_bytes + byte]};
+            if (b == 0)
+            {
+                continue;
+            }
+            for (size_t bit{0}; bit < 8; bit++)
+            {
+                if (b & (0b10000000 >> bit))
+                {
+                    set(x + col, y + byte * 8 + bit);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Draws a one pixel outline just outside the rectangle with its top left at (x,y)
+ * so a frame on a contact sheet shows where the panel edges are
+ */
+void MonoImage::border(size_t x, size_t y, size_t width, size_t height)
+{
+    for (size_t i{0}; i < width + 2; i++)
+    {
+        set(x + i - 1, y - 1);
+        set(x + i - 1, y + height);
+    }
+    for (size_t i{0}; i < height; i++)
+    {
+        set(x - 1, y + i);
+        set(x + width, y + i);
+    }
+}
+
+/**
+ * @brief Writes a binary (P4) portable bitmap. PBM rows are packed MSB first with 1 for
+ * black so the image is written as it is held.
+ */
+bool MonoImage::writePbm(std::filesystem::path const &path) const
+{
+    std::ofstream out(path, std::ios::binary);
+    if (!out)
+    {
+        return false;
+    }
+    out << "P4\n"
+        << imageWidth << " " << imageHeight << "\n";
+    out.write(reinterpret_cast<char const *>(bits.data()), bits.size());
+    return static_cast<bool>(out);
+}
+
+static void putBigEndian(std::vector<uint8_t> &v, uint32_t n)
+{
+    v.push_back(n >> 24);
+    v.push_back(n >> 16);
+    v.push_back(n >> 8);
+    v.push_back(n);
+}
+
+static void writeChunk(std::ofstream &out, std::string_view type, std::span<const uint8_t> data)
+{
+    std::vector<uint8_t> chunk;
+    chunk.reserve(data.size() + 12);
+    putBigEndian(chunk, data.size());
+    chunk.insert(chunk.end(), type.begin(), type.end());
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    // The CRC covers the type and the data but not the length
+    putBigEndian(chunk, crc32(std::span<const uint8_t>(chunk).subspan(4)));
+    out.write(reinterpret_cast<char const *>(chunk.data()), chunk.size());
+}
+
+/**
+ * @brief Writes a 1-bit greyscale PNG. The image data is wrapped in stored deflate blocks
+ * so we don't need zlib - a 296x128 frame is under 5K either way. PNG greyscale has 0 for
+ * black so every byte is inverted, and each row is prefixed with filter type 0 (none).
+ */
+bool MonoImage::writePng(std::filesystem::path const &path) const
+{
+    std::ofstream out(path, std::ios::binary);
+    if (!out)
+    {
+        return false;
+    }
+    constexpr std::array<uint8_t, 8> signature{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    out.write(reinterpret_cast<char const *>(signature.data()), signature.size());
+
+    std::vector<uint8_t> header;
+    putBigEndian(header, imageWidth);
+    putBigEndian(header, imageHeight);
+    header.insert(header.end(), {1,   // bit depth
+                                 0,   // colour type greyscale
+                                 0,   // compression deflate
+                                 0,   // filter method
+                                 0}); // no interlace
+    writeChunk(out, "IHDR", header);
+
+    std::vector<uint8_t> raw;
+    raw.reserve((stride + 1) * imageHeight);
+    for (size_t row{0}; row < imageHeight; row++)
+    {
+        raw.push_back(0);
+        for (size_t i{0}; i < stride; i++)
+        {
+            raw.push_back(~bits[row * stride + i]);
+        }
+    }
+
+    std::vector<uint8_t> zlib{0x78, 0x01};
+    zlib.reserve(raw.size() + (raw.size() / max_stored_block + 1) * 5 + 6);
+    size_t done{0};
+    do
+    {
+        size_t const len{std::min(max_stored_block, raw.size() - done)};
+        bool const last{done + len == raw.size()};
+        zlib.insert(zlib.end(), {static_cast<uint8_t>(last),
+                                 static_cast<uint8_t>(len), static_cast<uint8_t>(len >> 8),
+                                 static_cast<uint8_t>(~len), static_cast<uint8_t>(~len >> 8)});
+        zlib.insert(zlib.end(), raw.begin() + done, raw.begin() + done + len);
+        done += len;
+    } while (done < raw.size());
+    putBigEndian(zlib, adler32(raw));
+    writeChunk(out, "IDAT", zlib);
+    writeChunk(out, "IEND", {});
+    return static_cast<bool>(out);
+}
+
+/**
+ * @brief Picks the format from the extension - .pbm or .png
+ */
+bool MonoImage::write(std::filesystem::path const &path) const
+{
+    auto const ext{path.extension()};
+    if (ext == ".pbm")
+    {
+        return writePbm(path);
+    }
+    if (ext == ".png")
+    {
+        return writePng(path);
+    }
+    return false;
+}
+
+MonoImage imageDriver::image() const
+{
+    MonoImage img;
+    img.paste(buffer, 0, 0);
+    return img;
+}
+
+bool imageDriver::write(std::filesystem::path const &path) const
+{
+    return image().write(path);
+}
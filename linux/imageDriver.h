@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cinttypes>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "dimensions.h"
+#include "frameBuffer.h"
+#include "frameDriver.h"
+
+/**
+ * @brief A 1-bpp, row-major, MSB first image with a set bit for ink. This is the layout
+ * both PBM and PNG want so a FrameBuffer (column-major) is transposed once on the way in
+ * and the rows are written out as they are. It's also big enough to hold a contact sheet
+ * of many frames.
+ */
+class MonoImage
+{
+public:
+    explicit MonoImage(size_t width = WIDTH, size_t height = HEIGHT);
+    void set(size_t x, size_t y);
+    bool at(size_t x, size_t y) const;
+    void paste(FrameBuffer const &frame, size_t x, size_t y);
+    void border(size_t x, size_t y, size_t width, size_t height);
+    bool writePbm(std::filesystem::path const &path) const;
+    bool writePng(std::filesystem::path const &path) const;
+    bool write(std::filesystem::path const &path) const;
+    size_t width() const { return imageWidth; }
+    size_t height() const { return imageHeight; }
+    std::vector<uint8_t> const &rows() const { return bits; }
+
+private:
+    size_t imageWidth;
+    size_t imageHeight;
+    size_t stride;
+    std::vector<uint8_t> bits;
+};
+
+/**
+ * @brief PNG and zlib need a CRC-32 (ISO 3309) and an Adler-32 checksum. Both take a
+ * running value so a chunk can be checksummed in pieces.
+ */
+uint32_t crc32(std::span<const uint8_t> data, uint32_t crc = 0);
+uint32_t adler32(std::span<const uint8_t> data, uint32_t adler = 1);
+
+/**
+ * @brief A headless displayDriver for linux. It renders into memory like frameDriver and
+ * writes the finished frame out as a PBM or PNG image so quotes can be checked without
+ * an X server.
+ */
+class imageDriver : public frameDriver
+{
+public:
+    explicit imageDriver() = default;
+    MonoImage image() const;
+    bool write(std::filesystem::path const &path) const;
+    ~imageDriver() override {};
+};
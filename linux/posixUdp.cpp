@@ -0,0 +1,80 @@
+#include <chrono>
+#include <string>
+#include <thread>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "posixUdp.h"
+
+/**
+ * @brief Looks host up and connects a socket to it, so the kernel drops datagrams from
+ * anywhere else
+ */
+bool posixUdp::open(char const *host, uint16_t port)
+{
+    close();
+    addrinfo hints{};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    addrinfo *found{nullptr};
+    if (getaddrinfo(host, std::to_string(port).c_str(), &hints, &found) != 0 || found == nullptr)
+    {
+        return false;
+    }
+    fd = socket(found->ai_family, found->ai_socktype, found->ai_protocol);
+    bool const connected{fd >= 0 && connect(fd, found->ai_addr, found->ai_addrlen) == 0};
+    freeaddrinfo(found);
+    if (!connected)
+    {
+        close();
+    }
+    return connected;
+}
+
+bool posixUdp::send(std::span<const uint8_t> bytes)
+{
+    return fd >= 0 && ::send(fd, bytes.data(), bytes.size(), 0) == static_cast<ssize_t>(bytes.size());
+}
+
+std::pair<bool, UdpTransport::Datagram> posixUdp::receive(std::span<uint8_t> bytes, uint32_t timeoutMs)
+{
+    pollfd waiting{.fd = fd, .events = POLLIN, .revents = 0};
+    if (fd < 0 || poll(&waiting, 1, static_cast<int>(timeoutMs)) != 1)
+    {
+        return {false, {}};
+    }
+    auto const size{recv(fd, bytes.data(), bytes.size(), 0)};
+    auto const atUs{nowUs()};
+    if (size < 0)
+    {
+        return {false, {}};
+    }
+    return {true, {static_cast<size_t>(size), atUs}};
+}
+
+void posixUdp::close()
+{
+    if (fd >= 0)
+    {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+uint64_t posixUdp::nowUs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+void posixUdp::sleep(uint32_t ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+posixUdp::~posixUdp()
+{
+    close();
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cinttypes>
+#include <span>
+#include <utility>
+#include "udpTransport.h"
+
+/**
+ * @brief UdpTransport over a POSIX socket, timed by the steady clock - so SntpClient can
+ * be run on the host against a real server or a fake one on the loopback
+ */
+class posixUdp : public UdpTransport
+{
+public:
+    explicit posixUdp() = default;
+    bool open(char const *host, uint16_t port) override;
+    bool send(std::span<const uint8_t> bytes) override;
+    std::pair<bool, Datagram> receive(std::span<uint8_t> bytes, uint32_t timeoutMs) override;
+    void close() override;
+    uint64_t nowUs() override;
+    void sleep(uint32_t ms) override;
+    ~posixUdp() override;
+
+private:
+    int fd{-1};
+};
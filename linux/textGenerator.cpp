@@ -29,10 +29,13 @@ constexpr auto INCLUDE_DIRECTORY{"/home/nick/Documents"};
 constexpr auto INCLUDE_FILE{"timeQuotes"};
 constexpr auto INCLUDE_EXT{"h"};
 
+/// Byte-pair encode timeText (QuoteServer decodes one quote at a time into a small buffer)
+constexpr bool COMPRESS_TEXT{true};
+/// The number of pair codes available above 7-bit ASCII
+constexpr int PAIR_CODES{0x100 - 0x80};
+
 constexpr char TAB{static_cast<char>(0x09)};
-constexpr char LF{static_cast<char>(0x0A)};
-constexpr char CR{static_cast<char>(0x0D)};
-//constexpr char EOT{static_cast<char>(0x00)};
+// LF, CR and EOT come from dimensions.h
 
 #include <iostream>
 #include <string>
@@ -44,9 +47,15 @@ constexpr char CR{static_cast<char>(0x0D)};
 #include <vector>
 #include <ctype.h>
 #include <map>
+#include <iomanip>
+#include <array>
 
 #include "../headers/picoDatetime.h"
 #include "../headers/asset.h"
+#include "../headers/fontServer.h"
+#include "../headers/fontRegistry.h"
+#include "../headers/fitEngine.h"
+#include "../headers/styleSheets.h"
 
 struct timeText
 {
@@ -56,6 +65,8 @@ struct timeText
 	std::string text;
 	std::string source;
 	std::string author;
+	/// Set by cleanText if the text has bold markup
+	bool bold{false};
 };
 
 uint16_t hashTime(datetime_t dt)
@@ -132,28 +143,38 @@ bool cleanText(std::vector<timeText> &items)
 
 	bool bad{false};
 	int row {0};
+	// The credits are drawn in the same fonts as the quote so they are cleaned the same way.
+	// True if the text has bold markup, so the fit needn't search for it
+	auto const clean{[&](std::string &text)
+					 {
+						 bool bold{false};
+						 for (size_t i{0}; i < text.size(); i++)
+						 {
+							 char c{text.at(i)};
+							 bold = bold || c == boldOn;
+							 //std::cout << c << " " ;
+							 if ((c < ' ' || c > '~') && c != CR && c != LF)
+							 {
+								 if (badChars.contains((uint8_t)c))
+								 {
+									 text.at(i) = badChars.at(c);
+									 std::cout << "Row " << row  << " Bad " << c << " (" << (int) c << ") replaced with " << text.at(i) << std::endl;
+								 }
+								 else
+								 {
+									 text.at(i) = ' ';
+									 std::cout << "Row " << row  << " " << " Unknown: " << c << " (" << (int) c << ") replaced with space" << std::endl;
+									 bad = true;
+								 }
+							 }
+						 }
+						 return bold; }};
 	for (auto &item : items)
 	{
 		row++;
-		for (size_t i{0}; i < item.text.size(); i++)
-		{
-			char c{item.text.at(i)};
-			//std::cout << c << " " ;
-			if ((c < ' ' || c > '~') && c != CR && c != LF)
-			{
-				if (badChars.contains((uint8_t)c))
-				{
-					item.text.at(i) = badChars.at(c);
-					std::cout << "Row " << row  << " Bad " << c << " (" << (int) c << ") replaced with " << item.text.at(i) << std::endl;
-				}
-				else
-				{
-					item.text.at(i) = ' ';
-					std::cout << "Row " << row  << " " << " Unknown: " << c << " (" << (int) c << ") replaced with space" << std::endl;
-					bad = true;
-				}
-			}
-		}
+		item.bold = clean(item.text);
+		clean(item.source);
+		clean(item.author);
 	}
 	return !bad;
 }
@@ -218,6 +239,10 @@ std::string assetDetails(const std::vector<Asset> &qDefs)
 	{
 		ds << "\t{" << (int)q.Key << ", " << (int)q.Index
 		   << ", " << (int)q.FontId << ", " << (int)q.Style
+		   << ", " << (int)q.Length << ", " << (int)q.LineIndex << ", " << (int)q.LineCount
+		   << ", " << (int)q.MarkerStart << ", " << (int)q.MarkerLength
+		   << ", " << (int)q.Title << ", " << (int)q.Author
+		   << ", " << (q.Bold ? "true" : "false")
 		   << "},\n";
 	}
 	ds << "};\n\n";
@@ -225,6 +250,42 @@ std::string assetDetails(const std::vector<Asset> &qDefs)
 	return ds.str();
 }
 
+/// <summary>Generates the minute -> (first asset, count) table. qDefs must be sorted by key</summary>
+/// <param name="qDefs">A std::vector<Asset> containing the details of the quotes included in generated include file</param>
+/// <returns>The definition of timeMinutes with MINUTES_PER_DAY entries</returns>
+std::string minuteDetails(const std::vector<Asset> &qDefs)
+{
+	std::vector<MinuteIndex> minutes(MINUTES_PER_DAY, MinuteIndex{0, 0});
+	for (uint32_t i{0}; i < qDefs.size(); i++)
+	{
+		auto &m{minutes.at(qDefs.at(i).Key)};
+		if (m.Count == 0)
+		{
+			m.First = i;
+		}
+		m.Count++;
+	}
+
+	std::stringstream ds;
+	ds << "\n///Definition of the array of MinuteIndex structs (one per minute of the day)\n";
+	ds << "const MinuteIndex timeMinutes[] \n{";
+	for (size_t key{0}; key < minutes.size(); key++)
+	{
+		if (key % 60 == 0)
+		{
+			ds << "\n\t/* " << std::setw(2) << std::setfill('0') << key / 60 << ":00 */\n\t";
+		}
+		else if (key % 6 == 0)
+		{
+			ds << "\n\t";
+		}
+		ds << "{" << minutes.at(key).First << ", " << minutes.at(key).Count << "}, ";
+	}
+	ds << "\n};\n\n";
+
+	return ds.str();
+}
+
 /// <summary> Generates the definitions for the asset structs </summary>
 /// <param name="quotes">A std::vector<std::string> containing quotes with NewLine characters '\n' making the line endings</param>
 /// <returns>The defitions followed by the definition of the overall asset stack to use
@@ -291,8 +352,266 @@ std::string assetDefinitions(const std::vector<std::string> &quotes)
 	return ss.str();
 }
 
+/// <summary>The fonts, and the fit engine, textGenerator lays quotes out with. These are the
+/// same classes LayoutServer uses so the stored font and breaks match the runtime exactly</summary>
+FontRegistry &fontRegistry()
+{
+	static FontRegistry fonts;
+	return fonts;
+}
+
+/// <summary>Picks the largest font the quote fits the panel in with the quote style</summary>
+/// <param name="text">The (uncompressed) quote</param>
+/// <param name="marker">The time marker from findMarker (set in the bold face)</param>
+/// <param name="bold">True if the text has bold markup</param>
+/// <returns>The font and line count (Fits is false if the quote overflows in the smallest font,
+/// Footer false if it only fits without the credits)</returns>
+Fit fitQuote(std::string const &text, TextSpan marker, bool bold)
+{
+	// The same room LayoutServer leaves the quote above the credits footer
+	static FitEngine fitter(fontRegistry(), quoteStyle, WIDTH, HEIGHT,
+							FitEngine::lineHeight(fontRegistry().fontFor(footerStyle.fontId), footerStyle));
+	return fitter.fit(text, marker, bold);
+}
+
+/// <summary>Wraps a quote exactly as LayoutServer would in the given font and records the end of
+/// each line so the runtime doesn't have to measure anything</summary>
+/// <param name="text">The (uncompressed) quote</param>
+/// <param name="font">The font from fitQuote</param>
+/// <param name="marker">The time marker from findMarker (set in the bold face)</param>
+/// <param name="breaks">The line ends are appended to this</param>
+/// <returns>The number of lines</returns>
+size_t appendBreaks(std::string const &text, FontId font, TextSpan marker, std::vector<uint16_t> &breaks)
+{
+	FontServer &fs{fontRegistry().fontFor(font)};
+	size_t lines{0};
+	fs.wrap(
+		text, WIDTH, [&](size_t, size_t end)
+		{
+			breaks.push_back(static_cast<uint16_t>(end));
+			lines++; },
+		marker);
+	return lines;
+}
+
+/// <summary>Finds the phrase that names the time so LayoutServer can highlight it without
+/// searching. The marker column is matched regardless of case, as checkMarkers does. If the
+/// marker is empty or isn't in the text the time written in figures (9:07, 09:07 or 9.07)
+/// is tried instead, and failing that the quote has no marker and is drawn plain</summary>
+/// <param name="item">The cleaned item</param>
+/// <param name="fromFigures">Set true if the marker was found by the figures fallback</param>
+/// <returns>The offset and length of the phrase in the text, Length zero if it wasn't found</returns>
+TextSpan findMarker(timeText const &item, bool &fromFigures)
+{
+	auto const upper{[](std::string s)
+					 {
+						 std::transform(s.begin(), s.end(), s.begin(), ::toupper);
+						 return s;
+					 }};
+	auto const span{[&](size_t pos, size_t length)
+					{
+						bool const fits{pos + length <= UINT16_MAX && length <= UINT8_MAX};
+						return fits ? TextSpan{static_cast<uint16_t>(pos), static_cast<uint16_t>(length)} : TextSpan{};
+					}};
+	fromFigures = false;
+	std::string const text{upper(item.text)};
+	if (!item.marker.empty())
+	{
+		if (auto const pos{text.find(upper(item.marker))}; pos != std::string::npos)
+		{
+			return span(pos, item.marker.size());
+		}
+	}
+
+	int const hour12{(item.dt.hour % 12 == 0) ? 12 : item.dt.hour % 12};
+	std::stringstream mm;
+	mm << std::setw(2) << std::setfill('0') << static_cast<int>(item.dt.min);
+	std::stringstream hh;
+	hh << std::setw(2) << std::setfill('0') << static_cast<int>(item.dt.hour);
+	for (auto const &figures : {hh.str() + ":" + mm.str(), std::to_string(item.dt.hour) + ":" + mm.str(),
+								std::to_string(hour12) + ":" + mm.str(), std::to_string(hour12) + "." + mm.str()})
+	{
+		// Only whole numbers - 9:07 mustn't match inside 19:07 or 9:075
+		for (auto pos{text.find(figures)}; pos != std::string::npos; pos = text.find(figures, pos + 1))
+		{
+			size_t const end{pos + figures.size()};
+			if ((pos == 0 || !isdigit(text[pos - 1])) && (end == text.size() || !isdigit(text[end])))
+			{
+				fromFigures = true;
+				return span(pos, figures.size());
+			}
+		}
+	}
+	return TextSpan{};
+}
+
+/// <summary>Generates the definition of the line break table</summary>
+/// <param name="breaks">The end of every line of every quote</param>
+/// <returns>The definition of timeBreaks</returns>
+std::string breakDetails(const std::vector<uint16_t> &breaks)
+{
+	std::stringstream ds;
+	ds << "\n///The end of each line of each quote wrapped in the quote style font\n";
+	ds << "const uint16_t timeBreaks[] \n{";
+	for (size_t i{0}; i < breaks.size(); i++)
+	{
+		if (i % 16 == 0)
+		{
+			ds << "\n\t";
+		}
+		ds << breaks.at(i) << ", ";
+	}
+	ds << "\n};\n\n";
+
+	return ds.str();
+}
+
+/// <summary>Every distinct title and author, stored once. Offset zero is an empty string so
+/// an asset without a credit needs no flag</summary>
+struct CreditTable
+{
+	std::vector<char> text{'\0'};
+	std::map<std::string, uint16_t> offsets;
+	/// What storing the title and author with every quote would take
+	size_t raw{0};
+
+	/// <summary>Returns the offset of credit, adding it if it isn't in the table yet</summary>
+	uint16_t add(std::string const &credit)
+	{
+		raw += credit.size() + 1;
+		if (credit.empty())
+		{
+			return 0;
+		}
+		if (auto const found{offsets.find(credit)}; found != offsets.end())
+		{
+			return found->second;
+		}
+		if (text.size() + credit.size() + 1 > UINT16_MAX)
+		{
+			std::cout << "\t\tCredits table full - " << credit << " dropped\n\r";
+			return 0;
+		}
+		auto const offset{static_cast<uint16_t>(text.size())};
+		text.insert(text.end(), credit.begin(), credit.end());
+		text.push_back('\0');
+		offsets.emplace(credit, offset);
+		return offset;
+	}
+};
+
+/// <summary>Generates the definition of the credits table, one credit per line</summary>
+/// <param name="credits">The table built while the assets were defined</param>
+/// <returns>The definition of timeCredits</returns>
+std::string creditDetails(CreditTable const &credits)
+{
+	std::stringstream ds;
+	ds << "\n///Every distinct title and author (NUL terminated) - Asset::Title and Asset::Author are offsets into this\n";
+	ds << "const char timeCredits[] \n{\n\t";
+	for (auto const c : credits.text)
+	{
+		// as escapes so a byte above 0x7f doesn't narrow into a signed char
+		ds << "'\\x" << std::hex << static_cast<int>(static_cast<uint8_t>(c)) << "', ";
+		if (c == '\0')
+		{
+			ds << "\n\t";
+		}
+	}
+	ds << std::dec << "\n};\n\n";
+
+	return ds.str();
+}
+
+/// <summary>Byte-pair encodes the blocks in place. Each round replaces the most common adjacent
+/// pair (within a block, so every quote can be decoded on its own) with a new code until the
+/// codes run out or no pair would save anything. Codes that would nest deeper than
+/// MAX_PAIR_DEPTH are never created so the decoder's stack stays bounded</summary>
+/// <param name="blocks">One vector of bytes per quote (without the EOT)</param>
+/// <returns>The dictionary, two bytes per code starting at PAIR_BASE</returns>
+std::vector<uint8_t> pairEncode(std::vector<std::vector<uint8_t>> &blocks)
+{
+	std::vector<uint8_t> pairs;
+	std::vector<uint8_t> depth(0x100, 0);
+	std::vector<uint32_t> counts(0x10000);
+	for (int code{0}; code < PAIR_CODES; code++)
+	{
+		std::fill(counts.begin(), counts.end(), 0);
+		for (auto const &block : blocks)
+		{
+			for (size_t i{1}; i < block.size(); i++)
+			{
+				counts[(block[i - 1] << 8) | block[i]]++;
+			}
+		}
+
+		uint32_t best{0};
+		uint32_t bestCount{0};
+		for (uint32_t pair{0}; pair < counts.size(); pair++)
+		{
+			if (counts[pair] > bestCount && std::max(depth[pair >> 8], depth[pair & 0xFF]) < MAX_PAIR_DEPTH)
+			{
+				best = pair;
+				bestCount = counts[pair];
+			}
+		}
+		// A new code costs two bytes of dictionary
+		if (bestCount < 3)
+		{
+			break;
+		}
+
+		uint8_t const first{static_cast<uint8_t>(best >> 8)};
+		uint8_t const second{static_cast<uint8_t>(best & 0xFF)};
+		uint8_t const replacement{static_cast<uint8_t>(PAIR_BASE + code)};
+		pairs.push_back(first);
+		pairs.push_back(second);
+		depth[replacement] = std::max(depth[first], depth[second]) + 1;
+
+		for (auto &block : blocks)
+		{
+			size_t out{0};
+			for (size_t i{0}; i < block.size(); i++)
+			{
+				if (i + 1 < block.size() && block[i] == first && block[i + 1] == second)
+				{
+					block[out++] = replacement;
+					i++;
+				}
+				else
+				{
+					block[out++] = block[i];
+				}
+			}
+			block.resize(out);
+		}
+	}
+	return pairs;
+}
+
+/// <summary>Generates the definition of the byte-pair dictionary</summary>
+/// <param name="pairs">The dictionary from pairEncode</param>
+/// <returns>The definition of timePairs</returns>
+std::string pairDetails(const std::vector<uint8_t> &pairs)
+{
+	std::stringstream ds;
+	ds << "\n///Byte-pair dictionary: code 0x80 + n expands to timePairs[2n], timePairs[2n + 1]\n";
+	ds << "const uint8_t timePairs[] \n{";
+	for (size_t i{0}; i < pairs.size(); i += 2)
+	{
+		if (i % 16 == 0)
+		{
+			ds << "\n\t";
+		}
+		ds << "0x" << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(pairs.at(i))
+		   << ", 0x" << std::setw(2) << static_cast<int>(pairs.at(i + 1)) << ", " << std::dec;
+	}
+	ds << "\n};\n\n";
+
+	return ds.str();
+}
+
 /// <summary> Generates the definitions for the asset structs </summary>
-/// <param name="quotes">A vector<std::pair<int, std::string>> containing quotes and index numbers</param>
+/// <param name="quotes">A vector<std::pair<int, std::string>> containing quotes and index numbers sorted by time</param>
 /// <returns>The defitions followed by the definition of the overall asset stack to use
 /// in the calling application</returns>
 std::string assetAndIndexDefinitions(std::vector<timeText> const &items)
@@ -305,22 +624,68 @@ std::string assetAndIndexDefinitions(std::vector<timeText> const &items)
 	uint32_t index{0};
 	int cursorPos{0};
 
+	vector<vector<uint8_t>> blocks;
+	size_t rawSize{0};
+	for (auto const &item : items)
+	{
+		blocks.emplace_back(item.text.begin(), item.text.end());
+		rawSize += item.text.size() + 1;
+	}
+	vector<uint16_t> breaks;
+	map<FontId, size_t> fontCounts;
+	CreditTable credits;
+	// From the marker column, from the time in figures, not found
+	array<size_t, 3> markerCounts{};
+	size_t overflows{0};
+	// Quotes that only fit by taking the footer's room, so are drawn without credits
+	size_t uncredited{0};
+	vector<uint8_t> pairs;
+	if (COMPRESS_TEXT)
+	{
+		pairs = pairEncode(blocks);
+	}
+
 	ss << "\n///Definition of the array of chars forming the Assets\n";
 	ss << "const char timeText[]  \n{\n\t";
 
-	for (auto const &item : items)
+	for (size_t i{0}; i < items.size(); i++)
 	{
+		auto const &item{items.at(i)};
 		Asset qDef{0, 1, 0, 0};
 		qDef.Index = index;
 		qDef.Key = hashTime(item.dt);
+		qDef.Length = static_cast<uint16_t>(item.text.size());
+		qDef.LineIndex = static_cast<uint32_t>(breaks.size());
+		bool fromFigures{false};
+		TextSpan const marker{findMarker(item, fromFigures)};
+		qDef.MarkerStart = marker.Start;
+		qDef.MarkerLength = static_cast<uint8_t>(marker.Length);
+		qDef.Title = credits.add(item.source);
+		qDef.Author = credits.add(item.author);
+		markerCounts[marker.Length == 0 ? 2 : fromFigures ? 1 : 0]++;
+		qDef.Bold = item.bold;
+		Fit const fit{fitQuote(item.text, marker, item.bold)};
+		qDef.LineCount = static_cast<uint8_t>(appendBreaks(item.text, fit.Font, marker, breaks));
+		qDef.FontId = static_cast<uint8_t>(fit.Font);
+		fontCounts[fit.Font]++;
+		uncredited += fit.Fits && !fit.Footer ? 1 : 0;
+		if (!fit.Fits)
+		{
+			overflows++;
+			std::cout << "\t\tToo long for the panel at " << item.timeString << " (" << (int)fit.Lines << " lines)\n\r";
+		}
 		ss << "/*Key: " << std::dec << qDef.Key << " Index: " << std::dec << qDef.Index << std::hex << " */"
 		   << "\n\t";
-		for (auto const c : item.text)
+		for (auto const c : blocks.at(i))
 		{
 			if (c == NewLine)
 			{
 				ss << "0x0A, ";
 			}
+			else if (c >= PAIR_BASE)
+			{
+				ss << "'\\x" << hex << static_cast<int>(c) << "', ";
+			}
 			else
 			{
 				ss << "0x" << hex << static_cast<int>(c) << ", ";
@@ -346,9 +711,31 @@ std::string assetAndIndexDefinitions(std::vector<timeText> const &items)
 	ss << "};\n";
 
 	ss << assetDetails(qDefs);
-
-	ss << "\n/* AssetStack definition to add to application  */\n";
-	ss << "/* AssetStack stack{ timeText, timeAssets, " << dec << qDefs.size() << ", " << (int)index << "}; */\n\n";
+	ss << minuteDetails(qDefs);
+	ss << (pairs.empty() ? "\n///No byte-pair dictionary (timeText is plain)\nconst std::span<const uint8_t> timePairs{};\n\n"
+						 : pairDetails(pairs));
+	ss << breakDetails(breaks);
+	ss << creditDetails(credits);
+
+	ss << "\n///The AssetStack for the application\n";
+	ss << "const AssetStack timeStack{timeText, timeAssets, " << dec << qDefs.size() << ", " << (int)index
+	   << ", timeMinutes, timePairs, timeBreaks, timeCredits};\n\n";
+
+	std::cout << "\t\tText " << rawSize << " bytes -> " << index << " + " << pairs.size()
+			  << " bytes of pairs (" << 100.0 * (index + pairs.size()) / rawSize << "%)\n\r";
+	std::cout << "\t\t" << breaks.size() << " lines (" << breaks.size() * sizeof(uint16_t) << " bytes of line breaks)\n\r";
+	std::cout << "\t\tFonts fitted:";
+	for (auto const &[font, count] : fontCounts)
+	{
+		std::cout << " " << count << " x FontId " << static_cast<int>(font);
+	}
+	std::cout << " (" << overflows << " overflow, " << uncredited << " without credits)\n\r";
+	size_t const creditIndices{qDefs.size() * (sizeof(Asset::Title) + sizeof(Asset::Author))};
+	std::cout << "\t\tCredits " << credits.raw << " bytes -> " << credits.text.size() << " (" << credits.offsets.size()
+			  << " distinct) + " << creditIndices << " bytes of offsets ("
+			  << 100.0 * (credits.text.size() + creditIndices) / credits.raw << "%)\n\r";
+	std::cout << "\t\tTime markers: " << markerCounts[0] << " from the marker column, " << markerCounts[1]
+			  << " from the time in figures, " << markerCounts[2] << " not found (drawn plain)\n\r";
 
 	return ss.str();
 }
@@ -531,6 +918,44 @@ bool writeCleanedFile(std::vector<timeText> v, std::filesystem::path p)
 	return true;
 }
 
+/// <summary>Drops quotes too long for the panel even in the smallest font with no credits, as long
+/// as another quote covers the same minute. The only quote for a minute is kept and runs off the
+/// bottom of the panel rather than leave the minute to the clock face</summary>
+/// <param name="items">The quotes, sorted by minute</param>
+/// <returns>The number of overflowing quotes kept</returns>
+size_t dropOverflows(std::vector<timeText> &items)
+{
+	std::vector<bool> fits(items.size());
+	for (size_t i{0}; i < items.size(); i++)
+	{
+		bool fromFigures{false};
+		fits[i] = fitQuote(items[i].text, findMarker(items[i], fromFigures), items[i].bold).Fits;
+	}
+	std::vector<timeText> kept;
+	size_t overflows{0};
+	for (size_t first{0}; first < items.size();)
+	{
+		size_t last{first};
+		while (last < items.size() && hashTime(items[last].dt) == hashTime(items[first].dt))
+		{
+			last++;
+		}
+		bool const anyFits{std::find(fits.begin() + first, fits.begin() + last, true) != fits.begin() + last};
+		for (size_t i{first}; i < last; i++)
+		{
+			if (fits[i] || !anyFits)
+			{
+				overflows += fits[i] ? 0 : 1;
+				kept.push_back(std::move(items[i]));
+			}
+		}
+		first = last;
+	}
+	std::cout << "\t\t" << items.size() - kept.size() << " quotes too long for the panel dropped\n\r";
+	items = std::move(kept);
+	return overflows;
+}
+
 /* Debug only */
 void checkLengths(std::vector<timeText> items)
 {
@@ -579,6 +1004,14 @@ int main()
 		exit(EXIT_FAILURE);
 	};
 
+	// QuoteServer relies on all of the quotes for a minute being contiguous
+	std::stable_sort(items.begin(), items.end(), [](timeText const &a, timeText const &b)
+					 { return hashTime(a.dt) < hashTime(b.dt); });
+	if (auto const kept{dropOverflows(items)}; kept > 0)
+	{
+		std::cout << "\t\t" << kept << " quotes too long for the panel kept as the only quote for their minute\n\r";
+	}
+
 	auto intermediatePath{makePath(OUT_DIRECTORY, CLEANED_FILE, OUTPUT_EXT)};
 	if (writeCleanedFile(items, intermediatePath))
 	{
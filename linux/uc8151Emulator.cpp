@@ -0,0 +1,409 @@
+#include <algorithm>
+#include <charconv>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include "uc8151Emulator.h"
+#include "uc8151Defs.h"
+
+void uc8151Emulator::select(bool selected)
+{
+    touch();
+    this->selected = selected;
+}
+
+void uc8151Emulator::dataMode(bool data)
+{
+    touch();
+    isData = data;
+}
+
+/// @brief The lines belong to a background write until it ends
+void uc8151Emulator::touch()
+{
+    if (transferring)
+    {
+        misuse++;
+        writing();
+    }
+}
+
+/**
+ * @brief Takes bytes off the wire. A byte with D/C low starts a command and the bytes with
+ * D/C high that follow are its parameters, even across chip select toggles - that's how the
+ * driver streams DTM2 a column at a time. Nothing is seen while the controller is deselected
+ * or held in reset
+ */
+void uc8151Emulator::write(std::span<const uint8_t> bytes)
+{
+    touch();
+    clockNs += bytes.size() * nsPerByte;
+    feed(bytes);
+}
+
+void uc8151Emulator::feed(std::span<const uint8_t> bytes)
+{
+    if (!selected || !running)
+    {
+        return;
+    }
+    bytesSinceRefresh += bytes.size();
+    for (auto const value : bytes)
+    {
+        if (isData)
+        {
+            parameter(value);
+        }
+        else
+        {
+            begin(value);
+        }
+    }
+}
+
+/**
+ * @brief Answers a read. TSC gives the temperature as a whole number of degrees followed by
+ * the fraction; anything else reads as zero
+ */
+void uc8151Emulator::read(std::span<uint8_t> bytes)
+{
+    clockNs += bytes.size() * nsPerByte;
+    std::fill(bytes.begin(), bytes.end(), 0);
+    if (current == TSC && !bytes.empty())
+    {
+        bytes[0] = static_cast<uint8_t>(temperature);
+    }
+}
+
+void uc8151Emulator::reset(bool run)
+{
+    running = run;
+    if (!run)
+    {
+        current = 0xFF;
+        partialMode = false;
+        busyUntilNs = clockNs;
+    }
+}
+
+/**
+ * @brief BUSY is held for as long as the last refresh takes. Polling it while busy moves
+ * the clock on to the end of the refresh, as a busy wait would
+ */
+bool uc8151Emulator::busy()
+{
+    if (clockNs < busyUntilNs)
+    {
+        clockNs = busyUntilNs;
+        busyRaised = true;
+        return true;
+    }
+    return false;
+}
+
+void uc8151Emulator::sleep(uint32_t ms)
+{
+    clockNs += ms * 1'000'000ull;
+}
+
+/**
+ * @brief A background write takes as long as the bytes take to clock out at 12MHz, and
+ * they're read at the end, as DMA would
+ */
+void uc8151Emulator::startWrite(std::span<const uint8_t> bytes)
+{
+    touch();
+    transfer = bytes;
+    transferring = true;
+    transferDoneNs = clockNs + bytes.size() * nsPerByte;
+}
+
+/**
+ * @brief Polling a background write waits it out, as a spin on the DMA channel would
+ */
+bool uc8151Emulator::writing()
+{
+    if (!transferring)
+    {
+        return false;
+    }
+    clockNs = std::max(clockNs, transferDoneNs);
+    endTransfer();
+    return true;
+}
+
+void uc8151Emulator::endTransfer()
+{
+    transferring = false;
+    feed(transfer);
+}
+
+/**
+ * @brief Runs the clock on us microseconds, ending background writes and releasing BUSY as
+ * it reaches them and raising an event for each - the handler may start more of either
+ */
+void uc8151Emulator::advance(uint64_t us)
+{
+    auto const until{clockNs + us * 1000};
+    while (true)
+    {
+        bool const release{!busyRaised && busyUntilNs <= until && (!transferring || busyUntilNs <= transferDoneNs)};
+        if (transferring && transferDoneNs <= until && !release)
+        {
+            clockNs = std::max(clockNs, transferDoneNs);
+            endTransfer();
+        }
+        else if (release)
+        {
+            clockNs = std::max(clockNs, busyUntilNs);
+            busyRaised = true;
+        }
+        else
+        {
+            break;
+        }
+        if (event)
+        {
+            event();
+        }
+    }
+    clockNs = std::max(clockNs, until);
+}
+
+void uc8151Emulator::begin(uint8_t reg)
+{
+    current = reg;
+    index = 0;
+    commandLog.push_back({nowUs(), reg, {}});
+    switch (reg)
+    {
+    case DRF:
+        refresh();
+        break;
+    case PTIN:
+        partialMode = true;
+        break;
+    case PTOU:
+        partialMode = false;
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief One parameter byte for the current command. Image data goes straight to RAM - the
+ * whole of it in order, or just the PTL window (a column at a time) in partial mode
+ */
+void uc8151Emulator::parameter(uint8_t value)
+{
+    if (!commandLog.empty())
+    {
+        commandLog.back().data.push_back(value);
+    }
+    auto const at{index++};
+    switch (current)
+    {
+    case PSR:
+        if (at == 0)
+        {
+            psr = value;
+        }
+        break;
+    case PLL:
+        if (at == 0)
+        {
+            pll = value;
+        }
+        break;
+    case LUT_VCOM:
+    case LUT_WW:
+    case LUT_BW:
+    case LUT_WB:
+    case LUT_BB:
+        if (at < lutSize)
+        {
+            luts[current - LUT_VCOM][at] = value;
+        }
+        break;
+    case PTL:
+        if (at < ptl.size())
+        {
+            ptl[at] = value;
+        }
+        break;
+    case DTM1:
+    case DTM2:
+    {
+        auto &target{current == DTM1 ? oldRam : ram};
+        size_t offset{at};
+        if (partialMode)
+        {
+            size_t const firstByte{ptl[0] / 8u};
+            size_t const bytes{ptl[1] / 8u - firstByte + 1};
+            size_t const firstColumn{static_cast<size_t>(ptl[2] << 8 | ptl[3])};
+            offset = (firstColumn + at / bytes) * columnBytes + firstByte + at % bytes;
+        }
+        if (offset < target.size())
+        {
+            target[offset] = value;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief The frame rate set by PLL. Unknown settings read as the 50Hz reset value
+ */
+uint32_t uc8151Emulator::frameRate() const
+{
+    switch (pll)
+    {
+    case HZ_29:
+        return 29;
+    case HZ_33:
+        return 33;
+    case HZ_40:
+        return 40;
+    case HZ_100:
+        return 100;
+    case HZ_200:
+        return 200;
+    case HZ_67:
+        return 67;
+    default:
+        return 50;
+    }
+}
+
+/**
+ * @brief How long a refresh holds BUSY. With the LUTs in OTP that is the panel's own slow
+ * waveform. With LUT_REG each LUT is 6 byte groups of a level byte, four phase lengths in
+ * frames and a repeat count, so a LUT runs for the sum of (phase lengths x repeats) frames;
+ * the longest LUT sets the time at the PLL frame rate
+ */
+uint64_t uc8151Emulator::refreshUs() const
+{
+    if (!lutFromRegisters())
+    {
+        return otpRefreshUs;
+    }
+    uint64_t frames{0};
+    for (auto const &lut : luts)
+    {
+        uint64_t lutFrames{0};
+        for (size_t group{0}; group + 6 <= lut.size(); group += 6)
+        {
+            uint64_t const phases{uint64_t{lut[group + 1]} + lut[group + 2] + lut[group + 3] + lut[group + 4]};
+            lutFrames += phases * lut[group + 5];
+        }
+        frames = std::max(frames, lutFrames);
+    }
+    return frames * 1'000'000 / frameRate();
+}
+
+/**
+ * @brief DRF - moves RAM to the glass (all of it, or the PTL window in partial mode) and
+ * holds BUSY for the length of the waveform
+ */
+void uc8151Emulator::refresh()
+{
+    Rect window{Point(0, 0), Point(WIDTH - 1, HEIGHT - 1)};
+    if (partialMode)
+    {
+        uint_t const firstColumn{static_cast<uint_t>(ptl[2] << 8 | ptl[3])};
+        uint_t const lastColumn{static_cast<uint_t>(ptl[4] << 8 | ptl[5])};
+        window = Rect(Point(firstColumn, ptl[0]), Point(std::min<uint_t>(lastColumn, WIDTH - 1), std::min<uint_t>(ptl[1], HEIGHT - 1)));
+    }
+    for (size_t x{window.left()}; x <= window.right(); x++)
+    {
+        auto const from{x * columnBytes + window.top() / 8u};
+        auto const to{x * columnBytes + window.bottom() / 8u + 1};
+        std::copy(ram.begin() + from, ram.begin() + to, screen.data + from);
+    }
+    auto const busyUs{refreshUs()};
+    refreshLog.push_back({nowUs(), partialMode, window, bytesSinceRefresh, busyUs});
+    bytesSinceRefresh = 0;
+    busyUntilNs = clockNs + busyUs * 1000;
+    busyRaised = false;
+}
+
+/**
+ * @brief Writes the trace one command per line - the time in microseconds, the register
+ * and the parameters, all in hex
+ */
+bool uc8151Emulator::writeTrace(std::ostream &os) const
+{
+    for (auto const &command : commandLog)
+    {
+        os << std::hex << command.atUs << ' ' << std::setw(2) << std::setfill('0') << +command.reg;
+        if (!command.data.empty())
+        {
+            os << ' ';
+            for (auto const value : command.data)
+            {
+                os << std::setw(2) << +value;
+            }
+        }
+        os << std::dec << '\n';
+    }
+    return bool(os);
+}
+
+std::pair<bool, std::vector<uc8151Emulator::Command>> uc8151Emulator::readTrace(std::istream &is)
+{
+    std::vector<Command> commands;
+    std::string line;
+    while (std::getline(is, line))
+    {
+        std::istringstream fields(line);
+        Command command{};
+        unsigned reg{};
+        std::string hex;
+        if (!(fields >> std::hex >> command.atUs >> reg) || reg > 0xFF)
+        {
+            return {false, {}};
+        }
+        command.reg = static_cast<uint8_t>(reg);
+        fields >> hex;
+        if (hex.size() % 2 != 0)
+        {
+            return {false, {}};
+        }
+        for (size_t i{0}; i < hex.size(); i += 2)
+        {
+            uint8_t value{};
+            auto const [end, error]{std::from_chars(hex.data() + i, hex.data() + i + 2, value, 16)};
+            if (error != std::errc{} || end != hex.data() + i + 2)
+            {
+                return {false, {}};
+            }
+            command.data.push_back(value);
+        }
+        commands.push_back(std::move(command));
+    }
+    return {true, commands};
+}
+
+/**
+ * @brief Feeds a recorded trace back through the decoder as the driver sent it, waiting out
+ * BUSY before each command as the driver would
+ */
+void uc8151Emulator::replay(std::vector<Command> const &commands)
+{
+    select(true);
+    for (auto const &command : commands)
+    {
+        while (busy())
+        {
+        }
+        dataMode(false);
+        write({&command.reg, 1});
+        dataMode(true);
+        write(command.data);
+    }
+    select(false);
+}
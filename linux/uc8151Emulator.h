@@ -0,0 +1,122 @@
+#pragma once
+
+#include <array>
+#include <cinttypes>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <span>
+#include <vector>
+
+#include "dimensions.h"
+#include "geometry.h"
+#include "frameBuffer.h"
+#include "panelTransport.h"
+
+/**
+ * @brief A host-side UC8151 that sits behind PanelTransport in place of the pins. It decodes
+ * the command stream the driver sends - PSR, the LUTs, PLL, DTM1/DTM2, PTL/PTIN/PTOU and
+ * DRF - into display RAM and the "glass" (what the panel would show after each refresh),
+ * and keeps a simulated clock so the time spent clocking bytes out and waiting on BUSY can
+ * be measured. Every command is recorded so a session can be saved and replayed.
+ * Background writes stand in for DMA - the bytes are only read when the transfer ends, and
+ * touching the lines before then counts as a collision. advance() runs the clock on and
+ * raises the interrupts (write done, BUSY released) as it passes them.
+ */
+class uc8151Emulator : public PanelTransport
+{
+public:
+    /// One command as it went over the wire - the time it started and its parameters
+    struct Command
+    {
+        uint64_t atUs;
+        uint8_t reg;
+        std::vector<uint8_t> data;
+    };
+
+    /// One DRF - when it started, what it covered, the bytes sent since the last one and
+    /// how long BUSY was held
+    struct Refresh
+    {
+        uint64_t atUs;
+        bool partial;
+        Rect window;
+        size_t bytes;
+        uint64_t busyUs;
+    };
+
+    explicit uc8151Emulator() = default;
+
+    void select(bool selected) override;
+    void dataMode(bool data) override;
+    void write(std::span<const uint8_t> bytes) override;
+    void read(std::span<uint8_t> bytes) override;
+    void reset(bool run) override;
+    bool busy() override;
+    void sleep(uint32_t ms) override;
+    void startWrite(std::span<const uint8_t> bytes) override;
+    bool writing() override;
+    void onEvent(std::function<void()> event) override { this->event = std::move(event); }
+    ~uc8151Emulator() override {};
+
+    void advance(uint64_t us);
+    size_t collisions() const { return misuse; }
+
+    FrameBuffer const &glass() const { return screen; }
+    std::vector<Refresh> const &refreshes() const { return refreshLog; }
+    std::vector<Command> const &trace() const { return commandLog; }
+    uint64_t nowUs() const { return clockNs / 1000; }
+    bool lutFromRegisters() const { return (psr & lutReg) != 0; }
+    uint32_t frameRate() const;
+    uint64_t refreshUs() const;
+    void setTemperature(int8_t celsius) { temperature = celsius; }
+
+    bool writeTrace(std::ostream &os) const;
+    static std::pair<bool, std::vector<Command>> readTrace(std::istream &is);
+    void replay(std::vector<Command> const &commands);
+
+private:
+    void begin(uint8_t reg);
+    void parameter(uint8_t value);
+    void refresh();
+    void feed(std::span<const uint8_t> bytes);
+    void endTransfer();
+    void touch();
+
+    static constexpr uint8_t lutReg{0b00100000};
+    static constexpr uint64_t nsPerByte{8'000 / 12}; // 12MHz SPI clock
+    static constexpr uint64_t otpRefreshUs{4'500'000};
+    static constexpr size_t lutSize{44};
+    static constexpr size_t columnBytes{HEIGHT / 8};
+
+    bool selected{false};
+    bool isData{false};
+    bool running{true};
+    uint64_t clockNs{0};
+    uint64_t busyUntilNs{0};
+    size_t bytesSinceRefresh{0};
+    int8_t temperature{20};
+
+    // the background write in flight
+    std::span<const uint8_t> transfer;
+    bool transferring{false};
+    uint64_t transferDoneNs{0};
+    bool busyRaised{true};
+    size_t misuse{0};
+    std::function<void()> event;
+
+    // registers - the command being received, the parameters so far and what they set
+    uint8_t current{0xFF};
+    size_t index{0};
+    uint8_t psr{0};
+    uint8_t pll{0b00111100};
+    std::array<std::array<uint8_t, lutSize>, 5> luts{};
+    std::array<uint8_t, 7> ptl{};
+    bool partialMode{false};
+
+    std::array<uint8_t, FRAMEBUFFERSIZE> ram{};
+    std::array<uint8_t, FRAMEBUFFERSIZE> oldRam{};
+    FrameBuffer screen{};
+    std::vector<Refresh> refreshLog;
+    std::vector<Command> commandLog;
+};
@@ -40,6 +40,170 @@ void x11Driver::set(int x, int y)
     XPutPixel(image,x,y,0xFF);
 }
 
+/**
+ * @brief The image is row-major and MSB first so a glyph row can be shifted straight into
+ * the image a byte at a time. Bytes that would straddle an edge of the window go through set()
+ */
+void x11Driver::blit(int x, int y, std::span<const uint8_t> bitmap, uint_t width, uint_t height, uint_t stride)
+{
+    if (bitmap.size() < static_cast<size_t>(stride) * height)
+    {
+        return;
+    }
+    int const shift{x & 0b111};
+    for (uint_t r{0}; r < height; r++)
+    {
+        int const py{y + r};
+        if (py < 0 || py >= static_cast<int>(clock_window_height))
+        {
+            continue;
+        }
+        uint8_t *dest{row(py)};
+        for (uint_t i{0}; i < stride; i++)
+        {
+            uint8_t b{bitmap[r * stride + i]};
+            int const px{x + static_cast<int>(i * 8)};
+            if (px + 8 > static_cast<int>(width) + x)
+            {
+                // Mask off any padding bits beyond the bitmap width
+                b &= static_cast<uint8_t>(0xFF << (px + 8 - (static_cast<int>(width) + x)));
+            }
+            if (b == 0)
+            {
+                continue;
+            }
+            if (px >= 0 && px + 8 < static_cast<int>(clock_window_width))
+            {
+                dest[px >> 3] |= b >> shift;
+                if (shift != 0)
+                {
+                    dest[(px >> 3) + 1] |= static_cast<uint8_t>(b << (8 - shift));
+                }
+            }
+            else
+            {
+                for (int bit{0}; bit < 8; bit++)
+                {
+                    if ((b & (0b10000000 >> bit)) && px + bit >= 0 && px + bit < static_cast<int>(clock_window_width))
+                    {
+                        XPutPixel(image, px + bit, py, 0xFF);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Column-major glyphs have to be turned back into rows for the image, so this is a
+ * bit at a time but still writes straight into data rather than through XPutPixel
+ */
+void x11Driver::blitColumns(int x, int y, std::span<const uint8_t> columns, uint_t width, uint_t height, uint_t columnStride)
+{
+    if (columns.size() < static_cast<size_t>(columnStride) * width)
+    {
+        return;
+    }
+    for (uint_t col{0}; col < width; col++)
+    {
+        int const px{x + col};
+        if (px < 0 || px >= static_cast<int>(clock_window_width))
+        {
+            continue;
+        }
+        uint8_t const mask{static_cast<uint8_t>(0b10000000 >> (px & 0b111))};
+        for (uint_t r{0}; r < height; r++)
+        {
+            int const py{y + r};
+            if ((columns[col * columnStride + (r >> 3)] & (0b10000000 >> (r & 0b111))) &&
+                py >= 0 && py < static_cast<int>(clock_window_height))
+            {
+                row(py)[px >> 3] |= mask;
+            }
+        }
+    }
+}
+
+void x11Driver::span(int x, int y, int length)
+{
+    if (y < 0 || y >= static_cast<int>(clock_window_height))
+    {
+        return;
+    }
+    setBits(row(y), x, length, true);
+}
+
+void x11Driver::fill(Rect const &r)
+{
+    for (uint_t y{r.top()}; y <= r.bottom(); y++)
+    {
+        setBits(row(y), r.left(), r.width(), true);
+    }
+}
+
+void x11Driver::erase(Rect const &r)
+{
+    for (uint_t y{r.top()}; y <= r.bottom(); y++)
+    {
+        setBits(row(y), r.left(), r.width(), false);
+    }
+}
+
+/**
+ * @brief Transposes a column-major FrameBuffer frame into the row-major image
+ */
+void x11Driver::copy(std::span<const uint8_t, FRAMEBUFFERSIZE> frame)
+{
+    memset(data, 0, sizeof(data));
+    constexpr uint_t columnBytes{HEIGHT / 8};
+    for (uint_t i{0}; i < FRAMEBUFFERSIZE; i++)
+    {
+        uint8_t const b{frame[i]};
+        if (b == 0)
+        {
+            continue;
+        }
+        uint_t const x{static_cast<uint_t>(i / columnBytes)};
+        uint8_t const mask{static_cast<uint8_t>(0b10000000 >> (x & 0b111))};
+        for (uint8_t bit{0}; bit < 8; bit++)
+        {
+            if (b & (0b10000000 >> bit))
+            {
+                row((i % columnBytes) * 8 + bit)[x >> 3] |= mask;
+            }
+        }
+    }
+}
+
+uint8_t *x11Driver::row(int y)
+{
+    return reinterpret_cast<uint8_t *>(data) + y * bytes_per_row;
+}
+
+/**
+ * @brief Sets or clears length bits in an image row starting at x, a byte at a time where possible
+ */
+void x11Driver::setBits(uint8_t *r, int x, int length, bool on)
+{
+    int first{std::max(x, 0)};
+    int const last{std::min(x + length, static_cast<int>(clock_window_width))}; // exclusive
+    while (first < last)
+    {
+        int const bit{first & 0b111};
+        int const n{std::min(8 - bit, last - first)};
+        uint8_t const mask{static_cast<uint8_t>((0xFF >> bit) & (0xFF << (8 - bit - n)))};
+        if (on)
+        {
+            r[first >> 3] |= mask;
+        }
+        else
+        {
+            r[first >> 3] &= ~mask;
+        }
+        first += n;
+    }
+}
+
 // For testing we'll just copy the data locally...
 void x11Driver::update()
 {
@@ -281,6 +445,13 @@ pair<bool, XImage *> x11Driver::create_image(Display *d, Visual *v, int width, i
     auto img{XCreateImage(display, visual, depth, XYBitmap,
                           offset, data, width, height,
                           bitmap_pad, bytes_per_line)};
+    if (img != nullptr)
+    {
+        // Fix the bit order so the bulk operations can write glyph rows straight into data
+        img->bitmap_bit_order = MSBFirst;
+        img->byte_order = MSBFirst;
+        XInitImage(img);
+    }
     return {img != nullptr, img};
 }
 
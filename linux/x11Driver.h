@@ -43,6 +43,11 @@ constexpr int frames_per_second{1};
 using namespace std::chrono_literals;
 constexpr auto frame_period{std::chrono::nanoseconds(1s) / frames_per_second};
 
+/**
+ * @brief Bytes in each row of the (row-major, MSB first) XYBitmap image
+ */
+constexpr size_t bytes_per_row{clock_window_width / 8};
+
 /**
  * @brief Flags to limit our event subscriptions to expose events
  * This means we don't get keyboard or pointer events
@@ -61,6 +66,12 @@ public:
     void clear();
     void set(int x, int y);
     void update() override;
+    void blit(int x, int y, std::span<const uint8_t> bitmap, uint_t width, uint_t height, uint_t stride) override;
+    void blitColumns(int x, int y, std::span<const uint8_t> columns, uint_t width, uint_t height, uint_t columnStride) override;
+    void span(int x, int y, int length) override;
+    void fill(Rect const &r) override;
+    void erase(Rect const &r) override;
+    void copy(std::span<const uint8_t, FRAMEBUFFERSIZE> frame) override;
     ~x11Driver();
 
 private:
@@ -80,6 +91,8 @@ private:
     void wait(std::chrono::nanoseconds nano);
     TimePoint last_period(TimePoint last);
     bool eventLoop();
+    uint8_t *row(int y);
+    void setBits(uint8_t *row, int x, int length, bool on);
 
     /**
      * @brief Controls the event loop
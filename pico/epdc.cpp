@@ -2,19 +2,41 @@
 #include "hardware/rtc.h"
 #include "pico/stdlib.h"
 #include "pico/util/datetime.h"
+#include "hardware/sync.h"
+#include "pico/multicore.h"
 #include <iostream>
 #include <string>
 #include <ctime>
 
 #include "dimensions.h"
 #include "errorCodes.h"
-#include "ntpClient.h"
+#include "lwipUdp.h"
+#include "sntpClient.h"
 #include "topCat.h"
-#include "layoutServer.h"
+#include "renderPipeline.h"
 #include "uc8151.h"
+#include "picoTransport.h"
+#include "minuteScheduler.h"
+#include "bootTimeline.h"
+#include "persistedTime.h"
+#include "picoFlashSector.h"
+#include "driftModel.h"
+#include "civilTime.h"
 #include "debug.h"
 
+#define NTP_SERVER "pool.ntp.org"
+
 static volatile bool ntp_refresh;
+// set by the RTC alarm lead seconds before each minute, with the time it went off
+static volatile bool minuteDue;
+static volatile uint64_t alarmUs;
+// set when the panel has finished refreshing, with the time it finished
+static volatile bool refreshed;
+static volatile uint64_t refreshedUs;
+// core 1 renders the minutes core 0 asks for through this
+static RenderPipeline *renderer;
+// the RTC keeps UK time - this is the offset from UTC it was last set with
+static int32_t rtcOffset;
 
 std::ostream &operator<<(std::ostream &os, datetime_t dt)
 {
@@ -22,32 +44,173 @@ std::ostream &operator<<(std::ostream &os, datetime_t dt)
     return os;
 }
 
-void alrmCallback()
+/**
+ * @brief Core 1 does nothing but render - NTP, the RTC and the panel all stay on core 0
+ */
+void core1Main()
+{
+    // flash writes on core 0 park this core while XIP is off
+    multicore_lockout_victim_init();
+    while (true)
+    {
+        if (!renderer->renderNext())
+        {
+            tight_loop_contents();
+        }
+    }
+}
+
+/**
+ * @brief Puts the frame for minute in the panel's buffer and asks core 1 for the minute
+ * after so it's drawn while this one is on show
+ */
+void drawMinute(UC8151 &panel, datetime_t const &minute)
 {
-    ntp_refresh = true;
+    panel.copy(renderer->frameFor(minute).pixels);
+    renderer->release();
+    renderer->request(MinuteScheduler::minuteAfter(minute));
 }
 
-int wifiConnected()
+void minuteAlarm()
+{
+    alarmUs = time_us_64();
+    minuteDue = true;
+}
+
+void armMinuteAlarm(MinuteScheduler const &scheduler)
+{
+    datetime_t now;
+    rtc_get_datetime(&now);
+    datetime_t alarm{scheduler.nextAlarm(now)};
+    rtc_set_alarm(&alarm, minuteAlarm);
+}
+
+/**
+ * @brief Brings the radio up and starts joining the network without waiting for it - the
+ * connection comes up (polled from the main loop) while the panel shows the first frame
+ */
+bool wifiStarted()
 {
     if (auto err{cyw43_arch_init()}; err != pico_error::code::PICO_OK)
     {
         dbg("Failed to initialise cyw43 (" << pico_error::toString(err) << ")" << std::endl);
-        return err;
+        return false;
     }
     cyw43_arch_enable_sta_mode();
 
-    if (auto err{
-            cyw43_arch_wifi_connect_timeout_ms(WIFI_SSID, WIFI_PASSWORD, CYW43_AUTH_WPA2_AES_PSK, 10000)};
+    if (auto err{cyw43_arch_wifi_connect_async(WIFI_SSID, WIFI_PASSWORD, CYW43_AUTH_WPA2_AES_PSK)};
         err != pico_error::code::PICO_OK)
     {
-        dbg("Connect timeout (err=" << err << ")" << std::endl);
-        return err;
+        dbg("Unable to start connecting (err=" << err << ")" << std::endl);
+        return false;
+    }
+    return true;
+}
+
+bool wifiUp()
+{
+    return cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA) == CYW43_LINK_UP;
+}
+
+/**
+ * @brief Starts joining again if the last attempt gave up (no network, bad password...),
+ * at most every 30 seconds
+ */
+void wifiRetried()
+{
+    static uint64_t retryUs{0};
+    if (cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA) < 0 && time_us_64() >= retryUs)
+    {
+        dbg("Couldn't join " << WIFI_SSID << " - trying again" << std::endl);
+        cyw43_arch_wifi_connect_async(WIFI_SSID, WIFI_PASSWORD, CYW43_AUTH_WPA2_AES_PSK);
+        retryUs = time_us_64() + 30'000'000ull;
+    }
+}
+
+/**
+ * @brief The RTC's time as UTC seconds since 1970
+ */
+int64_t rtcUtc()
+{
+    datetime_t now;
+    rtc_get_datetime(&now);
+    return CivilTime::toSeconds(now) - rtcOffset;
+}
+
+/**
+ * @brief Sets the RTC to utc plus offset seconds
+ * @return the time it was set to
+ */
+datetime_t setRtc(int64_t utc, int32_t offset)
+{
+    rtcOffset = offset;
+    datetime_t local{CivilTime::fromSeconds(utc + rtcOffset)};
+    rtc_set_datetime(&local);
+    return local;
+}
+
+/**
+ * @brief Sets the RTC to UK time at utc
+ * @return the time it was set to
+ */
+datetime_t setRtc(int64_t utc)
+{
+    return setRtc(utc, TopCat::utcOffset(static_cast<time_t>(utc)));
+}
+
+/**
+ * @brief Waits for the RTC's seconds to tick over. The RTC only counts whole seconds, so
+ * this is the one moment its time is known to better than a second - both to measure it
+ * and to step it without moving where in the second it ticks
+ * @return when it ticked, on the microsecond clock, and its UTC seconds then
+ */
+std::pair<uint64_t, int64_t> rtcTick()
+{
+    auto const before{rtcUtc()};
+    int64_t now{before};
+    while (now == before)
+    {
+        now = rtcUtc();
     }
-    else
+    return {time_us_64(), now};
+}
+
+/**
+ * @brief Steps the RTC by the drift the model predicts since the last sync (whole seconds -
+ * all the RTC has) and in or out of summer time. Called lead seconds before a minute, so
+ * the offset is the one in force at that minute - the minute drawn next is the first of
+ * summer time, not the last of winter
+ * @return the time on the RTC now
+ */
+datetime_t disciplinedRtc(DriftModel &drift, uint64_t syncedUs, uint8_t lead)
+{
+    int64_t utc{rtcUtc()};
+    int32_t step{0};
+    if (syncedUs != 0)
     {
-        dbg("Connected to " << WIFI_SSID << "\n\r" << std::endl);
+        if (auto const due{drift.stepDue(static_cast<int64_t>(time_us_64() - syncedUs) / 1000)}; due != 0)
+        {
+            step = due / 1000;
+            drift.corrected(due);
+        }
     }
-    return PICO_OK;
+    auto const offset{TopCat::utcOffset(static_cast<time_t>(utc + step + lead))};
+    if (step != 0 || offset != rtcOffset)
+    {
+        return setRtc(rtcTick().second + step, offset);
+    }
+    return CivilTime::fromSeconds(utc + rtcOffset);
+}
+
+/**
+ * @brief Milliseconds (to the RTC's second) until the next minute alarm - zero as it goes off
+ */
+uint32_t msToAlarm(MinuteScheduler const &scheduler)
+{
+    datetime_t now;
+    rtc_get_datetime(&now);
+    int const alarmSecond{60 - scheduler.lead()};
+    return static_cast<uint32_t>((alarmSecond - now.sec + 60) % 60) * 1000;
 }
 
 int wifiDisconnected()
@@ -57,38 +220,84 @@ int wifiDisconnected()
     return 0;
 }
 
-ntp_result_t ntpLoop()
-{
-    ntpClient client;
-    return client.getNTPTime();
-}
+// An NTP sync is a burst of queries spread over passes of the main loop, one a pass and
+// ntpSpacingMs apart - servers rate limit anything closer (RFC 4330, ntpd's 2s minimum).
+// A pass blocks for a query (and the address lookup before the first), then the last up
+// to a second more to set the RTC on the tick, so it only runs when that fits before the
+// next minute alarm
+constexpr size_t ntpSamples{4};
+constexpr uint32_t ntpSpacingMs{2000};
+constexpr uint32_t ntpTimeoutMs{1000};
+constexpr uint32_t ntpWorstMs{lwipUdp::dnsTimeoutMs + ntpTimeoutMs + 1000};
 
-int ntp2rtc()
+/**
+ * @brief A burst of SNTP queries to the pool, taken a query at a time
+ */
+struct NtpBurst
 {
-    auto [status, time]{ntpLoop()};
-    if (status == PICO_OK)
+    lwipUdp udp;
+    SntpClient client{udp};
+    size_t queries{0};
+    std::pair<bool, SntpSample> best{false, {}};
+
+    bool running() const { return queries > 0; }
+
+    /**
+     * @brief One query, opening the socket for the first
+     * @return true once the burst is over, with best the sample with the shortest round trip
+     */
+    bool next()
     {
-        datetime_t starttime;
-        if (TopCat::toDateTime(&time, &starttime))
+        if (queries == 0)
+        {
+            best = {false, {}};
+            if (!udp.open(NTP_SERVER, SntpClient::port))
+            {
+                return true;
+            }
+            cyw43_arch_gpio_put(CYW43_WL_GPIO_LED_PIN, 1);
+        }
+        auto const [ok, sample]{client.query(ntpTimeoutMs)};
+        if (ok && (!best.first || sample.delayUs < best.second.delayUs))
         {
-            rtc_set_datetime(&starttime);
-            sleep_ms(10);
+            best = {true, sample};
         }
-        datetime_t setTime;
-        rtc_get_datetime(&setTime);
-        status = (setTime.hour == starttime.hour) && (setTime.min == starttime.min);
-        if (!status)
+        if (++queries < ntpSamples)
         {
-            dbg(setTime.hour << ":" << setTime.min << " != " << starttime.hour << ":" << starttime.min << std::endl);
+            return false;
         }
+        queries = 0;
+        udp.close();
+        cyw43_arch_gpio_put(CYW43_WL_GPIO_LED_PIN, 0);
+        if (best.first)
+        {
+            dbg("NTP offset " << best.second.offsetUs << "us, delay " << best.second.delayUs << "us, stratum "
+                              << static_cast<int>(best.second.stratum) << std::endl);
+        }
+        return true;
     }
-    return status;
+};
+
+/**
+ * @brief Sets the RTC from an NTP sample on the next UTC second, so it ticks with UTC
+ * rather than up to a second behind
+ * @return the time it was set to
+ */
+datetime_t setRtc(SntpSample const &sample)
+{
+    int64_t const second{sample.utcUs(time_us_64()) / 1'000'000 + 1};
+    sleep_until(from_us_since_boot(static_cast<uint64_t>(second * 1'000'000 - sample.offsetUs)));
+    return setRtc(second);
 }
 
-bool rtc_started()
+/**
+ * @brief Starts the RTC from the last time saved to flash, or an arbitrary default if there
+ * isn't one, so there's something to show before NTP answers
+ * @return the time the RTC was set to
+ */
+datetime_t rtcRestored(PersistedTime &persisted)
 {
     rtc_init();
-    dbg("Initialised RTC...\n");
     // Arbitrary default start of Sunday 19 Feb 23 09:00:00
     datetime_t t = {
         .year = 2023,
@@ -99,33 +308,14 @@ bool rtc_started()
         .min = 00,
         .sec = 00};
 
-    rtc_set_datetime(&t);
-    sleep_ms(10);
-
-    if (!rtc_running())
+    if (auto [saved, time]{persisted.load()}; saved)
     {
-        return false;
+        t = time;
     }
-
-    auto timeIsSet{ntp2rtc()};
-    int retryLimit{3};
-    while (!timeIsSet && retryLimit != 0)
-    {
-        dbg("Couldn't set time from NTP retrying in 5 seconds" << std::endl);
-        sleep_ms(5000);
-        timeIsSet = ntp2rtc();
-        retryLimit--;
-    }
-
-    if (!timeIsSet)
-    {
-        return false;
-    }
-
-    // Alarm once a day
-    datetime_t alarm{TopCat::day_alarm()};
-    rtc_set_alarm(&alarm, alrmCallback);
-    return rtc_running();
+    rtc_set_datetime(&t);
+    rtcOffset = TopCat::utcOffset(static_cast<time_t>(CivilTime::toSeconds(t)));
+    dbg("Initialised RTC at " << TopCat::toString(&t) << std::endl);
+    return t;
 }
 
 void printTime(datetime_t *dt)
@@ -140,55 +330,189 @@ void printTime(datetime_t *dt)
 int main()
 {
     stdio_init_all();
+    BootTimeline boot(time_us_64);
+    boot.mark("boot");
 
-    if (wifiConnected() != PICO_OK)
-    {
-        dbg("Unable to connect to wifi - exiting" << std::endl);
-        return EXIT_FAILURE;
-    }
+    // Nothing waits on the network: the first frame is drawn from the RTC (or the last time
+    // saved to flash) while wifi joins, and NTP corrects it when the link comes up
+    bool wifiStarting{wifiStarted()};
+    boot.mark("wifi started");
 
-    if (!rtc_started())
-    {
-        dbg("Unable to start RTC - exiting" << std::endl);
-        return EXIT_FAILURE;
-    }
+    picoFlashSector lastSector(0);
+    picoFlashSector sectorBefore(1);
+    PersistedTime persisted(lastSector, sectorBefore);
+    datetime_t const startTime{rtcRestored(persisted)};
+    boot.mark("rtc restored");
 
-    // Create a unq ptr to the driver. This is how we use same the
-    // library classes with the epd and with X11 (see desktop.cpp for the X11 app)
-    auto driver{std::make_unique<UC8151>()};
-    LayoutServer lo(std::move(driver));
+    // Frames are drawn on core 1 (the same library classes the X11 app uses - see
+    // desktop.cpp) and handed to the panel driver here on core 0
+    auto pipeline{std::make_unique<RenderPipeline>()};
+    renderer = pipeline.get();
+    multicore_launch_core1(core1Main);
+    renderer->request(startTime);
 
-    ntp_refresh = true;
-    datetime_t startTime;
+    UC8151 panel(std::make_unique<picoTransport>());
+    boot.mark("panel ready");
+    // the panel refreshes in the background - the frame goes out over DMA and BUSY wakes
+    // the main loop to finish it, so update() returns as soon as the frame has started
+    panel.setBlocking(false);
+    panel.onComplete([]()
+                     {
+                         refreshedUs = time_us_64();
+                         refreshed = true; });
+    MinuteScheduler scheduler;
+    uint64_t boundaryUs{0};
+    // NTP as often as the RTC's drift needs, with the radio off in between
+    DriftModel drift;
+    uint64_t syncedUs{0};
+    uint64_t syncDueUs{wifiStarting ? 0 : time_us_64() + 3'600'000'000ull};
 
     // This is only used if we want to track the drift between the pico rtc and ntp
     // it sets the epoch of the Topcat object at startup (only)
-    rtc_get_datetime(&startTime);
     TopCat topcat(startTime);
     dbg("Starting epdc at " << topcat.epoch().hour << ":" << topcat.epoch().min << std::endl);
 
+    // show the time now, then leave each minute to the alarm
+    drawMinute(panel, startTime);
+    refreshed = false;
+    panel.update();
+    boot.mark("first frame started");
+    armMinuteAlarm(scheduler);
+
+    ntp_refresh = wifiStarting;
+    uint64_t ntpNotBeforeUs{0};
+    NtpBurst ntp;
+    datetime_t shown{startTime};
+    bool booted{false};
+    // a flash write stops interrupts for tens of milliseconds, which would stall the DMA and
+    // BUSY handling of a refresh, so saving the time waits for the panel to be idle
+    bool saveDue{false};
+
     while (true)
     {
-        datetime_t newTime;
-        if (ntp_refresh)
+        // the panel's interrupts only stream the frame and wake the loop - the rest of the
+        // refresh, and the completion callback, run here
+        panel.poll();
+        if (refreshed)
+        {
+            refreshed = false;
+            if (!boot.at("first frame shown").first)
+            {
+                boot.mark("first frame shown");
+            }
+            else if (boundaryUs != 0)
+            {
+                scheduler.shown(static_cast<int32_t>((static_cast<int64_t>(refreshedUs) - static_cast<int64_t>(boundaryUs)) / 1000));
+            }
+        }
+        if (saveDue && panel.status() == UpdateStatus::idle)
+        {
+            saveDue = false;
+            datetime_t now;
+            rtc_get_datetime(&now);
+            persisted.save(now);
+        }
+        if (!booted && boot.at("first frame shown").first && (boot.at("ntp").first || !ntp_refresh))
+        {
+            booted = true;
+            boot.report(std::cout);
+        }
+        // not while the panel needs polling, nor so close to the alarm that the minute's
+        // refresh would start late
+        if (ntp_refresh && wifiUp() && time_us_64() >= ntpNotBeforeUs &&
+            panel.status() == UpdateStatus::idle && msToAlarm(scheduler) > ntpWorstMs)
         {
-            auto [status, ntpTime]{ntpLoop()};
-            if (status == PICO_OK)
+            if (!boot.at("wifi up").first)
+            {
+                boot.mark("wifi up");
+            }
+            if (!ntp.next())
             {
-                if (TopCat::toDateTime(&ntpTime, &newTime))
+                ntpNotBeforeUs = time_us_64() + ntpSpacingMs * 1000ull;
+            }
+            else if (auto const [ok, sample]{ntp.best}; ok)
+            {
+                ntp_refresh = false;
+                // what the RTC read as it last ticked, against the true time then
+                auto const [tickUs, clockUtc]{rtcTick()};
+                drift.synced(sample.utcUs(tickUs) / 1000, clockUtc * 1000, static_cast<int32_t>(sample.uncertaintyUs() / 1000 + 1));
+                datetime_t const newTime{setRtc(sample)};
+                syncedUs = time_us_64();
+                syncDueUs = syncedUs + drift.syncInterval() * 1'000'000ull;
+                wifiStarting = false;
+                wifiDisconnected();
+                saveDue = true;
+                if (!boot.at("ntp").first)
+                {
+                    boot.mark("ntp");
+                }
+                // the first frame may have been drawn from a stale time
+                if (!RenderPipeline::sameMinute(shown, newTime))
                 {
-                    ntp_refresh = false;
-                    datetime_t oldTime;
-                    rtc_get_datetime(&oldTime);
-                    rtc_set_datetime(&newTime);
-                    dbg("Drift is " << topcat.elapsed(newTime) << "s since " << topcat.epoch() << std::endl);
-                };
+                    shown = newTime;
+                    drawMinute(panel, shown);
+                    boundaryUs = 0;
+                    panel.update();
+                }
+                // the clock may have jumped past the alarm
+                armMinuteAlarm(scheduler);
+            }
+            else
+            {
+                dbg("Couldn't set time from NTP - retrying in 30 seconds" << std::endl);
+                ntpNotBeforeUs = time_us_64() + 30'000'000ull;
             }
         }
-        rtc_get_datetime(&newTime);
-        lo.timeIs(newTime);
-        sleep_ms(1000 * 60);
+        if (!minuteDue)
+        {
+            if (ntp_refresh && (!wifiUp() || ntp.running()))
+            {
+                // the lwip poll architecture only gets anywhere when it's polled, and the
+                // next query of a burst has no interrupt to wake the loop
+                wifiRetried();
+                cyw43_arch_poll();
+                sleep_ms(1);
+            }
+            else
+            {
+                // an alarm or panel interrupt between the checks above and __wfi would be
+                // slept through, so check again with interrupts off. A pending interrupt
+                // still wakes __wfi, and runs once they're back on
+                uint32_t const saved{save_and_disable_interrupts()};
+                if (!minuteDue && !panel.pollDue())
+                {
+                    __wfi();
+                }
+                restore_interrupts(saved);
+            }
+            continue;
+        }
+        minuteDue = false;
+
+        // lead seconds to go - fetch the coming minute from core 1 (normally drawn already),
+        // then start the refresh so it ends on the minute
+        datetime_t const now{disciplinedRtc(drift, syncedUs, scheduler.lead())};
+        auto const minute{MinuteScheduler::minuteAfter(now)};
+        boundaryUs = alarmUs + scheduler.lead() * 1'000'000ull;
+        drawMinute(panel, minute);
+        auto const toBoundary{(static_cast<int64_t>(boundaryUs) - static_cast<int64_t>(time_us_64())) / 1000};
+        sleep_ms(scheduler.startDelay(toBoundary, panel.refreshTime()));
+        refreshed = false;
+        panel.update();
+        shown = minute;
+
+        // bring the radio up when the next sync is due
+        if (!ntp_refresh && syncDueUs != 0 && time_us_64() >= syncDueUs)
+        {
+            wifiStarting = wifiStarted();
+            ntp_refresh = wifiStarting;
+            syncDueUs = wifiStarting ? 0 : time_us_64() + 3'600'000'000ull;
+        }
+        // keep the time in flash fresh enough for a power cut - every ten minutes is 144
+        // pages a day, or nine erases of the sector
+        saveDue = saveDue || minute.min % 10 == 0;
+        armMinuteAlarm(scheduler);
     }
 
     return EXIT_SUCCESS;
-}
\ No newline at end of file
+}
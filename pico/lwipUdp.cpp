@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include "lwipUdp.h"
+#include "debug.h"
+
+lwipUdp::Lookup lwipUdp::lookup;
+
+/**
+ * @brief Looks host up (from lwIP's cache if it can) and connects a pcb to it, so lwIP
+ * drops datagrams from anywhere else
+ */
+bool lwipUdp::open(char const *host, uint16_t port)
+{
+    close();
+    lookup.number++;
+    lookup.resolving = true;
+    lookup.resolved = false;
+    cyw43_arch_lwip_begin();
+    int const found{dns_gethostbyname(host, &lookup.address, dnsFound, reinterpret_cast<void *>(lookup.number))};
+    cyw43_arch_lwip_end();
+    if (found == ERR_OK)
+    {
+        lookup.resolved = true;
+    }
+    else if (found == ERR_INPROGRESS)
+    {
+        auto const deadline{make_timeout_time_ms(dnsTimeoutMs)};
+        while (lookup.resolving && absolute_time_diff_us(get_absolute_time(), deadline) > 0)
+        {
+            cyw43_arch_poll();
+        }
+    }
+    lookup.resolving = false;
+    if (!lookup.resolved)
+    {
+        dbg("Unable to resolve " << host << std::endl);
+        return false;
+    }
+    address = lookup.address;
+
+    cyw43_arch_lwip_begin();
+    pcb = udp_new_ip_type(IPADDR_TYPE_V4);
+    bool const connected{pcb != nullptr && udp_connect(pcb, &address, port) == ERR_OK};
+    if (connected)
+    {
+        udp_recv(pcb, received, this);
+    }
+    cyw43_arch_lwip_end();
+    if (!connected)
+    {
+        dbg("Unable to open a UDP pcb to " << ip4addr_ntoa(&address) << std::endl);
+        close();
+    }
+    return connected;
+}
+
+bool lwipUdp::send(std::span<const uint8_t> bytes)
+{
+    if (pcb == nullptr)
+    {
+        return false;
+    }
+    arrived = false;
+    cyw43_arch_lwip_begin();
+    pbuf *p{pbuf_alloc(PBUF_TRANSPORT, static_cast<u16_t>(bytes.size()), PBUF_RAM)};
+    bool sent{false};
+    if (p != nullptr)
+    {
+        std::memcpy(p->payload, bytes.data(), bytes.size());
+        sent = udp_send(pcb, p) == ERR_OK;
+        pbuf_free(p);
+    }
+    cyw43_arch_lwip_end();
+    return sent;
+}
+
+std::pair<bool, UdpTransport::Datagram> lwipUdp::receive(std::span<uint8_t> bytes, uint32_t timeoutMs)
+{
+    auto const deadline{make_timeout_time_ms(timeoutMs)};
+    while (!arrived && absolute_time_diff_us(get_absolute_time(), deadline) > 0)
+    {
+        cyw43_arch_poll();
+    }
+    if (!arrived)
+    {
+        return {false, {}};
+    }
+    arrived = false;
+    auto const size{std::min(datagramSize, bytes.size())};
+    std::copy_n(datagram.begin(), size, bytes.begin());
+    return {true, {size, datagramUs}};
+}
+
+void lwipUdp::close()
+{
+    if (pcb != nullptr)
+    {
+        cyw43_arch_lwip_begin();
+        udp_remove(pcb);
+        cyw43_arch_lwip_end();
+        pcb = nullptr;
+    }
+}
+
+uint64_t lwipUdp::nowUs()
+{
+    return time_us_64();
+}
+
+void lwipUdp::sleep(uint32_t ms)
+{
+    sleep_ms(ms);
+}
+
+/**
+ * @brief Callback - called by lwIP when the host has been looked up, or couldn't be
+ */
+void lwipUdp::dnsFound(const char *hostname, const ip_addr_t *ipaddr, void *arg)
+{
+    if (reinterpret_cast<uintptr_t>(arg) != lookup.number || !lookup.resolving)
+    {
+        // a lookup open() gave up on
+        return;
+    }
+    if (ipaddr != nullptr)
+    {
+        lookup.address = *ipaddr;
+        lookup.resolved = true;
+    }
+    lookup.resolving = false;
+}
+
+/**
+ * @brief Callback - called by lwIP with each datagram from the connected host. It's timed
+ * here, as near to its arrival as the poll loop allows
+ */
+void lwipUdp::received(void *arg, udp_pcb *pcb, pbuf *p, const ip_addr_t *addr, u16_t port)
+{
+    auto *udp{static_cast<lwipUdp *>(arg)};
+    udp->datagramUs = time_us_64();
+    udp->datagramSize = pbuf_copy_partial(p, udp->datagram.data(), static_cast<u16_t>(udp->datagram.size()), 0);
+    udp->arrived = true;
+    pbuf_free(p);
+}
+
+lwipUdp::~lwipUdp()
+{
+    close();
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "pico/stdlib.h"
+#include "pico/cyw43_arch.h"
+
+#include "lwip/dns.h"
+#include "lwip/pbuf.h"
+#include "lwip/udp.h"
+#include <array>
+#include <cinttypes>
+#include <span>
+#include <utility>
+#include "udpTransport.h"
+
+/**
+ * @brief UdpTransport over lwIP's raw API on the cyw43 radio. The arch is the poll one,
+ * so waiting (for DNS or a reply) means polling cyw43 - tightly, since a reply is only
+ * timestamped when its callback runs.
+ */
+class lwipUdp : public UdpTransport
+{
+public:
+    explicit lwipUdp() = default;
+    bool open(char const *host, uint16_t port) override;
+    bool send(std::span<const uint8_t> bytes) override;
+    std::pair<bool, Datagram> receive(std::span<uint8_t> bytes, uint32_t timeoutMs) override;
+    void close() override;
+    uint64_t nowUs() override;
+    void sleep(uint32_t ms) override;
+    ~lwipUdp() override;
+
+    /// The longest open() waits for the server's address
+    static constexpr uint32_t dnsTimeoutMs{10'000};
+
+private:
+
+    udp_pcb *pcb{nullptr};
+    ip_addr_t address{};
+    // The DNS lookup - resolving until the callback says how it went. lwIP can still call
+    // back after open() gives up waiting, when this object may be gone, so the state is
+    // static and the callback is passed its lookup's number; a stale one is ignored
+    struct Lookup
+    {
+        uintptr_t number{0};
+        bool resolving{false};
+        bool resolved{false};
+        ip_addr_t address{};
+    };
+    static Lookup lookup;
+    // the last datagram, filled in by the receive callback
+    std::array<uint8_t, 128> datagram{};
+    size_t datagramSize{0};
+    uint64_t datagramUs{0};
+    bool arrived{false};
+
+    static void dnsFound(const char *hostname, const ip_addr_t *ipaddr, void *arg);
+    static void received(void *arg, udp_pcb *pcb, pbuf *p, const ip_addr_t *addr, u16_t port);
+};
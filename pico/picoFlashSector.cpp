@@ -0,0 +1,25 @@
+#include <cstring>
+#include "picoFlashSector.h"
+
+void picoFlashSector::read(size_t offset, std::span<uint8_t> bytes)
+{
+    std::memcpy(bytes.data(), reinterpret_cast<uint8_t const *>(XIP_BASE + base + offset), bytes.size());
+}
+
+void picoFlashSector::erase()
+{
+    multicore_lockout_start_blocking();
+    auto const interrupts{save_and_disable_interrupts()};
+    flash_range_erase(base, FLASH_SECTOR_SIZE);
+    restore_interrupts(interrupts);
+    multicore_lockout_end_blocking();
+}
+
+void picoFlashSector::program(size_t offset, std::span<const uint8_t> bytes)
+{
+    multicore_lockout_start_blocking();
+    auto const interrupts{save_and_disable_interrupts()};
+    flash_range_program(base + offset, bytes.data(), bytes.size());
+    restore_interrupts(interrupts);
+    multicore_lockout_end_blocking();
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include "pico/stdlib.h"
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+#include "pico/multicore.h"
+#include <cinttypes>
+#include <span>
+#include "persistedTime.h"
+
+/**
+ * @brief FlashSector over one of the last sectors of the Pico's flash, well clear of the program.
+ * Reads come straight through XIP; erasing and programming stop XIP, so interrupts are off
+ * and core 1 is parked (it must have called multicore_lockout_victim_init) while they run.
+ */
+class picoFlashSector : public FlashSector
+{
+public:
+    /// fromEnd 0 is the last sector, 1 the one before it
+    explicit picoFlashSector(uint32_t fromEnd) : base{PICO_FLASH_SIZE_BYTES - (fromEnd + 1) * FLASH_SECTOR_SIZE} {}
+    void read(size_t offset, std::span<uint8_t> bytes) override;
+    void erase() override;
+    void program(size_t offset, std::span<const uint8_t> bytes) override;
+
+private:
+    uint32_t const base;
+    static_assert(FLASH_SECTOR_SIZE == sectorSize && FLASH_PAGE_SIZE == pageSize);
+};
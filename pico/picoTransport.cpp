@@ -0,0 +1,160 @@
+#include "picoTransport.h"
+
+picoTransport *picoTransport::instance{nullptr};
+
+picoTransport::picoTransport()
+{
+    // configure spi interface and pins
+    spi_init(spi0, 12'000'000);
+
+    gpio_set_function(DC, GPIO_FUNC_SIO);
+    gpio_set_dir(DC, GPIO_OUT);
+
+    gpio_set_function(CS, GPIO_FUNC_SIO);
+    gpio_set_dir(CS, GPIO_OUT);
+    gpio_put(CS, 1);
+
+    gpio_set_function(resetPin, GPIO_FUNC_SIO);
+    gpio_set_dir(resetPin, GPIO_OUT);
+    gpio_put(resetPin, 1);
+
+    gpio_set_function(busyPin, GPIO_FUNC_SIO);
+    gpio_set_dir(busyPin, GPIO_IN);
+    gpio_set_pulls(busyPin, true, false);
+
+    gpio_set_function(SCK, GPIO_FUNC_SPI);
+    gpio_set_function(MOSI, GPIO_FUNC_SPI);
+
+    // bytes from memory to the SPI data register, one per TX request
+    dmaChannel = dma_claim_unused_channel(true);
+    auto config{dma_channel_get_default_config(dmaChannel)};
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_8);
+    channel_config_set_read_increment(&config, true);
+    channel_config_set_write_increment(&config, false);
+    channel_config_set_dreq(&config, spi_get_dreq(spi0, true));
+    dma_channel_configure(dmaChannel, &config, &spi_get_hw(spi0)->dr, nullptr, 0, false);
+    instance = this;
+}
+
+picoTransport::~picoTransport()
+{
+    onEvent({});
+    dma_channel_unclaim(dmaChannel);
+    instance = nullptr;
+}
+
+void picoTransport::select(bool selected)
+{
+    gpio_put(CS, !selected);
+}
+
+void picoTransport::dataMode(bool data)
+{
+    gpio_put(DC, data);
+}
+
+void picoTransport::write(std::span<const uint8_t> bytes)
+{
+    spi_write_blocking(spi0, bytes.data(), bytes.size());
+}
+
+/**
+ * @brief Clocks the bytes in MSB first by hand with MOSI turned round as an input, then gives
+ * the pins back to the SPI block
+ */
+void picoTransport::read(std::span<uint8_t> bytes)
+{
+    gpio_set_function(SCK, GPIO_FUNC_SIO);
+    gpio_set_dir(SCK, GPIO_OUT);
+    gpio_set_function(MOSI, GPIO_FUNC_SIO);
+    gpio_set_dir(MOSI, GPIO_IN);
+    for (auto &byte : bytes)
+    {
+        byte = 0;
+        for (int bit{7}; bit >= 0; bit--)
+        {
+            gpio_put(SCK, true);
+            byte |= gpio_get(MOSI) << bit;
+            gpio_put(SCK, false);
+        }
+    }
+    gpio_set_function(SCK, GPIO_FUNC_SPI);
+    gpio_set_function(MOSI, GPIO_FUNC_SPI);
+}
+
+void picoTransport::reset(bool run)
+{
+    gpio_put(resetPin, run);
+}
+
+bool picoTransport::busy()
+{
+    tight_loop_contents();
+    return !gpio_get(busyPin);
+}
+
+void picoTransport::sleep(uint32_t ms)
+{
+    sleep_ms(ms);
+}
+
+void picoTransport::startWrite(std::span<const uint8_t> bytes)
+{
+    dma_channel_transfer_from_buffer_now(dmaChannel, bytes.data(), bytes.size());
+}
+
+/**
+ * @brief The DMA channel finishes when its last byte is in the SPI FIFO, so the SPI has to
+ * have drained too before chip select can be released
+ */
+bool picoTransport::writing()
+{
+    return dma_channel_is_busy(dmaChannel) || spi_is_busy(spi0);
+}
+
+void picoTransport::onEvent(std::function<void()> event)
+{
+    bool const enable{static_cast<bool>(event)};
+    this->event = std::move(event);
+    dma_channel_set_irq0_enabled(dmaChannel, enable);
+    if (enable)
+    {
+        irq_set_exclusive_handler(DMA_IRQ_0, dmaDone);
+    }
+    else if (irq_get_exclusive_handler(DMA_IRQ_0) == dmaDone)
+    {
+        irq_remove_handler(DMA_IRQ_0, dmaDone);
+    }
+    irq_set_enabled(DMA_IRQ_0, enable);
+    gpio_set_irq_enabled_with_callback(busyPin, GPIO_IRQ_EDGE_RISE, enable, busyReleased);
+}
+
+/**
+ * @brief A background write has finished. Waits out the few bytes left in the FIFO, throws
+ * away what was clocked in meanwhile (nothing reads it) and passes the event on
+ */
+void picoTransport::dmaDone()
+{
+    dma_channel_acknowledge_irq0(instance->dmaChannel);
+    while (spi_is_busy(spi0))
+    {
+        tight_loop_contents();
+    }
+    while (spi_is_readable(spi0))
+    {
+        (void)spi_get_hw(spi0)->dr;
+    }
+    spi_get_hw(spi0)->icr = SPI_SSPICR_RORIC_BITS;
+    if (instance->event)
+    {
+        instance->event();
+    }
+}
+
+void picoTransport::busyReleased(uint gpio, uint32_t events)
+{
+    if (instance && gpio == instance->busyPin && instance->event)
+    {
+        instance->event();
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include "pico/stdlib.h"
+#include "hardware/spi.h"
+#include "hardware/gpio.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include <cinttypes>
+#include <functional>
+#include <span>
+#include "panelTransport.h"
+
+/**
+ * @brief PanelTransport over the Pico SDK - spi0 at 12MHz plus the control pins from the
+ * Inky Pack schematic. Reads are bit-banged because the panel returns data on MOSI.
+ * Background writes go out on a DMA channel paced by the SPI TX request, and the end of
+ * one (DMA_IRQ_0) and BUSY going high (a GPIO edge) call the event handler.
+ */
+class picoTransport : public PanelTransport
+{
+public:
+    explicit picoTransport();
+    void select(bool selected) override;
+    void dataMode(bool data) override;
+    void write(std::span<const uint8_t> bytes) override;
+    void read(std::span<uint8_t> bytes) override;
+    void reset(bool run) override;
+    bool busy() override;
+    void sleep(uint32_t ms) override;
+    void startWrite(std::span<const uint8_t> bytes) override;
+    bool writing() override;
+    void onEvent(std::function<void()> event) override;
+    ~picoTransport() override;
+
+private:
+    // interface pins (from inkyPack Schematic)
+    uint CS{17};
+    uint DC{20};
+    uint SCK{18};
+    uint MOSI{19};
+    uint busyPin{26};
+    uint resetPin{21};
+
+    uint dmaChannel;
+    std::function<void()> event;
+    // the SDK's interrupt handlers are plain functions, so they find the transport here
+    static picoTransport *instance;
+    static void dmaDone();
+    static void busyReleased(uint gpio, uint32_t events);
+};
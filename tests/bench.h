@@ -0,0 +1,145 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Minimal timing helpers shared by the host benchmarks. Not used on the Pico.
+ */
+namespace bench
+{
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Calls f() `calls` times per run and returns the best mean (in nanoseconds per call)
+     * over `runs` runs. Taking the best run filters out scheduler noise on the host.
+     */
+    template <typename F>
+    double nsPerCall(F &&f, size_t calls, int runs = 5)
+    {
+        double best{0};
+        for (int r{0}; r < runs; r++)
+        {
+            auto start{Clock::now()};
+            for (size_t i{0}; i < calls; i++)
+            {
+                f();
+            }
+            std::chrono::duration<double, std::nano> ns{Clock::now() - start};
+            double mean{ns.count() / static_cast<double>(calls)};
+            best = (r == 0 || mean < best) ? mean : best;
+        }
+        return best;
+    }
+
+    /**
+     * @brief Swallows std::cout while in scope (LayoutServer's dbg output would otherwise
+     * dominate the timings)
+     */
+    class Quiet
+    {
+    public:
+        Quiet() : old{std::cout.rdbuf(&sink)} {}
+        ~Quiet() { std::cout.rdbuf(old); }
+
+    private:
+        struct NullBuffer : std::streambuf
+        {
+            int overflow(int c) override { return c; }
+        };
+        NullBuffer sink;
+        std::streambuf *old;
+    };
+
+    /**
+     * @brief Stops the compiler from optimising away a result that is never used
+     */
+    template <typename T>
+    inline void keep(T const &value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    /**
+     * @brief Collects named timings and writes them as JSON (for comparing runs across
+     * commits) or as a table (for reading)
+     */
+    class Report
+    {
+    public:
+        explicit Report(std::string_view suite, std::string_view label = "") : suite{suite}, label{label} {}
+
+        /// @brief Times f with nsPerCall and records the result under name
+        template <typename F>
+        double run(std::string_view name, F &&f, size_t calls, int runs = 5)
+        {
+            double ns{nsPerCall(f, calls, runs)};
+            results.push_back(Result{std::string(name), ns, calls, runs});
+            return ns;
+        }
+
+        void json(std::ostream &os) const
+        {
+            os << "{\n  \"suite\": \"" << escaped(suite) << "\",\n"
+               << "  \"label\": \"" << escaped(label) << "\",\n"
+               << "  \"compiler\": \"" << escaped(__VERSION__) << "\",\n"
+#ifdef NDEBUG
+               << "  \"optimised\": true,\n"
+#else
+               << "  \"optimised\": false,\n"
+#endif
+               << "  \"results\": [";
+            for (size_t i{0}; i < results.size(); i++)
+            {
+                auto const &r{results[i]};
+                os << (i == 0 ? "\n" : ",\n")
+                   << "    {\"name\": \"" << escaped(r.name) << "\", \"ns_per_call\": " << r.ns
+                   << ", \"calls\": " << r.calls << ", \"runs\": " << r.runs << "}";
+            }
+            os << "\n  ]\n}\n";
+        }
+
+        void table(std::ostream &os) const
+        {
+            for (auto const &r : results)
+            {
+                os << "  " << r.name << std::string(r.name.size() < 40 ? 40 - r.name.size() : 1, ' ')
+                   << r.ns << " ns\n\r";
+            }
+        }
+
+    private:
+        struct Result
+        {
+            std::string name;
+            double ns;
+            size_t calls;
+            int runs;
+        };
+        std::string suite;
+        std::string label;
+        std::vector<Result> results;
+
+        static std::string escaped(std::string_view s)
+        {
+            std::string out;
+            for (char const c : s)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    out.push_back('\\');
+                }
+                if (static_cast<unsigned char>(c) >= ' ')
+                {
+                    out.push_back(c);
+                }
+            }
+            return out;
+        }
+    };
+}
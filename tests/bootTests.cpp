@@ -0,0 +1,212 @@
+#include <iostream>
+#include <sstream>
+#include <cassert>
+#include <cstring>
+#include <algorithm>
+#include <array>
+#include <memory>
+
+#include "dimensions.h"
+#include "bootTimeline.h"
+#include "persistedTime.h"
+#include "layoutServer.h"
+#include "uc8151.h"
+#include "uc8151Emulator.h"
+
+/**
+ * @brief The pieces of the boot path that don't need the badge: the time kept in flash
+ * (against a sector that behaves like NOR flash), the phase timeline, and how long the
+ * panel driver takes from power up to the first frame on the panel emulator
+ */
+
+using namespace std;
+
+/// Erasing sets bits, programming can only clear them - like the real thing
+class fakeSector : public FlashSector
+{
+public:
+    array<uint8_t, sectorSize> bytes;
+    int erases{0};
+    int programs{0};
+    /// The power goes before anything is programmed
+    bool cut{false};
+
+    fakeSector() { bytes.fill(0xFF); }
+    void read(size_t offset, span<uint8_t> out) override
+    {
+        assert(offset + out.size() <= sectorSize);
+        copy_n(bytes.begin() + offset, out.size(), out.begin());
+    }
+    void erase() override
+    {
+        bytes.fill(0xFF);
+        erases++;
+    }
+    void program(size_t offset, span<const uint8_t> in) override
+    {
+        assert(offset % pageSize == 0 && in.size() == pageSize);
+        if (cut)
+        {
+            return;
+        }
+        for (size_t i{0}; i < in.size(); i++)
+        {
+            bytes[offset + i] &= in[i];
+        }
+        programs++;
+    }
+};
+
+datetime_t dateTime(int8_t day, int8_t hour, int8_t min)
+{
+    return {.year = 2023, .month = 2, .day = day, .dotw = 0, .hour = hour, .min = min, .sec = 0};
+}
+
+bool sameTime(datetime_t const &a, datetime_t const &b)
+{
+    return a.year == b.year && a.month == b.month && a.day == b.day && a.hour == b.hour && a.min == b.min;
+}
+
+void persistTest()
+{
+    cout << "persisted time - ";
+    fakeSector first;
+    fakeSector second;
+    {
+        PersistedTime persisted(first, second);
+        assert(!persisted.load().first);
+        assert(persisted.save(dateTime(19, 9, 0)));
+        assert(first.erases == 0);
+    }
+    // as after a power cut
+    {
+        PersistedTime persisted(first, second);
+        auto [saved, time]{persisted.load()};
+        assert(saved && sameTime(time, dateTime(19, 9, 0)));
+
+        // a sector is only erased once the saves come back round to it
+        for (int8_t min{1}; min <= 40; min++)
+        {
+            assert(persisted.save(dateTime(19, 9, min)));
+        }
+        assert(first.programs + second.programs == 41);
+        assert(first.erases == 1 && second.erases == 0);
+    }
+    {
+        PersistedTime persisted(first, second);
+        assert(sameTime(persisted.load().second, dateTime(19, 9, 40)));
+    }
+
+    // a torn save (the newest page half written) falls back to the one before
+    int8_t const pages{FlashSector::sectorSize / FlashSector::pageSize};
+    first.bytes[(40 % pages) * FlashSector::pageSize + 8] ^= 0x01;
+    {
+        PersistedTime persisted(first, second);
+        assert(sameTime(persisted.load().second, dateTime(19, 9, 39)));
+        // and the next save can't be programmed over it, so moves on to the other sector
+        assert(persisted.save(dateTime(19, 9, 41)));
+        assert(sameTime(persisted.load().second, dateTime(19, 9, 41)));
+        assert(second.erases == 1);
+    }
+    {
+        PersistedTime persisted(first, second);
+        assert(sameTime(persisted.load().second, dateTime(19, 9, 41)));
+
+        // fill the second sector, then lose the power after erasing the first
+        for (int8_t min{42}; min < 42 + pages - 1; min++)
+        {
+            assert(persisted.save(dateTime(19, 9, min)));
+        }
+        first.cut = true;
+        assert(!persisted.save(dateTime(19, 9, 57)));
+        assert(first.erases == 2);
+    }
+    {
+        first.cut = false;
+        PersistedTime persisted(first, second);
+        assert(sameTime(persisted.load().second, dateTime(19, 9, 56)));
+        assert(persisted.save(dateTime(19, 9, 57)));
+        assert(sameTime(persisted.load().second, dateTime(19, 9, 57)));
+    }
+    cout << "passed\n\r";
+}
+
+uint64_t fakeUs;
+
+uint64_t fakeClock()
+{
+    return fakeUs;
+}
+
+void timelineTest()
+{
+    cout << "boot timeline - ";
+    BootTimeline boot(fakeClock);
+    fakeUs = 1'000;
+    boot.mark("boot");
+    fakeUs = 26'500;
+    boot.mark("panel ready");
+    assert(boot.size() == 2);
+    auto [reached, us]{boot.at("panel ready")};
+    assert(reached && us == 26'500);
+    assert(!boot.at("ntp").first);
+
+    ostringstream os;
+    boot.report(os);
+    assert(os.str().find("26 +    25  panel ready") != string::npos);
+
+    // no more than it has room for
+    for (int i{0}; i < 20; i++)
+    {
+        boot.mark("again");
+    }
+    assert(boot.size() == 16);
+    cout << "passed\n\r";
+}
+
+uc8151Emulator *emulator;
+
+uint64_t emulatorClock()
+{
+    return emulator->nowUs();
+}
+
+/// @brief Power up to the first frame on the glass, with no waits that BUSY doesn't ask for
+void firstFrameTest()
+{
+    cout << "time to first frame - ";
+    auto transport{make_unique<uc8151Emulator>()};
+    emulator = transport.get();
+    BootTimeline boot(emulatorClock);
+    boot.mark("boot");
+
+    auto driver{make_unique<UC8151>(std::move(transport))};
+    auto &uc8151{*driver};
+    boot.mark("panel ready");
+    LayoutServer lo(std::move(driver));
+    uc8151.setBlocking(false);
+    lo.timeIs(dateTime(19, 9, 0));
+    boot.mark("first frame started");
+    while (uc8151.status() != UpdateStatus::idle)
+    {
+        emulator->advance(1'000);
+        uc8151.poll();
+    }
+    boot.mark("first frame shown");
+    assert(emulator->refreshes().size() == 1);
+
+    auto const ready{boot.at("panel ready").second - boot.at("boot").second};
+    auto const shown{boot.at("first frame shown").second - boot.at("boot").second};
+    assert(ready < 50'000);
+    // a clean refresh from the panel's own waveform
+    assert(shown < 5'000'000);
+    cout << ready / 1000 << "ms to panel ready, " << shown / 1000 << "ms to first frame - passed\n\r";
+}
+
+int main()
+{
+    persistTest();
+    timelineTest();
+    firstFrameTest();
+    return 0;
+}
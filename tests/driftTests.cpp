@@ -0,0 +1,111 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+
+#include "driftModel.h"
+
+/**
+ * @brief Runs DriftModel the way epdc does - sync, correct the RTC a second at a time each
+ * minute, sync again when the model says - against a clock 20ppm fast with a daily
+ * temperature swing, and compares it with the fixed daily sync it replaces
+ */
+
+using namespace std;
+
+void correctionTest()
+{
+    cout << "corrections - ";
+    DriftModel model;
+    model.synced(0, 0, 10);
+    assert(model.correctionDue(3'600'000) == 0);
+    // 4 hours on the clock has gained 288ms - 20ppm
+    model.synced(14'400'000, 14'400'288, 10);
+    assert(abs(model.ppm() - 20) < 1);
+    assert(model.correctionDue(50'000'000) == -1000 && model.stepDue(50'000'000) == -1000);
+    // under half a step isn't worth stepping a clock that only has seconds
+    assert(abs(model.correctionDue(20'000'000) + 400) <= 1 && model.stepDue(20'000'000) == 0);
+    model.corrected(-1000);
+    assert(model.correctionDue(50'000'000) == 0);
+    // a clock that has been set some other way isn't drift
+    auto const ppm{model.ppm()};
+    model.synced(28'800'000, 28'800'000 + 3'600'000, 10);
+    assert(model.ppm() == ppm);
+    cout << "passed\n\r";
+}
+
+struct Result
+{
+    double worstMs{0};
+    int syncs{0};
+};
+
+/**
+ * @brief 30 days a minute at a time; worst error and syncs over the last 28 days
+ * @param adaptive - the model's syncs and corrections, or a sync every 24 hours
+ */
+Result run(DriftModel &model, bool adaptive)
+{
+    constexpr int days{30};
+    constexpr double ppm{20};
+    constexpr double swingPpm{1};
+    mt19937 random{42};
+    uniform_real_distribution<double> ntpError{-20, 20};
+
+    Result result;
+    double clockMs{0};
+    int64_t lastSyncMs{0};
+    uint32_t interval{0};
+    for (int64_t trueMs{0}; trueMs < days * 86'400'000ll; trueMs += 60'000)
+    {
+        double const now{ppm + swingPpm * sin(2 * M_PI * static_cast<double>(trueMs) / 86'400'000)};
+        clockMs += 60'000 * (1 + now / 1e6);
+
+        bool const calibrated{trueMs >= 2 * 86'400'000ll};
+        if (calibrated)
+        {
+            result.worstMs = max(result.worstMs, abs(clockMs - static_cast<double>(trueMs)));
+        }
+        if (trueMs == 0 || trueMs - lastSyncMs >= (adaptive ? interval * 1000ll : 86'400'000ll))
+        {
+            model.synced(trueMs, llround(clockMs + ntpError(random)), 20);
+            interval = model.syncInterval();
+            clockMs = static_cast<double>(trueMs);
+            lastSyncMs = trueMs;
+            result.syncs += calibrated ? 1 : 0;
+        }
+        else if (adaptive)
+        {
+            // the RTC can only be stepped whole seconds
+            if (auto const step{model.stepDue(trueMs - lastSyncMs)}; step != 0)
+            {
+                clockMs += step;
+                model.corrected(step);
+            }
+        }
+    }
+    return result;
+}
+
+void scheduleTest()
+{
+    cout << "adaptive sync - ";
+    DriftModel dailyModel;
+    DriftModel model;
+    auto const daily{run(dailyModel, false)};
+    auto const adaptive{run(model, true)};
+    cout << adaptive.syncs << " syncs, worst " << lround(adaptive.worstMs) << "ms against "
+         << daily.syncs << " syncs, worst " << lround(daily.worstMs) << "ms once a day - ";
+    assert(adaptive.syncs <= daily.syncs);
+    // the model keeps the clock to the budget it schedules the syncs for
+    assert(adaptive.worstMs < daily.worstMs && adaptive.worstMs <= model.budget());
+    cout << "passed\n\r";
+}
+
+int main()
+{
+    correctionTest();
+    scheduleTest();
+    return 0;
+}
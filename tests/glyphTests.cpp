@@ -0,0 +1,408 @@
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <new>
+#include <string_view>
+#include <algorithm>
+#include <memory>
+
+#include "dimensions.h"
+#include "fontServer.h"
+#include "frameBuffer.h"
+#include "font112.h"
+#include "sans22.h"
+#include "sans24.h"
+#include "Sans18.h"
+#include "Sans20.h"
+#include "Nimbus.h"
+#include "fontRegistry.h"
+#include "frameDriver.h"
+#include "layoutServer.h"
+
+using namespace std;
+
+/**
+ * @brief Every call to the global operator new bumps this counter so we can prove that
+ * the glyph blit path doesn't touch the heap
+ */
+static size_t allocations{0};
+
+void *operator new(size_t size)
+{
+    allocations++;
+    if (void *p{malloc(size)}; p != nullptr)
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    free(p);
+}
+
+constexpr string_view sampleLine{"It was seven minutes after midnight. The dog was lying on the grass (12:07)"};
+
+/// @brief Checks that the view from bitmapFor holds exactly the bits that bitsFor vectorizes
+void viewMatchesVector(FontServer &fs, char const *name)
+{
+    cout << "bitmapFor matches bitsFor (" << name << ") - ";
+    for (char c{' '}; c <= '~'; c++)
+    {
+        auto view{fs.bitmapFor(c)};
+        auto v{fs.bitsFor(c)};
+        assert(view.Rows.size() * 8 == v.size());
+        size_t bit{0};
+        for (auto b : view.Rows)
+        {
+            for (uint8_t mask{0b10000000}; mask != 0; mask >>= 1)
+            {
+                assert(static_cast<bool>(b & mask) == v.at(bit++));
+            }
+        }
+    }
+    cout << "passed\n\r";
+}
+
+/// @brief Lays out a line with the original bitsFor path, one Point at a time
+void renderWithVectors(FontServer &fs, FrameBuffer &fb, string_view line, int x, int y)
+{
+    for (auto const c : line)
+    {
+        auto g{fs.glyphFor(c)};
+        auto v{fs.bitsFor(c)};
+        size_t widthInBits{static_cast<size_t>((g.bbw + 7) / 8) * 8};
+        int top{y - (g.bbh + g.bby)};
+        for (size_t i{0}; i < v.size(); i++)
+        {
+            int px{x + g.bbx + static_cast<int>(i % widthInBits)};
+            int py{top + static_cast<int>(i / widthInBits)};
+            if (v.at(i) && px >= 0 && px <= MAX_X && py >= 0 && py <= MAX_Y_BITS)
+            {
+                fb.set(Point(px, py));
+            }
+        }
+        x += g.DWidth;
+    }
+}
+
+/// @brief Lays out a line with the view and row blit path
+void renderWithViews(FontServer &fs, FrameBuffer &fb, string_view line, int x, int y)
+{
+    for (auto const c : line)
+    {
+        auto bits{fs.bitmapFor(c)};
+        auto const &g{bits.Glyph};
+        fb.blit(x + g.bbx, y - (g.bbh + g.bby), bits.Rows, g.bbw, g.bbh, bits.Stride);
+        x += g.DWidth;
+    }
+}
+
+/// @brief Lays out a line with the pre-transposed column blit path
+void renderWithColumns(FontServer &fs, FrameBuffer &fb, string_view line, int x, int y)
+{
+    for (auto const c : line)
+    {
+        auto bits{fs.bitmapFor(c)};
+        auto const &g{bits.Glyph};
+        fb.blitColumns(x + g.bbx, y - (g.bbh + g.bby), bits.Columns, g.bbw, g.bbh, bits.ColumnStride);
+        x += g.DWidth;
+    }
+}
+
+/// @brief Checks that every column byte holds the same bits as the rows it was transposed from
+void columnsMatchRows(FontServer &fs, char const *name)
+{
+    cout << "columns match rows (" << name << ") - ";
+    for (char c{' '}; c <= '~'; c++)
+    {
+        auto bits{fs.bitmapFor(c)};
+        auto const &g{bits.Glyph};
+        assert(bits.ColumnStride == (g.bbh + 7) / 8);
+        assert(bits.Columns.size() == static_cast<size_t>(bits.ColumnStride) * g.bbw);
+        for (size_t col{0}; col < g.bbw; col++)
+        {
+            for (size_t row{0}; row < static_cast<size_t>(bits.ColumnStride) * 8; row++)
+            {
+                bool const fromColumn{static_cast<bool>(bits.Columns[col * bits.ColumnStride + row / 8] & (0b10000000 >> (row % 8)))};
+                bool const fromRow{row < g.bbh && static_cast<bool>(bits.Rows[row * bits.Stride + col / 8] & (0b10000000 >> (col % 8)))};
+                assert(fromColumn == fromRow);
+            }
+        }
+    }
+    cout << "passed\n\r";
+}
+
+void blitMatchesVector(FontServer &fs, char const *name, int x, int y)
+{
+    cout << "blit matches bitsFor (" << name << " at " << x << "," << y << ") - ";
+    FrameBuffer expected;
+    FrameBuffer actual;
+    renderWithVectors(fs, expected, sampleLine, x, y);
+    renderWithViews(fs, actual, sampleLine, x, y);
+    for (size_t i{0}; i < FRAMEBUFFERSIZE; i++)
+    {
+        assert(expected.data[i] == actual.data[i]);
+    }
+    cout << "passed\n\r";
+}
+
+void columnBlitMatchesRowBlit(FontServer &fs, char const *name, int x, int y)
+{
+    cout << "column blit matches row blit (" << name << " at " << x << "," << y << ") - ";
+    FrameBuffer expected;
+    FrameBuffer actual;
+    renderWithViews(fs, expected, sampleLine, x, y);
+    renderWithColumns(fs, actual, sampleLine, x, y);
+    for (size_t i{0}; i < FRAMEBUFFERSIZE; i++)
+    {
+        assert(expected.data[i] == actual.data[i]);
+    }
+    cout << "passed\n\r";
+}
+
+void blitAllocates(FontServer &fs, char const *name)
+{
+    cout << "blit allocations (" << name << ") - ";
+    FrameBuffer fb;
+    size_t before{allocations};
+    for (int row{0}; row < 5; row++)
+    {
+        renderWithViews(fs, fb, sampleLine, 0, 20 + row * 24);
+        renderWithColumns(fs, fb, sampleLine, 0, 20 + row * 24);
+    }
+    size_t after{allocations};
+    assert(after == before);
+
+    // and the old path really did allocate, so the counter is live
+    renderWithVectors(fs, fb, sampleLine, 0, 20);
+    assert(allocations > after);
+    cout << (after - before) << " - passed\n\r";
+}
+
+/// @brief Checks the metrics fontGenerator stored in the font against a scan of every glyph
+void metricsMatchGlyphs(BdfFont const &font, char const *name)
+{
+    cout << "stored metrics match glyphs (" << name << ") - ";
+    assert(font.Widths != nullptr && font.MaxRise > 0);
+    int rise{0};
+    int drop{0};
+    for (int c{font.AsciiStart}; c <= font.AsciiStop; c++)
+    {
+        auto const &g{font.Glyphs[c - font.AsciiStart]};
+        rise = max(rise, g.bbh + g.bby);
+        drop = min(drop, static_cast<int>(g.bby));
+        assert(font.Widths[c - font.AsciiStart] == g.DWidth);
+    }
+    assert(font.MaxRise == rise && font.MaxDrop == drop);
+
+    FontServer fs(font);
+    auto v{fs.fontVerticals()};
+    assert(v.maxRise == rise && v.maxDrop == drop && v.verticalStep == font.VerticalStep);
+    for (char c{' '}; c <= '~'; c++)
+    {
+        assert(fs.widthOf(c) == fs.glyphFor(c).DWidth);
+    }
+    cout << "passed\n\r";
+}
+
+void registryTest()
+{
+    cout << "font registry - ";
+    size_t before{allocations};
+    FontRegistry fonts;
+    assert(allocations == before);
+    for (auto const &[id, font] : {pair{FontId::sans22, Sans22}, pair{FontId::sans24, Sans24}, pair{FontId::font112, font112},
+                                   pair{FontId::sans18, Sans18}, pair{FontId::sans20, Sans20}, pair{FontId::nimbus28, Nimbus28}})
+    {
+        assert(fonts.has(static_cast<uint8_t>(id)));
+        assert(fonts.fontFor(id).glyphFor('A').Index == font.Glyphs['A' - font.AsciiStart].Index);
+        assert(fonts.fontFor(id).fontVerticals().maxRise == font.MaxRise);
+        // the asset byte finds the same server
+        assert(&fonts.fontFor(static_cast<uint8_t>(id), FontId::sans22) == &fonts.fontFor(id));
+    }
+    // an asset without a font, or with one this build doesn't carry, gets the fallback
+    assert(!fonts.has(static_cast<uint8_t>(FontId::none)));
+    assert(!fonts.has(200));
+    assert(&fonts.fontFor(static_cast<uint8_t>(FontId::none), FontId::sans24) == &fonts.fontFor(FontId::sans24));
+    assert(&fonts.fontFor(200, FontId::font112) == &fonts.fontFor(FontId::font112));
+    cout << "passed\n\r";
+}
+
+/// @brief Bold markup is zero width, bold runs are measured in the bold face, the state is
+/// carried over line breaks and none of it allocates
+void markupTest()
+{
+    cout << "bold markup - ";
+    FontRegistry fonts;
+    FontServer &fs{fonts.fontFor(FontId::sans22)};
+    assert(&fs.face(true) == &fonts.fontFor(FontId::sans24));
+    assert(&fs.face(false) == &fs);
+    // the largest font in a family sets bold in itself
+    assert(&fonts.fontFor(FontId::nimbus28).face(true) == &fonts.fontFor(FontId::nimbus28));
+
+    string_view const text{"aaaa <bbbb> cccc"};
+    size_t const boldWidth{fs.widthOf(string("aaaa ")) + fs.face(true).widthOf(string("bbbb"))};
+    size_t const plainWidth{fs.widthOf(string("aaaa bbbb"))};
+    assert(plainWidth < boldWidth);
+    size_t before{allocations};
+    bool bold{false};
+    // the bold run just fits so the line breaks after the markup, outside the run
+    assert(fs.lineEnd(text, 0, boldWidth, bold) == 11 && !bold);
+    // one pixel less and the bold run no longer fits even though it would in the plain font
+    bold = false;
+    assert(fs.lineEnd(text, 0, boldWidth - 1, bold) == 4 && !bold);
+    FontServer plain(Sans22);
+    bold = false;
+    assert(plain.lineEnd(text, 0, plainWidth, bold) == 11);
+
+    // a run that spans lines leaves each line in the state it ends in
+    string_view const spans{"aaaa <bbbb cccc> dddd"};
+    size_t lines{0};
+    bool states[3]{};
+    bold = false;
+    for (size_t start{0}; start < spans.size(); lines++)
+    {
+        size_t const end{fs.lineEnd(spans, start, plainWidth, bold)};
+        states[lines] = bold;
+        start = FontServer::skipWhitespace(spans, end);
+    }
+    assert(lines == 3 && !states[0] && states[1] && !states[2]);
+    size_t wrapped{0};
+    fs.wrap(spans, plainWidth, [&](size_t, size_t)
+            { wrapped++; });
+    assert(wrapped == lines);
+    assert(allocations == before);
+
+    // the markup is never drawn - "<Hi>" in Sans22 is "Hi" in Sans24
+    auto driver{make_unique<frameDriver>()};
+    auto &frames{*driver};
+    LayoutServer lo(std::move(driver));
+    lo.fs = &fs;
+    before = allocations;
+    assert(!lo.renderLine("<Hi>", 10, 40, false));
+    assert(lo.renderLine("Hi <there", 10, 80, false));
+    assert(!lo.renderLine("you> too", 10, 110, true));
+    assert(allocations == before);
+    FrameBuffer const marked{frames.frame()};
+    lo.driver->clear();
+    lo.fs = &fonts.fontFor(FontId::sans24);
+    lo.renderLine("Hi", 10, 40, false);
+    lo.fs = &fs;
+    lo.renderLine("Hi ", 10, 80, false);
+    lo.fs = &fonts.fontFor(FontId::sans24);
+    lo.renderLine("you", 10, 110, false);
+    lo.fs = &fs;
+    lo.renderLine("there", 10 + static_cast<int>(fs.widthOf(string("Hi "))), 80, true);
+    lo.renderLine(" too", 10 + static_cast<int>(fs.face(true).widthOf(string("you"))), 110, false);
+    assert(equal(begin(marked.data), end(marked.data), begin(frames.frame().data)));
+
+    // a font with no bold face underlines the highlight instead - "at noon" with "noon" marked
+    FontServer &largest{fonts.fontFor(FontId::nimbus28)};
+    assert(!largest.hasBoldFace() && fs.hasBoldFace());
+    lo.fs = &largest;
+    lo.driver->clear();
+    lo.renderLine("at noon", 10, 40, false, TextSpan{3, 4});
+    FrameBuffer const highlighted{frames.frame()};
+    lo.driver->clear();
+    lo.renderLine("at noon", 10, 40, false);
+    int const from{10 + static_cast<int>(largest.widthOf(string("at ")))};
+    int const width{static_cast<int>(largest.widthOf(string("noon")))};
+    assert(!equal(begin(highlighted.data), end(highlighted.data), begin(frames.frame().data)));
+    lo.driver->span(from, 41, width);
+    lo.driver->span(from, 42, width);
+    assert(equal(begin(highlighted.data), end(highlighted.data), begin(frames.frame().data)));
+    cout << "passed\n\r";
+}
+
+/// @brief The changed region is the byte aligned bounding box of the pixels that differ
+void changedTest(FontServer &fs)
+{
+    cout << "changed region - ";
+    FrameBuffer before;
+    FrameBuffer after;
+    assert(!after.changedFrom(before.data).first);
+    renderWithColumns(fs, after, "07", 200, 50);
+    auto const [changed, box]{after.changedFrom(before.data)};
+    assert(changed);
+    assert(box.top() % 8 == 0 && box.height() % 8 == 0);
+    // every lit pixel is inside the box and the box is no bigger than it needs to be
+    uint_t left{WIDTH};
+    uint_t right{0};
+    uint_t top{HEIGHT};
+    uint_t bottom{0};
+    for (uint_t x{0}; x < WIDTH; x++)
+    {
+        for (uint_t y{0}; y < HEIGHT; y++)
+        {
+            if (after.data[x * (HEIGHT / 8) + y / 8] & (0b10000000 >> (y % 8)))
+            {
+                left = min(left, x);
+                right = max(right, x);
+                top = min(top, y);
+                bottom = max(bottom, y);
+            }
+        }
+    }
+    assert(box.left() == left && box.right() == right);
+    assert(box.top() == top / 8 * 8 && box.bottom() == bottom / 8 * 8 + 7);
+    // a pixel cleared counts as much as one set
+    before.copy(after.data);
+    after.erase(Rect(Point(0, 0), Point(MAX_X, MAX_Y_BITS)));
+    after.set(Point(3, 120));
+    auto const [cleared, both]{after.changedFrom(before.data)};
+    assert(cleared && both.left() == 3 && both.right() == right && both.top() == top / 8 * 8 && both.bottom() == 127);
+    cout << box.width() << "x" << box.height() << " - passed\n\r";
+}
+
+int main()
+{
+    FontServer sans22(Sans22);
+    FontServer sans24(Sans24);
+    FontServer clock(font112);
+
+    viewMatchesVector(sans22, "Sans22");
+    viewMatchesVector(sans24, "Sans24");
+    viewMatchesVector(clock, "font112");
+
+    blitMatchesVector(sans22, "Sans22", 0, 20);
+    blitMatchesVector(sans22, "Sans22", 3, 127);
+    blitMatchesVector(sans22, "Sans22", -5, 5);
+    blitMatchesVector(sans24, "Sans24", 250, 64);
+    blitMatchesVector(clock, "font112", 0, 100);
+
+    columnsMatchRows(sans22, "Sans22");
+    columnsMatchRows(sans24, "Sans24");
+    columnsMatchRows(clock, "font112");
+
+    // Every bit offset within a byte, plus clipping at each edge
+    for (int y{20}; y < 28; y++)
+    {
+        columnBlitMatchesRowBlit(sans22, "Sans22", 1, y);
+    }
+    columnBlitMatchesRowBlit(sans22, "Sans22", -5, 5);
+    columnBlitMatchesRowBlit(sans22, "Sans22", 3, 130);
+    columnBlitMatchesRowBlit(sans24, "Sans24", 250, 64);
+    columnBlitMatchesRowBlit(clock, "font112", 0, 100);
+    columnBlitMatchesRowBlit(clock, "font112", -20, 60);
+
+    for (auto const &[name, font] : {pair{"Sans22", Sans22}, pair{"Sans24", Sans24}, pair{"font112", font112},
+                                     pair{"Sans18", Sans18}, pair{"Sans20", Sans20}, pair{"Nimbus28", Nimbus28}})
+    {
+        metricsMatchGlyphs(font, name);
+    }
+    registryTest();
+    markupTest();
+    changedTest(sans22);
+
+    blitAllocates(sans22, "Sans22");
+    blitAllocates(clock, "font112");
+
+    return 0;
+}
@@ -0,0 +1,227 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <memory>
+
+#include "asset.h"
+#include "dimensions.h"
+#include "frameDriver.h"
+#include "layoutServer.h"
+#include "bench.h"
+
+/**
+ * @brief Golden frame regression. Drives LayoutServer::timeIs for every minute of a fixed
+ * day into a frameDriver, hashes each FrameBuffer (FNV-1a 64) and compares the hash with the
+ * one checked in for that minute. Any pixel that moves is reported with the minute it moved
+ * in. Each minute is also timed (best of `renders` renders) and the p50/p99/max and the
+ * slowest minutes are reported so a speed regression can be pinned to a minute too.
+ *
+ * goldenFrames [--update] [--golden FILE] [--budget NS]
+ *  --update - rewrite the golden file from this build instead of comparing
+ *  --golden - the golden file (default tests/goldenFrames.txt)
+ *  --budget - also fail if the p99 render time is over NS nanoseconds
+ *
+ * The hashes depend on the corpus timeQuotes.h was generated from, the fonts and the style
+ * sheets - regenerate with --update when one of those changes on purpose.
+ */
+
+#ifndef GOLDEN_FRAMES
+#define GOLDEN_FRAMES "goldenFrames.txt"
+#endif
+
+using namespace std;
+
+/**
+ * @brief The day every frame is rendered for. Rotation picks between quotes by date so this
+ * has to stay fixed for the hashes to mean anything.
+ */
+constexpr datetime_t golden_day{.year = 2023, .month = 2, .day = 19, .dotw = 0, .hour = 0, .min = 0, .sec = 0};
+constexpr int renders{5};
+
+uint64_t fnv1a(span<const uint8_t> data)
+{
+    uint64_t hash{0xcbf29ce484222325};
+    for (auto const b : data)
+    {
+        hash = (hash ^ b) * 0x100000001b3;
+    }
+    return hash;
+}
+
+string minuteName(int minute)
+{
+    ostringstream s;
+    s << setfill('0') << setw(2) << minute / 60 << ":" << setw(2) << minute % 60;
+    return s.str();
+}
+
+struct Minute
+{
+    uint64_t hash{0};
+    double ns{0};
+};
+
+/// @brief Renders and times every minute of golden_day
+vector<Minute> renderDay()
+{
+    vector<Minute> day(MINUTES_PER_DAY);
+    bench::Quiet quiet;
+    auto driver{make_unique<frameDriver>()};
+    auto &frames{*driver};
+    LayoutServer lo(std::move(driver));
+    for (int minute{0}; minute < MINUTES_PER_DAY; minute++)
+    {
+        datetime_t dt{golden_day};
+        dt.hour = static_cast<int8_t>(minute / 60);
+        dt.min = static_cast<int8_t>(minute % 60);
+        day[minute].ns = bench::nsPerCall([&]()
+                                          { lo.timeIs(dt); },
+                                          1, renders);
+        day[minute].hash = fnv1a(frames.frame().data);
+    }
+    return day;
+}
+
+pair<bool, vector<uint64_t>> readGolden(string const &path)
+{
+    ifstream in(path);
+    if (!in)
+    {
+        return {false, {}};
+    }
+    vector<uint64_t> hashes(MINUTES_PER_DAY, 0);
+    vector<bool> seen(MINUTES_PER_DAY, false);
+    string line;
+    while (getline(in, line))
+    {
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+        int hour{0};
+        int min{0};
+        char colon{0};
+        uint64_t hash{0};
+        istringstream fields(line);
+        fields >> hour >> colon >> min >> hex >> hash;
+        int const minute{hour * 60 + min};
+        if (!fields || colon != ':' || minute < 0 || minute >= MINUTES_PER_DAY)
+        {
+            return {false, {}};
+        }
+        hashes[minute] = hash;
+        seen[minute] = true;
+    }
+    bool const complete{all_of(seen.begin(), seen.end(), [](bool s)
+                               { return s; })};
+    return {complete, hashes};
+}
+
+bool writeGolden(string const &path, vector<Minute> const &day)
+{
+    ofstream out(path);
+    out << "# FNV-1a 64 hash of FrameBuffer::data for each minute of " << golden_day.year << "-"
+        << setfill('0') << setw(2) << (int)golden_day.month << "-" << setw(2) << (int)golden_day.day << "\n"
+        << "# Regenerate with: goldenFrames --update\n";
+    for (int minute{0}; minute < MINUTES_PER_DAY; minute++)
+    {
+        out << minuteName(minute) << " " << hex << setfill('0') << setw(16) << day[minute].hash << dec << "\n";
+    }
+    return static_cast<bool>(out);
+}
+
+/// @brief Render time percentiles plus the slowest few minutes; returns the p99
+double reportTimes(vector<Minute> const &day)
+{
+    vector<int> byTime(MINUTES_PER_DAY);
+    for (int i{0}; i < MINUTES_PER_DAY; i++)
+    {
+        byTime[i] = i;
+    }
+    sort(byTime.begin(), byTime.end(), [&](int a, int b)
+         { return day[a].ns < day[b].ns; });
+    auto const percentile{[&](int p)
+                          { return day[byTime[(MINUTES_PER_DAY * p + 99) / 100 - 1]].ns; }};
+    double const p99{percentile(99)};
+    cout << fixed << setprecision(1);
+    cout << "Render time per minute (best of " << renders << ")\n\r";
+    cout << "  p50:\t" << percentile(50) / 1000 << " us\n\r";
+    cout << "  p99:\t" << p99 / 1000 << " us\n\r";
+    cout << "  max:\t" << day[byTime.back()].ns / 1000 << " us\n\r";
+    cout << "  slowest:";
+    for (auto i{byTime.rbegin()}; i != byTime.rbegin() + 5; i++)
+    {
+        cout << " " << minuteName(*i) << " (" << day[*i].ns / 1000 << " us)";
+    }
+    cout << "\n\r";
+    return p99;
+}
+
+int main(int argc, char *argv[])
+{
+    string golden{GOLDEN_FRAMES};
+    bool update{false};
+    double budget{0};
+    for (int i{1}; i < argc; i++)
+    {
+        string_view const arg{argv[i]};
+        if (arg == "--update")
+        {
+            update = true;
+        }
+        else if (arg == "--golden" && i + 1 < argc)
+        {
+            golden = argv[++i];
+        }
+        else if (arg == "--budget" && i + 1 < argc)
+        {
+            budget = stod(argv[++i]);
+        }
+        else
+        {
+            cerr << "usage: goldenFrames [--update] [--golden FILE] [--budget NS]" << endl;
+            return 1;
+        }
+    }
+
+    auto const day{renderDay()};
+    double const p99{reportTimes(day)};
+
+    if (update)
+    {
+        bool const ok{writeGolden(golden, day)};
+        cout << (ok ? "Wrote " : "Can't write ") << golden << endl;
+        return ok ? 0 : 1;
+    }
+
+    auto const [ok, hashes]{readGolden(golden)};
+    if (!ok)
+    {
+        cout << "Can't read a complete golden file from " << golden << endl;
+        return 1;
+    }
+    int changed{0};
+    for (int minute{0}; minute < MINUTES_PER_DAY; minute++)
+    {
+        if (day[minute].hash != hashes[minute])
+        {
+            cout << "  frame changed at " << minuteName(minute) << hex << setfill('0') << ": expected "
+                 << setw(16) << hashes[minute] << " got " << setw(16) << day[minute].hash << dec << "\n\r";
+            changed++;
+        }
+    }
+    cout << "Golden frames - " << changed << " of " << MINUTES_PER_DAY << " changed\n\r";
+    bool const overBudget{budget > 0 && p99 > budget};
+    if (overBudget)
+    {
+        cout << "p99 render time is over the " << budget / 1000 << " us budget\n\r";
+    }
+    cout << endl;
+    return (changed == 0 && !overBudget) ? 0 : 1;
+}
@@ -0,0 +1,149 @@
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <cassert>
+#include <cstring>
+#include <filesystem>
+#include <string_view>
+
+#include "dimensions.h"
+#include "frameDriver.h"
+#include "imageDriver.h"
+#include "layoutServer.h"
+
+using namespace std;
+
+std::span<const uint8_t> bytes(string_view s)
+{
+    return {reinterpret_cast<uint8_t const *>(s.data()), s.size()};
+}
+
+vector<uint8_t> slurp(filesystem::path const &p)
+{
+    ifstream in(p, ios::binary);
+    return {istreambuf_iterator<char>(in), istreambuf_iterator<char>()};
+}
+
+uint32_t bigEndian(vector<uint8_t> const &v, size_t at)
+{
+    return (v[at] << 24) | (v[at + 1] << 16) | (v[at + 2] << 8) | v[at + 3];
+}
+
+void checksumTest()
+{
+    cout << "crc32 and adler32 check values - ";
+    assert(crc32(bytes("123456789")) == 0xCBF43926);
+    assert(crc32(bytes("")) == 0);
+    assert(adler32(bytes("Wikipedia")) == 0x11E60398);
+    assert(adler32(bytes("")) == 1);
+    // running values give the same answer as one pass
+    assert(crc32(bytes("6789"), crc32(bytes("12345"))) == 0xCBF43926);
+    assert(adler32(bytes("pedia"), adler32(bytes("Wiki"))) == 0x11E60398);
+    cout << "passed\n\r";
+}
+
+/// @brief Renders one minute through frameDriver and checks the image holds the same pixels
+void pasteTest(MonoImage &image)
+{
+    cout << "frame transposes into image - ";
+    auto driver{make_unique<imageDriver>()};
+    auto &frames{*driver};
+    LayoutServer lo(std::move(driver));
+    lo.timeIs({.year = 2023, .month = 2, .day = 19, .dotw = 0, .hour = 9, .min = 7, .sec = 0});
+    assert(frames.frames() == 1);
+    image = frames.image();
+    size_t lit{0};
+    for (size_t x{0}; x < WIDTH; x++)
+    {
+        for (size_t y{0}; y < HEIGHT; y++)
+        {
+            bool const inFrame{static_cast<bool>(frames.frame().data[x * (HEIGHT / 8) + y / 8] & (0b10000000 >> (y % 8)))};
+            assert(image.at(x, y) == inFrame);
+            lit += inFrame;
+        }
+    }
+    assert(lit > 0);
+    cout << lit << " pixels - passed\n\r";
+}
+
+void pbmTest(MonoImage const &image, filesystem::path const &p)
+{
+    cout << "PBM round trip - ";
+    assert(image.write(p));
+    auto const file{slurp(p)};
+    string_view const header{"P4\n296 128\n"};
+    assert(file.size() == header.size() + image.rows().size());
+    assert(memcmp(file.data(), header.data(), header.size()) == 0);
+    assert(equal(image.rows().begin(), image.rows().end(), file.begin() + header.size()));
+    cout << "passed\n\r";
+}
+
+/// @brief Walks the chunks, checks every CRC and unpacks the stored deflate blocks
+void pngTest(MonoImage const &image, filesystem::path const &p)
+{
+    cout << "PNG chunks and image data - ";
+    assert(image.write(p));
+    auto const file{slurp(p)};
+    assert(file.size() > 8 && file[0] == 0x89 && file[1] == 'P' && file[2] == 'N' && file[3] == 'G');
+    vector<uint8_t> zlib;
+    vector<string> types;
+    for (size_t at{8}; at < file.size();)
+    {
+        uint32_t const len{bigEndian(file, at)};
+        std::span<const uint8_t> const typeAndData{file.data() + at + 4, len + 4};
+        assert(crc32(typeAndData) == bigEndian(file, at + 8 + len));
+        types.emplace_back(file.begin() + at + 4, file.begin() + at + 8);
+        if (types.back() == "IHDR")
+        {
+            assert(bigEndian(file, at + 8) == WIDTH && bigEndian(file, at + 12) == HEIGHT);
+            assert(file[at + 16] == 1 && file[at + 17] == 0);
+        }
+        if (types.back() == "IDAT")
+        {
+            zlib.insert(zlib.end(), typeAndData.begin() + 4, typeAndData.end());
+        }
+        at += len + 12;
+    }
+    assert((types == vector<string>{"IHDR", "IDAT", "IEND"}));
+    assert((zlib[0] << 8 | zlib[1]) % 31 == 0);
+
+    vector<uint8_t> raw;
+    bool last{false};
+    size_t at{2};
+    while (!last)
+    {
+        last = zlib[at] & 1;
+        size_t const len{static_cast<size_t>(zlib[at + 1] | zlib[at + 2] << 8)};
+        assert((len ^ (zlib[at + 3] | zlib[at + 4] << 8)) == 0xFFFF);
+        raw.insert(raw.end(), zlib.begin() + at + 5, zlib.begin() + at + 5 + len);
+        at += 5 + len;
+    }
+    assert(at + 4 == zlib.size());
+    assert(adler32(raw) == bigEndian(zlib, at));
+
+    size_t const stride{WIDTH / 8};
+    assert(raw.size() == (stride + 1) * HEIGHT);
+    for (size_t row{0}; row < HEIGHT; row++)
+    {
+        assert(raw[row * (stride + 1)] == 0);
+        for (size_t i{0}; i < stride; i++)
+        {
+            assert(static_cast<uint8_t>(~raw[row * (stride + 1) + 1 + i]) == image.rows()[row * stride + i]);
+        }
+    }
+    cout << "passed\n\r";
+}
+
+int main()
+{
+    auto const dir{filesystem::temp_directory_path()};
+    checksumTest();
+    MonoImage image;
+    pasteTest(image);
+    pbmTest(image, dir / "imageTests.pbm");
+    pngTest(image, dir / "imageTests.png");
+    assert(!image.write(dir / "imageTests.bmp"));
+    filesystem::remove(dir / "imageTests.pbm");
+    filesystem::remove(dir / "imageTests.png");
+    return 0;
+}
@@ -0,0 +1,179 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <ctime>
+
+#include "dimensions.h"
+#include "geometry.h"
+#include "fontServer.h"
+#include "frameBuffer.h"
+#include "frameDriver.h"
+#include "layoutServer.h"
+#include "fitEngine.h"
+#include "quoteServer.h"
+#include "topCat.h"
+#include "timeQuotes.h"
+#include "bench.h"
+#include "sans22.h"
+#include "font112.h"
+
+/**
+ * @brief Microbenchmarks for the render and lookup hot paths, one number (best mean ns per
+ * call) per function. The results go to stdout as JSON so runs can be saved and compared
+ * across commits, and to stderr as a table.
+ *
+ * microBench [--label LABEL] [--out FILE]
+ *  --label - stored in the JSON with the results, e.g. the commit hash
+ *  --out   - write the JSON to FILE instead of stdout
+ */
+
+using namespace std;
+
+constexpr string_view sampleLine{"It was seven minutes after midnight. The dog was lying on the grass (12:07)"};
+constexpr string_view sampleQuote{"At nine minutes past nine on the morning of the twenty-first of June the "
+                                  "station clock stopped, and with it, it seemed, every other clock in the "
+                                  "town, so that for a while nobody could say with any certainty what time it was."};
+
+void fontBenchmarks(bench::Report &report)
+{
+    FontServer sans22(Sans22);
+    FontServer clock(font112);
+    char c{' '};
+    auto const nextChar{[&]()
+                        { c = c == '~' ? ' ' : c + 1; return c; }};
+    string const line{sampleLine};
+
+    report.run("FontServer::widthOf(char)", [&]()
+               { bench::keep(sans22.widthOf(nextChar())); },
+               100000);
+    report.run("FontServer::widthOf(string)", [&]()
+               { bench::keep(sans22.widthOf(line)); },
+               10000);
+    report.run("FontServer::bitsFor", [&]()
+               { bench::keep(sans22.bitsFor(nextChar())); },
+               20000);
+    report.run("FontServer::bitmapFor", [&]()
+               { bench::keep(sans22.bitmapFor(nextChar())); },
+               100000);
+    report.run("FontServer::fontVerticals (Sans22)", [&]()
+               { bench::keep(sans22.fontVerticals()); },
+               10000);
+    report.run("FontServer::fontVerticals (font112)", [&]()
+               { bench::keep(clock.fontVerticals()); },
+               10000);
+}
+
+void layoutBenchmarks(bench::Report &report)
+{
+    bench::Quiet quiet;
+    LayoutServer lo(make_unique<frameDriver>());
+    lo.fs = &lo.fonts.fontFor(FontId::sans22);
+    report.run("LayoutServer::wordWrap", [&]()
+               { bench::keep(lo.wordWrap(sampleQuote, WIDTH)); },
+               10000);
+    report.run("FitEngine::fit", [&]()
+               { bench::keep(lo.fitter.fit(sampleQuote)); },
+               10000);
+}
+
+void frameBenchmarks(bench::Report &report)
+{
+    FrameBuffer fb;
+    int i{0};
+    report.run("FrameBuffer::line(Point, Point)", [&]()
+               { fb.line(Point(i % WIDTH, 0), Point(MAX_X - i % WIDTH, MAX_Y_BITS)); i++; },
+               2000);
+    report.run("FrameBuffer::line(Point, Orientation)", [&]()
+               { fb.line(Point(0, i % HEIGHT), Orientation::horizontal, WIDTH); i++; },
+               2000);
+    report.run("FrameBuffer::border", [&]()
+               { fb.border(); },
+               2000);
+    bench::keep(fb.data);
+    report.run("Pixel(Point)", [&]()
+               { bench::keep(Pixel(Point(i % WIDTH, i % HEIGHT))); i++; },
+               100000);
+    report.run("Pixel(index, value)", [&]()
+               { bench::keep(Pixel(i % FRAMEBUFFERSIZE, 0b1000)); i++; },
+               100000);
+}
+
+void quoteBenchmarks(bench::Report &report)
+{
+    QuoteServer qs(timeStack);
+    int minute{0};
+    auto const next{[&]()
+                    {
+                        datetime_t dt{.year = 2023, .month = 2, .day = 19, .dotw = 0,
+                                      .hour = static_cast<int8_t>(minute / 60),
+                                      .min = static_cast<int8_t>(minute % 60), .sec = 0};
+                        minute = (minute + 7) % MINUTES_PER_DAY;
+                        return dt;
+                    }};
+    report.run("QuoteServer::quoteFor", [&]()
+               { bench::keep(qs.quoteFor(next())); },
+               MINUTES_PER_DAY * 4);
+}
+
+void timeBenchmarks(bench::Report &report)
+{
+    time_t t{1676800000};
+    datetime_t dt{.year = 2023, .month = 2, .day = 19, .dotw = 0, .hour = 9, .min = 7, .sec = 0};
+    tm ttm{};
+    report.run("TopCat::toDateTime(time_t)", [&]()
+               { bench::keep(TopCat::toDateTime(&t, &dt)); t += 61; },
+               10000);
+    report.run("TopCat::toTm(datetime_t)", [&]()
+               { bench::keep(TopCat::toTm(&dt, &ttm)); },
+               100000);
+    report.run("TopCat::toClockTime", [&]()
+               { bench::keep(TopCat::toClockTime(dt)); },
+               10000);
+    report.run("TopCat::dayNumber", [&]()
+               { bench::keep(TopCat::dayNumber(dt)); dt.day = dt.day % 28 + 1; },
+               100000);
+}
+
+int main(int argc, char *argv[])
+{
+    string label;
+    string out;
+    for (int i{1}; i < argc; i++)
+    {
+        string_view const arg{argv[i]};
+        if (arg == "--label" && i + 1 < argc)
+        {
+            label = argv[++i];
+        }
+        else if (arg == "--out" && i + 1 < argc)
+        {
+            out = argv[++i];
+        }
+        else
+        {
+            cerr << "usage: microBench [--label LABEL] [--out FILE]" << endl;
+            return 1;
+        }
+    }
+
+    bench::Report report("microBench", label);
+    fontBenchmarks(report);
+    layoutBenchmarks(report);
+    frameBenchmarks(report);
+    quoteBenchmarks(report);
+    timeBenchmarks(report);
+
+    cerr << fixed << setprecision(1) << "Best mean per call\n\r";
+    report.table(cerr);
+    if (out.empty())
+    {
+        report.json(cout);
+        return 0;
+    }
+    ofstream file(out);
+    report.json(file);
+    return file ? 0 : 1;
+}
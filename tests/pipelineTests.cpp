@@ -0,0 +1,135 @@
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "dimensions.h"
+#include "frameDriver.h"
+#include "layoutServer.h"
+#include "renderPipeline.h"
+#include "spscSlot.h"
+#include "bench.h"
+
+/**
+ * @brief Stress tests the core 0 / core 1 hand-over with two std::threads - the same code
+ * the RP2040 runs with the renderer on core 1
+ */
+
+using namespace std;
+using namespace std::chrono;
+
+constexpr datetime_t testDay{.year = 2023, .month = 2, .day = 19, .dotw = 0, .hour = 0, .min = 0, .sec = 0};
+
+datetime_t at(int minute)
+{
+    datetime_t dt{testDay};
+    dt.hour = static_cast<int8_t>(minute / 60);
+    dt.min = static_cast<int8_t>(minute % 60);
+    return dt;
+}
+
+/// @brief Millions of values through a small ring - all arrive, once each, in order
+void spscTest()
+{
+    cout << "spsc slot - ";
+    constexpr uint64_t count{2'000'000};
+    SpscSlot<uint64_t, 4> slot;
+    assert(slot.peek() == nullptr && slot.size() == 0);
+    auto const start{steady_clock::now()};
+    thread producer([&]()
+                    {
+                        for (uint64_t i{1}; i <= count; i++)
+                        {
+                            uint64_t *value{nullptr};
+                            while ((value = slot.claim()) == nullptr)
+                            {
+                                this_thread::yield();
+                            }
+                            *value = i;
+                            slot.publish();
+                        } });
+    uint64_t expected{1};
+    while (expected <= count)
+    {
+        if (auto const *value{slot.peek()})
+        {
+            assert(*value == expected);
+            slot.release();
+            expected++;
+        }
+        else
+        {
+            this_thread::yield();
+        }
+    }
+    producer.join();
+    auto const ns{duration_cast<nanoseconds>(steady_clock::now() - start).count()};
+    assert(slot.peek() == nullptr && slot.size() == 0);
+    // a full ring refuses another claim until one is released
+    for (int i{0}; i < 4; i++)
+    {
+        *slot.claim() = i;
+        slot.publish();
+    }
+    assert(slot.claim() == nullptr && slot.size() == 4);
+    slot.release();
+    assert(slot.claim() != nullptr);
+    cout << count << " hand-overs, " << ns / count << "ns each - passed\n\r";
+}
+
+/// @brief A day of minutes rendered on a second thread, collected as epdc does - each
+/// frame matches a render on this thread, and asking for a minute out of turn (the clock
+/// being set) drops the frames rendered ahead
+void pipelineTest()
+{
+    cout << "render pipeline - ";
+    auto pipeline{make_unique<RenderPipeline>()};
+    auto reference{make_unique<frameDriver>()};
+    auto &frames{*reference};
+    LayoutServer lo(std::move(reference));
+    atomic<bool> stop{false};
+    nanoseconds waited{0};
+    nanoseconds longest{0};
+    {
+        bench::Quiet quiet;
+        thread core1([&]()
+                     {
+                         while (!stop.load())
+                         {
+                             if (!pipeline->renderNext())
+                             {
+                                 this_thread::yield();
+                             }
+                         } });
+        for (int minute{0}; minute < MINUTES_PER_DAY; minute++)
+        {
+            // now and then the clock jumps
+            int const shown{minute % 97 == 96 ? (minute * 7) % MINUTES_PER_DAY : minute};
+            auto const start{steady_clock::now()};
+            auto const &frame{pipeline->frameFor(at(shown))};
+            auto const wait{steady_clock::now() - start};
+            waited += wait;
+            longest = max(longest, duration_cast<nanoseconds>(wait));
+            assert(RenderPipeline::sameMinute(frame.minute, at(shown)));
+            lo.render(at(shown));
+            assert(equal(begin(frame.pixels), end(frame.pixels), begin(frames.frame().data)));
+            pipeline->release();
+            pipeline->request(at(shown + 1));
+        }
+        stop = true;
+        core1.join();
+    }
+    assert(pipeline->rendered() >= MINUTES_PER_DAY);
+    cout << pipeline->rendered() << " renders, mean wait " << waited.count() / MINUTES_PER_DAY / 1000
+         << "us, longest " << longest.count() / 1000 << "us - passed\n\r";
+}
+
+int main()
+{
+    spscTest();
+    pipelineTest();
+    return 0;
+}
@@ -1,17 +1,25 @@
 #include <iostream>
 #include <cassert>
+#include <cctype>
 #include <iomanip>
+#include <algorithm>
+#include <map>
 #include <span>
 #include <string_view>
 
 #include "dimensions.h"
 #include "quoteServer.h"
+#include "fontServer.h"
+#include "fontRegistry.h"
+#include "fitEngine.h"
+#include "styleSheets.h"
 #include "timeQuotes.h"
 #include "picoDatetime.h"
 
 using namespace std;
 
-AssetStack stack{timeText, timeAssets, 776, 76030};
+// timeStack without its generated minute index so QuoteServer has to build one
+AssetStack stack{timeText, timeAssets, timeStack.Quantity, timeStack.MaxIndex, {}, timeStack.Pairs, timeStack.Breaks, timeStack.Credits};
 
 std::ostream &operator<<(std::ostream &os, datetime_t dt)
 {
@@ -34,13 +42,309 @@ void quoteTest(QuoteServer &qs, string_view expected, datetime_t dt)
 void lengthTest(QuoteServer &qs, string_view expected, datetime_t dt)
 {
     cout << "Length test for: " << dt;
-    auto index{qs.GetAssetByKey(qs.keyFrom(dt)).second.Index};
-    char const *quoteStartAddress{&stack.Text[index]};
-    string_view quotesv(quoteStartAddress);
-    assert(expected.size() == quotesv.size());
+    auto asset{qs.GetAssetByKey(qs.keyFrom(dt)).second};
+    auto [ok, text]{qs.GetAssetText(asset)};
+    assert(ok);
+    assert(expected.size() == text.size());
+    // The stored (possibly compressed) quote is never longer than the text
+    char const *quoteStartAddress{&stack.Text[asset.Index]};
+    string_view stored(quoteStartAddress);
+    assert(stored.size() <= text.size());
     cout << " passed\n\r";
 }
 
+/// @brief Every quote in the corpus decodes to printable text no longer than MAX_TEXT_LEN
+void decodeCorpusTest(QuoteServer &qs)
+{
+    cout << "Decode every quote - ";
+    size_t raw{0};
+    for (auto const &asset : stack.Assets)
+    {
+        auto [ok, text]{qs.GetAssetText(asset)};
+        assert(ok);
+        assert(!text.empty() && text.size() <= MAX_TEXT_LEN);
+        assert(all_of(text.begin(), text.end(), [](char c)
+                      { return (c >= ' ' && c <= '~') || c == LF; }));
+        raw += text.size() + 1;
+    }
+    cout << raw << " bytes stored in " << stack.MaxIndex + stack.Pairs.size() << " - passed\n\r";
+}
+
+/// @brief The line breaks stored by textGenerator are exactly what the runtime wrap produces
+void precomputedLayoutTest(QuoteServer &qs)
+{
+    cout << "Precomputed fonts and line breaks - ";
+    FontRegistry fonts;
+    FitEngine fitter(fonts, quoteStyle, WIDTH, HEIGHT, FitEngine::lineHeight(fonts.fontFor(footerStyle.fontId), footerStyle));
+    assert(!stack.Breaks.empty());
+    for (auto const &asset : stack.Assets)
+    {
+        auto [ok, text]{qs.GetAssetText(asset)};
+        assert(ok);
+        assert(asset.Length == text.size());
+        // textGenerator fitted the quote with the same engine the runtime uses, time marker and all
+        TextSpan const marker{asset.MarkerStart, asset.MarkerLength};
+        assert(fonts.has(asset.FontId));
+        assert(asset.FontId == static_cast<uint8_t>(fitter.fit(text, marker, asset.Bold).Font));
+        vector<uint16_t> ends;
+        fonts.fontFor(static_cast<FontId>(asset.FontId)).wrap(
+            text, WIDTH, [&](size_t, size_t end)
+            { ends.push_back(end); },
+            marker);
+        assert(ends.size() == asset.LineCount);
+        assert(equal(ends.begin(), ends.end(), stack.Breaks.begin() + asset.LineIndex));
+    }
+    cout << "passed\n\r";
+}
+
+/// @brief The time markers stored by textGenerator are inside their quotes and name the time
+void markerTest(QuoteServer &qs)
+{
+    cout << "Time markers - ";
+    size_t found{0};
+    for (auto const &asset : stack.Assets)
+    {
+        auto [ok, text]{qs.GetAssetText(asset)};
+        assert(ok);
+        if (asset.MarkerLength == 0)
+        {
+            continue;
+        }
+        assert(asset.MarkerStart + asset.MarkerLength <= text.size());
+        auto const phrase{text.substr(asset.MarkerStart, asset.MarkerLength)};
+        // a phrase from the text, not the space around it
+        assert(!isspace(phrase.front()) && !isspace(phrase.back()));
+        found++;
+    }
+    // quoteAt hands the marker on with the quote, and drops one that runs off the end
+    constexpr char markedText[]{'a', 't', ' ', '9', ':', '0', '7', 0};
+    constexpr Asset markedAssets[]{{0, 0, 0, 0, 0, 0, 0, 3, 4}, {1, 0, 0, 0, 0, 0, 0, 5, 4}};
+    QuoteServer marked(AssetStack{markedText, markedAssets, 2, sizeof(markedText)});
+    auto [inRange, mq]{marked.quoteAt(datetime_t{.hour = 0, .min = 0, .sec = 0})};
+    assert(inRange && mq.Text.substr(mq.Marker.Start, mq.Marker.Length) == "9:07");
+    auto [offEnd, eq]{marked.quoteAt(datetime_t{.hour = 0, .min = 1, .sec = 0})};
+    assert(offEnd && eq.Marker.Length == 0);
+    cout << found << " of " << stack.Assets.size() << " quotes marked - passed\n\r";
+}
+
+/// @brief Every quote is credited and each title and author is stored once
+void creditsTest(QuoteServer &qs)
+{
+    cout << "Credits - ";
+    assert(!stack.Credits.empty() && stack.Credits.front() == 0 && stack.Credits.back() == 0);
+    map<string_view, uint16_t> offsets;
+    for (auto const &asset : stack.Assets)
+    {
+        // a few poems have no title but every quote has someone to credit
+        assert(asset.Title != 0 || asset.Author != 0);
+        for (auto const offset : {asset.Title, asset.Author})
+        {
+            auto const credit{qs.creditAt(offset)};
+            assert(credit.empty() == (offset == 0));
+            // a credit seen before is the same offset
+            auto const [it, added]{offsets.emplace(credit, offset)};
+            assert(added || it->second == offset);
+        }
+    }
+    assert(qs.creditAt(0).empty());
+    assert(qs.creditAt(static_cast<uint16_t>(stack.Credits.size())).empty());
+    auto [ok, q]{qs.quoteAt(datetime_t{.hour = 0, .min = 0, .sec = 0})};
+    assert(ok && !q.Title.empty() && !q.Author.empty());
+    offsets.erase(string_view{});
+    cout << offsets.size() << " distinct in " << stack.Credits.size() << " bytes - passed\n\r";
+}
+
+/// @brief Measures the wrapped layout of text in font the way LayoutServer draws it and
+/// returns the bottom of the last line's descenders
+int layoutBottom(FontServer &fs, string_view text)
+{
+    auto v{fs.fontVerticals()};
+    size_t lines{0};
+    fs.wrap(text, WIDTH, [&](size_t, size_t)
+            { lines++; });
+    return quoteStyle.homeY + v.maxRise + static_cast<int>(lines - 1) * (v.verticalStep + quoteStyle.rowMargin) - v.maxDrop;
+}
+
+void fitTest(QuoteServer &qs)
+{
+    cout << "Font fitting - ";
+    FontRegistry fonts;
+    FitEngine fitter(fonts, quoteStyle);
+    // a short quote gets the largest font, an impossible one the smallest
+    assert(fitter.fit("It was ten past ten.").Font == FitEngine::Candidates.back());
+    string const tooLong(4000, 'x');
+    auto const overflow{fitter.fit(tooLong)};
+    assert(!overflow.Fits && overflow.Font == FitEngine::Candidates.front());
+    string wordy;
+    for (int i{0}; i < 200; i++)
+    {
+        wordy += "word ";
+    }
+    assert(!fitter.fit(wordy).Fits);
+    // with no room above the footer a quote takes the whole panel and goes without credits
+    FitEngine noRoom(fonts, quoteStyle, WIDTH, HEIGHT, HEIGHT);
+    auto const uncredited{noRoom.fit("It was ten past ten.")};
+    assert(uncredited.Fits && !uncredited.Footer && uncredited.Font == FitEngine::Candidates.back());
+    assert(noRoom.maxLines(uncredited.Font) == 0 && fitter.fit("It was ten past ten.").Footer);
+
+    map<FontId, size_t> used;
+    for (auto const &asset : stack.Assets)
+    {
+        auto [ok, text]{qs.GetAssetText(asset)};
+        assert(ok);
+        auto const f{fitter.fit(text, {}, asset.Bold)};
+        used[f.Font]++;
+        auto const pos{find(FitEngine::Candidates.begin(), FitEngine::Candidates.end(), f.Font)};
+        assert(pos != FitEngine::Candidates.end());
+        if (!f.Fits)
+        {
+            continue;
+        }
+        // it fits, on the panel, and the next size up doesn't
+        assert(layoutBottom(fonts.fontFor(f.Font), text) <= HEIGHT);
+        if (pos + 1 != FitEngine::Candidates.end())
+        {
+            size_t lines{0};
+            size_t lastEnd{0};
+            fonts.fontFor(*(pos + 1)).wrap(text, WIDTH, [&](size_t, size_t end)
+                                           { lines++; lastEnd = end; });
+            bool const wrappedAll{FontServer::skipWhitespace(text, lastEnd) == text.size()};
+            assert(lines > fitter.maxLines(*(pos + 1), asset.Bold) || !wrappedAll);
+        }
+    }
+    cout << used.size() << " sizes used - passed\n\r";
+}
+
+/// @brief A hand built compressed stack: 0x80 = "ab", 0x81 = 0x80 + "c", 0x82 = 0x81 + 0x81
+constexpr uint8_t pairs[]{'a', 'b', 0x80, 'c', 0x81, 0x81};
+constexpr char pairText[]{'x', '\x82', 'y', 0, '\x80', 0, '\x83', 0};
+constexpr Asset pairAssets[]{{1, 0, 0, 0}, {2, 4, 0, 0}, {3, 6, 0, 0}};
+AssetStack pairStack{pairText, pairAssets, 3, sizeof(pairText), {}, pairs};
+
+void pairDecodeTest()
+{
+    cout << "Byte pair decode - ";
+    QuoteServer qs(pairStack);
+    datetime_t dt{.year = 2023, .month = 2, .day = 19, .dotw = 0, .hour = 0, .min = 1, .sec = 0};
+    assert(qs.quoteFor(dt).second == "xabcabcy");
+    dt.min = 2;
+    assert(qs.quoteFor(dt).second == "ab");
+    // 0x83 isn't in the dictionary
+    dt.min = 3;
+    assert(!qs.quoteFor(dt).first);
+    cout << "passed\n\r";
+}
+
+/// @brief The index built at construction, the generated table and a linear scan over the
+/// assets must agree on every minute
+void minuteIndexTest(QuoteServer &built)
+{
+    cout << "Minute index - ";
+    QuoteServer generated(timeStack);
+    assert(!generated.stack.Minutes.empty());
+    for (size_t key{0}; key < MINUTES_PER_DAY; key++)
+    {
+        auto first{find_if(stack.Assets.begin(), stack.Assets.end(), [key](Asset const &a)
+                           { return a.Key == key; })};
+        bool const found{first != stack.Assets.end()};
+        assert(built.hasKey(key) == found);
+        assert(generated.hasKey(key) == found);
+        if (found)
+        {
+            assert(built.GetAssetByKey(key).second.Index == first->Index);
+            assert(generated.GetAssetByKey(key).second.Index == first->Index);
+            auto count{count_if(stack.Assets.begin(), stack.Assets.end(), [key](Asset const &a)
+                                { return a.Key == key; })};
+            assert(built.minuteFor(key).Count == count);
+            assert(generated.minuteFor(key).Count == count);
+        }
+    }
+    assert(!built.hasKey(MINUTES_PER_DAY));
+    assert(!generated.GetAssetByKey(MINUTES_PER_DAY).first);
+    cout << "passed\n\r";
+}
+
+/// @brief A small stack with four quotes at 00:05, one at 00:06 and none at 00:07
+constexpr char rotationText[]{"a\0b\0c\0d\0e"};
+constexpr Asset rotationAssets[]{{5, 0, 0, 0}, {5, 2, 0, 0}, {5, 4, 0, 0}, {5, 6, 0, 0}, {6, 8, 0, 0}};
+AssetStack rotationStack{rotationText, rotationAssets, 5, sizeof(rotationText)};
+
+string_view rotated(QuoteServer &qs, datetime_t dt)
+{
+    auto [ok, sv]{qs.quoteFor(dt)};
+    assert(ok);
+    return sv;
+}
+
+void rotationTest()
+{
+    QuoteServer qs(rotationStack);
+    datetime_t dt{.year = 2023, .month = 2, .day = 19, .dotw = 0, .hour = 0, .min = 5, .sec = 0};
+    datetime_t single{dt};
+    single.min = 6;
+    datetime_t none{dt};
+    none.min = 7;
+
+    cout << "Rotation first - ";
+    assert(qs.rotation() == Rotation::first);
+    for (int i{0}; i < 5; i++)
+    {
+        assert(rotated(qs, dt) == "a");
+    }
+    assert(!qs.quoteFor(none).first);
+    cout << "passed\n\r";
+
+    cout << "Rotation roundRobin - ";
+    qs.rotateBy(Rotation::roundRobin);
+    // Asking again doesn't move the rotation, only the next day does
+    string days;
+    for (int8_t day{19}; day < 25; day++)
+    {
+        datetime_t later{dt};
+        later.day = day;
+        auto const quote{rotated(qs, later)};
+        assert(rotated(qs, later) == quote);
+        assert(rotated(qs, single) == "e");
+        days += quote;
+    }
+    auto const start{string("abcd").find(days[0])};
+    for (size_t i{0}; i < days.size(); i++)
+    {
+        assert(days[i] == "abcd"[(start + i) % 4]);
+    }
+    cout << "passed\n\r";
+
+    cout << "Rotation dayShuffle - ";
+    qs.rotateBy(Rotation::dayShuffle);
+    // The quote only changes with the date
+    auto const today{rotated(qs, dt)};
+    assert(rotated(qs, dt) == today);
+    // Every quote once in each cycle of four days (cycles are aligned to the day number)
+    map<int32_t, string> cycles;
+    for (int8_t month{1}; month <= 3; month++)
+    {
+        for (int8_t day{1}; day <= 28; day++)
+        {
+            datetime_t later{dt};
+            later.month = month;
+            later.day = day;
+            cycles[TopCat::dayNumber(later) / 4] += rotated(qs, later);
+        }
+    }
+    size_t complete{0};
+    for (auto const &[cycle, shownInCycle] : cycles)
+    {
+        if (shownInCycle.size() == 4)
+        {
+            assert(is_permutation(shownInCycle.begin(), shownInCycle.end(), string("abcd").begin()));
+            complete++;
+        }
+    }
+    assert(complete >= 18);
+    assert(rotated(qs, single) == "e");
+    cout << "passed\n\r";
+}
+
 int main()
 {
     cout << "Stack validity - ";
@@ -120,5 +424,14 @@ int main()
     quoteTest(qs, quote2357, dt);
     lengthTest(qs, quote2357, dt);
 
+    minuteIndexTest(qs);
+    rotationTest();
+    decodeCorpusTest(qs);
+    precomputedLayoutTest(qs);
+    markerTest(qs);
+    creditsTest(qs);
+    fitTest(qs);
+    pairDecodeTest();
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,158 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include "asset.h"
+#include "quoteServer.h"
+#include "picoDatetime.h"
+#include "bench.h"
+#include "timeQuotes.h"
+
+/**
+ * @brief Host benchmark for QuoteServer::quoteFor against synthetic corpora of increasing
+ * size. The baseline is the lookup quoteFor used to do (hasKey then GetAssetByKey, each a
+ * linear scan of the assets) so the two columns show the cost per minute before and after
+ * the minute index. The second table shows the cost of each Rotation policy and the last
+ * shows the size of the compressed corpus and the time to decode each quote.
+ */
+
+using namespace std;
+
+/// @brief A sorted corpus of quantity short quotes spread evenly across the day
+struct Corpus
+{
+    explicit Corpus(uint32_t quantity)
+    {
+        for (uint32_t i{0}; i < quantity; i++)
+        {
+            assets.push_back(Asset{.Key = static_cast<size_t>(i) * MINUTES_PER_DAY / quantity,
+                                   .Index = text.size(), .FontId = 0, .Style = 0});
+            auto quote{"Quote number " + to_string(i)};
+            text.insert(text.end(), quote.begin(), quote.end());
+            text.push_back(EOT);
+        }
+    }
+    AssetStack stack() const
+    {
+        return AssetStack{text, assets, static_cast<uint32_t>(assets.size()), static_cast<uint32_t>(text.size())};
+    }
+    vector<char> text;
+    vector<Asset> assets;
+};
+
+/// @brief The pre-index lookup: one pass to check the key and another to fetch the asset
+pair<bool, string_view> linearLookup(AssetStack const &stack, size_t key)
+{
+    bool found{false};
+    for (auto const a : stack.Assets)
+    {
+        if (a.Key == key)
+        {
+            found = true;
+            break;
+        }
+    }
+    if (found)
+    {
+        for (auto const a : stack.Assets)
+        {
+            if (a.Key == key)
+            {
+                return {true, string_view(&stack.Text[a.Index])};
+            }
+        }
+    }
+    return {false, string_view{}};
+}
+
+int main()
+{
+    cout << fixed << setprecision(1);
+    cout << "Quote lookup per minute (ns)\n\r";
+    cout << "  quotes\tlinear\t\tindexed\t\tbuild index (us)\n\r";
+    for (uint32_t quantity : {3'000U, 30'000U, 300'000U})
+    {
+        Corpus corpus(quantity);
+        auto stack{corpus.stack()};
+
+        double buildNs{bench::nsPerCall([&]()
+                                        { QuoteServer qs(stack); },
+                                        10)};
+        QuoteServer qs(stack);
+
+        int minute{0};
+        size_t found{0};
+        double indexedNs{bench::nsPerCall([&]()
+                                          {
+                                              datetime_t dt{.hour = static_cast<int8_t>(minute / 60),
+                                                            .min = static_cast<int8_t>(minute % 60)};
+                                              found += qs.quoteFor(dt).first;
+                                              minute = (minute + 7) % MINUTES_PER_DAY;
+                                          },
+                                          MINUTES_PER_DAY)};
+        // The linear scan is slow enough at 300k that a few hundred calls will do
+        size_t const linearCalls{quantity > 30'000 ? 200U : MINUTES_PER_DAY};
+        double linearNs{bench::nsPerCall([&]()
+                                         {
+                                             found += linearLookup(stack, minute).first;
+                                             minute = (minute + 7) % MINUTES_PER_DAY;
+                                         },
+                                         linearCalls, 3)};
+        cout << "  " << quantity << "\t\t" << linearNs << "\t\t" << indexedNs << "\t\t"
+             << buildNs / 1000 << "\n\r";
+        if (found == 0)
+        {
+            return 1;
+        }
+    }
+
+    // ~208 candidates per minute, so this is the worst case for choosing between them
+    Corpus crowded(300'000);
+    auto stack{crowded.stack()};
+    QuoteServer qs(stack);
+    cout << "Quote lookup per minute by rotation, 300000 quotes (ns)\n\r";
+    for (auto const &[name, rotation] : {pair{"first", Rotation::first}, pair{"dayShuffle", Rotation::dayShuffle},
+                                         pair{"roundRobin", Rotation::roundRobin}})
+    {
+        qs.rotateBy(rotation);
+        int call{0};
+        double ns{bench::nsPerCall([&]()
+                                   {
+                                       datetime_t dt{.year = 2023, .month = 2, .day = static_cast<int8_t>(1 + call % 28),
+                                                     .hour = static_cast<int8_t>((call / 28) % 24), .min = 0};
+                                       qs.quoteFor(dt);
+                                       call++;
+                                   },
+                                   MINUTES_PER_DAY)};
+        cout << "  " << name << "\t" << ns << "\n\r";
+    }
+
+    // Decode every quote in the shipped corpus, keeping the best of a few runs for each
+    QuoteServer shipped(timeStack);
+    size_t raw{0};
+    double total{0};
+    double worst{0};
+    size_t worstLength{0};
+    for (auto const &asset : timeStack.Assets)
+    {
+        size_t length{0};
+        double ns{bench::nsPerCall([&]()
+                                   { length = shipped.GetAssetText(asset).second.size(); },
+                                   20)};
+        raw += length + 1;
+        total += ns;
+        if (ns > worst)
+        {
+            worst = ns;
+            worstLength = length;
+        }
+    }
+    size_t const stored{timeStack.MaxIndex + timeStack.Pairs.size()};
+    cout << "Corpus: " << timeStack.Quantity << " quotes, " << raw << " bytes of text stored in " << stored
+         << " (" << 100.0 * stored / raw << "%)\n\r";
+    cout << "  decode per quote: mean " << total / timeStack.Assets.size() << " ns, worst " << worst
+         << " ns (" << worstLength << " chars)\n\r";
+    cout << endl;
+    return 0;
+}
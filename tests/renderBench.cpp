@@ -0,0 +1,132 @@
+#include <iostream>
+#include <iomanip>
+#include <memory>
+
+#include "dimensions.h"
+#include "displayDriver.h"
+#include "frameBuffer.h"
+#include "layoutServer.h"
+#include "bench.h"
+#include "font112.h"
+#include "sans22.h"
+
+/**
+ * @brief Host benchmark for a full quote render (LayoutServer::timeIs) through the
+ * displayDriver interface. The pixel driver only implements set() so every glyph goes
+ * through the displayDriver fallbacks (a virtual call, a Point and a Pixel per lit pixel),
+ * which is what every render cost before the bulk operations. The bulk driver hands each
+ * glyph to FrameBuffer in one call.
+ *
+ * The glyph benchmark compares the two FrameBuffer glyph paths directly: the row-major
+ * blit (a mask per row, a bit at a time) and the pre-transposed column blit (a shift and
+ * two ORs per column byte).
+ */
+
+using namespace std;
+
+class pixelDriver : public displayDriver
+{
+public:
+    void clear() override { buffer.clear(); }
+    void set(int x, int y) override { buffer.set(Point(x, y)); }
+    void update() override {}
+    void erase(Rect const &r) override { buffer.erase(r); }
+    FrameBuffer buffer;
+};
+
+class bulkDriver : public pixelDriver
+{
+public:
+    void blit(int x, int y, std::span<const uint8_t> bitmap, uint_t width, uint_t height, uint_t stride) override
+    {
+        buffer.blit(x, y, bitmap, width, height, stride);
+    }
+    void blitColumns(int x, int y, std::span<const uint8_t> columns, uint_t width, uint_t height, uint_t columnStride) override
+    {
+        buffer.blitColumns(x, y, columns, width, height, columnStride);
+    }
+    void span(int x, int y, int length) override { buffer.span(x, y, length); }
+    void fill(Rect const &r) override { buffer.fill(r); }
+    void copy(std::span<const uint8_t, FRAMEBUFFERSIZE> frame) override { buffer.copy(frame); }
+};
+
+/// @brief Renders every minute of the day once and returns the mean ns per render
+template <typename D>
+double renderDay(FrameBuffer *&frame, uint8_t (&day)[24 * 60][FRAMEBUFFERSIZE])
+{
+    auto driver{make_unique<D>()};
+    frame = &driver->buffer;
+    LayoutServer lo(std::move(driver));
+    bench::Quiet quiet;
+    int minute{0};
+    double ns{bench::nsPerCall([&]()
+                               {
+                                   datetime_t dt{.year = 2023, .month = 2, .day = 19, .dotw = 0,
+                                                 .hour = static_cast<int8_t>(minute / 60),
+                                                 .min = static_cast<int8_t>(minute % 60), .sec = 0};
+                                   lo.timeIs(dt);
+                                   memcpy(day[minute], frame->data, FRAMEBUFFERSIZE);
+                                   minute = (minute + 1) % (24 * 60);
+                               },
+                               24 * 60)};
+    return ns;
+}
+
+/// @brief Mean ns to draw every printable glyph of a font, cycling the top edge through all
+/// eight bit offsets
+template <typename F>
+double blitGlyphs(FontServer &fs, F &&draw)
+{
+    FrameBuffer fb;
+    int y{0};
+    return bench::nsPerCall([&]()
+                            {
+                                int x{0};
+                                for (char c{' '}; c <= '~'; c++)
+                                {
+                                    auto bits{fs.bitmapFor(c)};
+                                    draw(fb, bits, x % (WIDTH - 60), 4 + y);
+                                    x += bits.Glyph.DWidth;
+                                }
+                                y = (y + 1) & 0b111;
+                            },
+                            2000) /
+           ('~' - ' ' + 1);
+}
+
+static uint8_t pixelFrames[24 * 60][FRAMEBUFFERSIZE];
+static uint8_t bulkFrames[24 * 60][FRAMEBUFFERSIZE];
+
+int main()
+{
+    FrameBuffer *frame{nullptr};
+    double pixelNs{renderDay<pixelDriver>(frame, pixelFrames)};
+    double bulkNs{renderDay<bulkDriver>(frame, bulkFrames)};
+
+    size_t mismatched{0};
+    for (int m{0}; m < 24 * 60; m++)
+    {
+        mismatched += memcmp(pixelFrames[m], bulkFrames[m], FRAMEBUFFERSIZE) != 0;
+    }
+
+    cout << fixed << setprecision(1);
+    cout << "Per quote render (mean over 1440 minutes, best of 5)\n\r";
+    cout << "  set() per pixel:\t" << pixelNs / 1000 << " us\n\r";
+    cout << "  bulk blit:\t\t" << bulkNs / 1000 << " us\n\r";
+    cout << "  speedup:\t\t" << pixelNs / bulkNs << "x\n\r";
+    cout << "  frames that differ:\t" << mismatched << "\n\r";
+
+    cout << "Per glyph blit into FrameBuffer (mean over ' ' to '~')\n\r";
+    for (auto const &[name, font] : {pair{"Sans22", Sans22}, pair{"font112", font112}})
+    {
+        FontServer fs(font);
+        double rowNs{blitGlyphs(fs, [](FrameBuffer &fb, GlyphBits const &b, int x, int y)
+                                { fb.blit(x, y, b.Rows, b.Glyph.bbw, b.Glyph.bbh, b.Stride); })};
+        double columnNs{blitGlyphs(fs, [](FrameBuffer &fb, GlyphBits const &b, int x, int y)
+                                   { fb.blitColumns(x, y, b.Columns, b.Glyph.bbw, b.Glyph.bbh, b.ColumnStride); })};
+        cout << "  " << name << " rows:\t" << rowNs << " ns\tcolumns: " << columnNs << " ns\t("
+             << rowNs / columnNs << "x)\n\r";
+    }
+    cout << endl;
+    return mismatched == 0 ? 0 : 1;
+}
@@ -0,0 +1,120 @@
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <algorithm>
+#include <memory>
+
+#include "dimensions.h"
+#include "layoutServer.h"
+#include "minuteScheduler.h"
+#include "uc8151.h"
+#include "uc8151Emulator.h"
+
+/**
+ * @brief Checks the minute scheduler's arithmetic, then runs an hour of minutes through
+ * LayoutServer, UC8151 and the panel emulator the way epdc does - wake on the alarm, draw,
+ * wait, refresh - and checks every refresh ends within a few hundred ms of its minute
+ */
+
+using namespace std;
+
+datetime_t dateTime(int16_t year, int8_t month, int8_t day, int8_t hour, int8_t min, int8_t sec)
+{
+    return {.year = year, .month = month, .day = day, .dotw = 0, .hour = hour, .min = min, .sec = sec};
+}
+
+bool sameTime(datetime_t const &a, datetime_t const &b)
+{
+    return a.year == b.year && a.month == b.month && a.day == b.day &&
+           a.hour == b.hour && a.min == b.min && a.sec == b.sec;
+}
+
+void alarmTest()
+{
+    cout << "alarm times - ";
+    MinuteScheduler scheduler(6);
+    auto alarm{scheduler.nextAlarm(dateTime(2023, 2, 19, 10, 0, 30))};
+    assert(alarm.year == -1 && alarm.day == -1 && alarm.dotw == -1);
+    assert(alarm.hour == 10 && alarm.min == 0 && alarm.sec == 54);
+    // on or past this minute's alarm it's the next one
+    alarm = scheduler.nextAlarm(dateTime(2023, 2, 19, 10, 0, 54));
+    assert(alarm.hour == 10 && alarm.min == 1 && alarm.sec == 54);
+    alarm = scheduler.nextAlarm(dateTime(2023, 2, 19, 23, 59, 58));
+    assert(alarm.hour == 0 && alarm.min == 0 && alarm.sec == 54);
+
+    assert(sameTime(MinuteScheduler::minuteAfter(dateTime(2023, 2, 19, 10, 0, 54)), dateTime(2023, 2, 19, 10, 1, 0)));
+    assert(sameTime(MinuteScheduler::minuteAfter(dateTime(2023, 2, 19, 10, 59, 54)), dateTime(2023, 2, 19, 11, 0, 0)));
+    assert(sameTime(MinuteScheduler::minuteAfter(dateTime(2023, 2, 28, 23, 59, 54)), dateTime(2023, 3, 1, 0, 0, 0)));
+    assert(sameTime(MinuteScheduler::minuteAfter(dateTime(2024, 2, 28, 23, 59, 54)), dateTime(2024, 2, 29, 0, 0, 0)));
+    assert(sameTime(MinuteScheduler::minuteAfter(dateTime(2023, 12, 31, 23, 59, 54)), dateTime(2024, 1, 1, 0, 0, 0)));
+
+    assert(scheduler.startDelay(6000, 130) == 5870);
+    assert(scheduler.startDelay(4000, 4500) == 0);
+    cout << "passed\n\r";
+}
+
+/// @brief Where the refreshes land against the minute for an hour, starting mid-minute
+void boundaryTest()
+{
+    cout << "boundary latency - ";
+    auto transport{make_unique<uc8151Emulator>()};
+    auto &panel{*transport};
+    auto driver{make_unique<UC8151>(std::move(transport))};
+    auto &uc8151{*driver};
+    LayoutServer lo(std::move(driver));
+    MinuteScheduler scheduler;
+    uc8151.setBlocking(false);
+    uint64_t doneUs{0};
+    uc8151.onComplete([&]()
+                      { doneUs = panel.nowUs(); });
+
+    // the emulator's clock reads from power up - call that 08:00:20
+    constexpr uint64_t startUs{(8 * 3600 + 20) * 1'000'000ull};
+    auto const offsetUs{startUs - panel.nowUs()};
+    auto const wall{[&]()
+                    { return panel.nowUs() + offsetUs; }};
+    auto const now{[&]()
+                   {
+                       auto const seconds{wall() / 1'000'000};
+                       return dateTime(2023, 2, 19, static_cast<int8_t>(seconds / 3600), static_cast<int8_t>(seconds / 60 % 60), static_cast<int8_t>(seconds % 60));
+                   }};
+
+    lo.timeIs(now());
+    while (uc8151.status() != UpdateStatus::idle)
+    {
+        panel.advance(1'000);
+        uc8151.poll();
+    }
+    for (int minutes{0}; minutes < 60; minutes++)
+    {
+        auto const alarm{scheduler.nextAlarm(now())};
+        auto alarmUs{(alarm.hour * 3600ull + alarm.min * 60 + alarm.sec) * 1'000'000};
+        assert(alarmUs > wall());
+        panel.advance(alarmUs - wall());
+
+        auto const minute{MinuteScheduler::minuteAfter(now())};
+        auto const boundaryUs{alarmUs + scheduler.lead() * 1'000'000ull};
+        lo.render(minute);
+        auto const toBoundary{(static_cast<int64_t>(boundaryUs) - static_cast<int64_t>(wall())) / 1000};
+        panel.advance(scheduler.startDelay(toBoundary, uc8151.refreshTime()) * 1000ull);
+        doneUs = 0;
+        lo.show();
+        while (uc8151.status() != UpdateStatus::idle)
+        {
+            panel.advance(1'000);
+            uc8151.poll();
+        }
+        assert(doneUs != 0);
+        scheduler.shown(static_cast<int32_t>((static_cast<int64_t>(doneUs + offsetUs) - static_cast<int64_t>(boundaryUs)) / 1000));
+        assert(abs(scheduler.last()) < 300);
+    }
+    assert(scheduler.minutes() == 60);
+    cout << "worst " << scheduler.worst() << "ms - passed\n\r";
+}
+
+int main()
+{
+    alarmTest();
+    boundaryTest();
+    return 0;
+}
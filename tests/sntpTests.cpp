@@ -0,0 +1,233 @@
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "sntpClient.h"
+#include "posixUdp.h"
+
+/**
+ * @brief SntpClient over a real socket against a fake NTP server on the loopback, whose
+ * clock is the host's steady clock (the client's local clock) plus a known offset. Each
+ * reply can be delayed on the way in or out, held by the server or spoilt, to check the
+ * offset and delay arithmetic, the choice of sample and the replies that are refused
+ */
+
+using namespace std;
+
+/// How the fake server answers one request
+struct Reply
+{
+    uint32_t inboundUs{0};  ///< held before the receive timestamp, as a slow path there
+    uint32_t heldUs{0};     ///< between the receive and transmit timestamps
+    uint32_t outboundUs{0}; ///< held after the transmit timestamp, as a slow path back
+    uint8_t first{0x24};    ///< LI, version and mode
+    uint8_t stratum{2};
+    bool wrongOrigin{false};
+    bool drop{false};
+};
+
+class fakeNtpServer
+{
+public:
+    static constexpr int64_t offsetUs{1'234'567'800};
+
+    fakeNtpServer()
+    {
+        fd = socket(AF_INET, SOCK_DGRAM, 0);
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        assert(bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0);
+        socklen_t length{sizeof(address)};
+        getsockname(fd, reinterpret_cast<sockaddr *>(&address), &length);
+        port = ntohs(address.sin_port);
+        server = thread([this]()
+                        { serve(); });
+    }
+
+    ~fakeNtpServer()
+    {
+        stopping = true;
+        server.join();
+        ::close(fd);
+    }
+
+    void answer(Reply const &reply)
+    {
+        lock_guard<mutex> lock(guard);
+        replies.push_back(reply);
+    }
+
+    uint16_t port;
+
+private:
+    int fd;
+    thread server;
+    atomic<bool> stopping{false};
+    mutex guard;
+    deque<Reply> replies;
+
+    /// The server's clock as NTP
+    static uint64_t now()
+    {
+        posixUdp clock;
+        return SntpClient::toNtp(static_cast<int64_t>(clock.nowUs()) + offsetUs);
+    }
+
+    static void put64(uint8_t *at, uint64_t value)
+    {
+        for (int i{7}; i >= 0; i--)
+        {
+            at[i] = static_cast<uint8_t>(value);
+            value >>= 8;
+        }
+    }
+
+    void serve()
+    {
+        while (!stopping)
+        {
+            pollfd waiting{.fd = fd, .events = POLLIN, .revents = 0};
+            if (poll(&waiting, 1, 10) != 1)
+            {
+                continue;
+            }
+            uint8_t packet[SntpClient::packetSize];
+            sockaddr_in from{};
+            socklen_t length{sizeof(from)};
+            if (recvfrom(fd, packet, sizeof(packet), 0, reinterpret_cast<sockaddr *>(&from), &length) != sizeof(packet))
+            {
+                continue;
+            }
+            Reply reply;
+            {
+                lock_guard<mutex> lock(guard);
+                if (!replies.empty())
+                {
+                    reply = replies.front();
+                    replies.pop_front();
+                }
+            }
+            if (reply.drop)
+            {
+                continue;
+            }
+            this_thread::sleep_for(chrono::microseconds(reply.inboundUs));
+            uint8_t answer[SntpClient::packetSize]{};
+            put64(answer + 32, now());
+            answer[0] = reply.first;
+            answer[1] = reply.stratum;
+            answer[6] = 0x01; // root delay 1/256s
+            answer[10] = 0x02; // root dispersion 2/256s
+            copy(packet + 40, packet + 48, answer + 24);
+            answer[31] ^= reply.wrongOrigin ? 1 : 0;
+            this_thread::sleep_for(chrono::microseconds(reply.heldUs));
+            put64(answer + 40, now());
+            this_thread::sleep_for(chrono::microseconds(reply.outboundUs));
+            sendto(fd, answer, sizeof(answer), 0, reinterpret_cast<sockaddr *>(&from), length);
+        }
+    }
+};
+
+void timestampTest()
+{
+    cout << "NTP timestamps - ";
+    // 2023-02-19 09:00:00.25
+    int64_t const us{1'676'797'200'250'000};
+    assert(SntpClient::toNtp(us) >> 32 == 1'676'797'200u + 2'208'988'800u);
+    assert((SntpClient::toNtp(us) & 0xFFFFFFFF) == 0x40000000);
+    assert(SntpClient::fromNtp(SntpClient::toNtp(us)) == us);
+    // era 1 starts 2036-02-07 06:28:16
+    int64_t const era1{2'085'978'496'000'000};
+    assert(SntpClient::toNtp(era1) == 0);
+    assert(SntpClient::fromNtp(SntpClient::toNtp(era1 + 1'500'000)) == era1 + 1'500'000);
+    assert(SntpClient::fromNtp(SntpClient::toNtp(era1 - 1)) == era1 - 1);
+    cout << "passed\n\r";
+}
+
+void queryTest(fakeNtpServer &server)
+{
+    cout << "one query - ";
+    posixUdp udp;
+    assert(udp.open("127.0.0.1", server.port));
+    SntpClient client(udp);
+    server.answer({.heldUs = 5'000});
+    auto const [ok, sample]{client.query()};
+    assert(ok && sample.stratum == 2);
+    auto const error{abs(sample.offsetUs - fakeNtpServer::offsetUs)};
+    // the offset can't be further out than half the round trip, whatever the path did -
+    // and the time the server held the request isn't part of it
+    assert(error <= sample.delayUs / 2 + 1);
+    assert(sample.delayUs < 5'000);
+    assert(sample.rootDelayUs == 3906 && sample.rootDispersionUs == 7812);
+    cout << error << "us out against " << fakeNtpServer::offsetUs % 1'000'000 << "us for the whole transmit second - passed\n\r";
+}
+
+void bestTest(fakeNtpServer &server)
+{
+    cout << "lowest delay of a burst - ";
+    posixUdp udp;
+    assert(udp.open("127.0.0.1", server.port));
+    SntpClient client(udp);
+    // queued one way or the other - each of these is 10ms or more out
+    server.answer({.inboundUs = 40'000});
+    server.answer({.outboundUs = 30'000});
+    server.answer({.inboundUs = 25'000, .heldUs = 2'000});
+    server.answer({});
+    server.answer({.outboundUs = 20'000});
+    auto const [ok, sample]{client.best(5, 10)};
+    assert(ok);
+    auto const error{abs(sample.offsetUs - fakeNtpServer::offsetUs)};
+    assert(sample.delayUs < 10'000 && error < 5'000);
+    cout << error << "us out, delay " << sample.delayUs << "us - passed\n\r";
+}
+
+void refusedTest(fakeNtpServer &server)
+{
+    cout << "refused replies - ";
+    posixUdp udp;
+    assert(udp.open("127.0.0.1", server.port));
+    SntpClient client(udp);
+    // kiss of death, and a server that says it isn't synchronised
+    server.answer({.stratum = 0});
+    assert(!client.query().first);
+    server.answer({.first = 0xE4});
+    assert(!client.query().first);
+    // not replies to this request - ignored until the timeout
+    server.answer({.wrongOrigin = true});
+    assert(!client.query(200).first);
+    server.answer({.first = 0x23});
+    assert(!client.query(200).first);
+    server.answer({.drop = true});
+    assert(!client.query(200).first);
+    // a burst gets by with what answers
+    server.answer({.drop = true});
+    server.answer({.stratum = 0});
+    server.answer({});
+    assert(client.best(3, 10, 200).first);
+    // and fails with nothing
+    server.answer({.drop = true});
+    server.answer({.drop = true});
+    assert(!client.best(2, 10, 200).first);
+    cout << "passed\n\r";
+}
+
+int main()
+{
+    timestampTest();
+    fakeNtpServer server;
+    queryTest(server);
+    bestTest(server);
+    refusedTest(server);
+    return 0;
+}
@@ -0,0 +1,179 @@
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <cstdlib>
+#include <ctime>
+#include <clocale>
+
+#include "civilTime.h"
+#include "topCat.h"
+#include "bench.h"
+
+/**
+ * @brief Checks the libc-free calendar and summer time arithmetic - some of it at compile
+ * time - against glibc's gmtime_r/localtime_r over the whole of this century, then times
+ * TopCat's conversion against the setlocale/localtime_r path it replaced
+ */
+
+using namespace std;
+
+// 1970-01-01 was a Thursday, 2000-02-29 day 11016
+static_assert(CivilTime::daysFromCivil(1970, 1, 1) == 0);
+static_assert(CivilTime::weekday(0) == 4);
+static_assert(CivilTime::daysFromCivil(2000, 2, 29) == 11016);
+static_assert(CivilTime::civilFromDays(11016).month == 2 && CivilTime::civilFromDays(11016).day == 29);
+static_assert(CivilTime::civilFromDays(-1).year == 1969 && CivilTime::civilFromDays(-1).dotw == 3);
+static_assert(CivilTime::fromSeconds(-1).hour == 23 && CivilTime::fromSeconds(-1).sec == 59);
+// BST 2023 ran from 26 March to 29 October
+static_assert(CivilTime::civilFromDays(CivilTime::sunday(2023, 3, 5)).day == 26);
+static_assert(CivilTime::civilFromDays(CivilTime::sunday(2023, 10, 5)).day == 29);
+static_assert(TopCat::utcOffset(1679792399) == 0 && TopCat::utcOffset(1679792400) == 3600);
+static_assert(TopCat::ukTime(1698541200).hour == 1 && TopCat::ukTime(1698541199).hour == 1);
+static_assert(TopCat::summerTime.transitions().size() == 200);
+
+/// The time zones checked, as POSIX TZ strings so glibc doesn't need a tz database
+struct Zone
+{
+    char const *name;
+    char const *tz;
+    TimeZone const &rules;
+    int16_t from;
+};
+
+Zone const checked[]{
+    {"London", "GMT0BST,M3.5.0/1,M10.5.0", zones::london, 1996},
+    {"Paris", "CET-1CEST,M3.5.0,M10.5.0/3", zones::centralEurope, 1996},
+    {"Athens", "EET-2EEST,M3.5.0/3,M10.5.0/4", zones::easternEurope, 1996},
+    {"Sydney", "AEST-10AEDT,M10.1.0,M4.1.0/3", zones::sydney, 2008}};
+
+bool sameAs(datetime_t const &dt, tm const &ttm)
+{
+    return dt.year == ttm.tm_year + 1900 && dt.month == ttm.tm_mon + 1 && dt.day == ttm.tm_mday &&
+           dt.dotw == ttm.tm_wday && dt.hour == ttm.tm_hour && dt.min == ttm.tm_min && dt.sec == ttm.tm_sec;
+}
+
+/// @brief Every day from 1700 to 2300, both ways, and a second a day against gmtime_r
+void civilTest()
+{
+    cout << "civil dates - ";
+    int32_t const first{CivilTime::daysFromCivil(1700, 1, 1)};
+    int32_t const last{CivilTime::daysFromCivil(2300, 1, 1)};
+    for (int32_t days{first}; days < last; days++)
+    {
+        auto const dt{CivilTime::civilFromDays(days)};
+        assert(CivilTime::daysFromCivil(dt) == days);
+
+        time_t const tt{static_cast<time_t>(days) * CivilTime::secondsPerDay + (days * 7919) % CivilTime::secondsPerDay};
+        tm ttm;
+        gmtime_r(&tt, &ttm);
+        auto const at{CivilTime::fromSeconds(tt)};
+        assert(sameAs(at, ttm));
+        assert(CivilTime::toSeconds(at) == tt);
+    }
+    cout << last - first << " days passed\n\r";
+}
+
+/**
+ * @brief Each zone hourly to 2099, and every minute of the day either side of each change,
+ * through the rules and through a generated table
+ */
+void dstTest()
+{
+    for (auto const &zone : checked)
+    {
+        cout << "summer time " << zone.name << " - ";
+        setenv("TZ", zone.tz, 1);
+        tzset();
+        DstTable<2000, 2099> const table{zone.rules};
+        auto const check{[&](time_t tt)
+                         {
+                             tm ttm;
+                             localtime_r(&tt, &ttm);
+                             assert(sameAs(CivilTime::fromSeconds(tt + zone.rules.offset(tt)), ttm));
+                             assert(table.offset(tt) == zone.rules.offset(tt));
+                             assert(zone.rules.summer(tt) == (ttm.tm_isdst > 0));
+                         }};
+
+        int64_t const from{CivilTime::daysFromCivil(zone.from, 1, 1) * int64_t{CivilTime::secondsPerDay}};
+        int64_t const to{CivilTime::daysFromCivil(2100, 1, 1) * int64_t{CivilTime::secondsPerDay}};
+        size_t checks{0};
+        for (int64_t tt{from}; tt < to; tt += 3600 + 7)
+        {
+            check(tt);
+            checks++;
+        }
+        for (auto const change : table.transitions())
+        {
+            if (change < from)
+            {
+                continue;
+            }
+            for (int64_t tt{change - 86400}; tt < change + 86400; tt += 60)
+            {
+                check(tt);
+                check(tt - 1);
+                checks += 2;
+            }
+        }
+        cout << checks << " times passed\n\r";
+    }
+    unsetenv("TZ");
+    tzset();
+}
+
+/// @brief TopCat's own conversions in UK time, and the same against the libc path
+void topCatTest()
+{
+    cout << "TopCat - ";
+    setenv("TZ", checked[0].tz, 1);
+    tzset();
+    for (time_t tt{946684800}; tt < 4102444800; tt += 86400 / 4 + 13)
+    {
+        datetime_t dt;
+        assert(TopCat::toDateTime(&tt, &dt));
+        tm ours;
+        assert(TopCat::toTm(&tt, &ours));
+        tm theirs;
+        localtime_r(&tt, &theirs);
+        assert(sameAs(dt, theirs));
+        assert(ours.tm_yday == theirs.tm_yday && ours.tm_isdst == theirs.tm_isdst);
+    }
+
+    datetime_t start{.year = 2023, .month = 3, .day = 26, .dotw = 0, .hour = 0, .min = 30, .sec = 0};
+    TopCat topcat(start);
+    datetime_t later{start};
+    later.day = 27;
+    later.min = 31;
+    assert(topcat.elapsed(later) == 86400 + 60);
+    cout << "passed\n\r";
+}
+
+void benchmark()
+{
+    cout << "toDateTime(time_t) - ";
+    setenv("TZ", checked[0].tz, 1);
+    tzset();
+    time_t t{1676800000};
+    datetime_t dt{};
+    double const ours{bench::nsPerCall([&]()
+                                       { bench::keep(TopCat::toDateTime(&t, &dt)); t += 61; },
+                                       100000)};
+    tm ttm;
+    double const libc{bench::nsPerCall([&]()
+                                       {
+                                           setlocale(LC_TIME, "en_GB.utf8");
+                                           bench::keep(localtime_r(&t, &ttm));
+                                           t += 61; },
+                                       100000)};
+    cout << fixed << setprecision(1) << ours << "ns against " << libc << "ns for setlocale and localtime_r\n\r";
+    assert(ours < libc);
+}
+
+int main()
+{
+    civilTest();
+    dstTest();
+    topCatTest();
+    benchmark();
+    return 0;
+}
@@ -0,0 +1,331 @@
+#include <iostream>
+#include <sstream>
+#include <cassert>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "dimensions.h"
+#include "frameDriver.h"
+#include "layoutServer.h"
+#include "uc8151.h"
+#include "uc8151Defs.h"
+#include "uc8151Emulator.h"
+#include "refreshPolicy.h"
+
+/**
+ * @brief Drives the real UC8151 driver into the host panel emulator and checks what reaches
+ * the glass, how many bytes go over the wire and how long BUSY is held for each update
+ */
+
+using namespace std;
+
+constexpr datetime_t day{.year = 2023, .month = 2, .day = 19, .dotw = 0, .hour = 0, .min = 0, .sec = 0};
+
+datetime_t at(int minute)
+{
+    datetime_t dt{day};
+    dt.hour = static_cast<int8_t>(minute / 60);
+    dt.min = static_cast<int8_t>(minute % 60);
+    return dt;
+}
+
+/// @brief What frameDriver draws for a minute - the frame the panel should end up showing
+FrameBuffer expected(int minute)
+{
+    auto driver{make_unique<frameDriver>()};
+    auto &frames{*driver};
+    LayoutServer lo(std::move(driver));
+    lo.timeIs(at(minute));
+    FrameBuffer frame;
+    frame.copy(frames.frame().data);
+    return frame;
+}
+
+bool same(FrameBuffer const &a, FrameBuffer const &b)
+{
+    return equal(begin(a.data), end(a.data), begin(b.data));
+}
+
+void report(uc8151Emulator::Refresh const &r)
+{
+    cout << (r.partial ? "partial " : "full ") << r.window.width() << "x" << r.window.height()
+         << " " << r.bytes << " bytes, " << r.bytes * 8 / 12 << "us on the wire + "
+         << r.busyUs / 1000 << "ms busy - ";
+}
+
+/// @brief The driver's constructor configures the controller in the documented order
+void initTest(uc8151Emulator const &panel)
+{
+    cout << "init sequence - ";
+    vector<uint8_t> const order{PSR, PLL, PWR, PON, BTST, PFS, TSE, TCON, CDI, POF};
+    auto next{order.begin()};
+    for (auto const &command : panel.trace())
+    {
+        if (next != order.end() && command.reg == *next)
+        {
+            next++;
+        }
+    }
+    assert(next == order.end());
+    assert(panel.refreshes().empty());
+    cout << "passed\n\r";
+}
+
+/// @brief The first update is a full refresh, a repeat is nothing and a clock tick is a
+/// partial refresh of just the digits that changed
+void updateTest(LayoutServer &lo, uc8151Emulator const &panel)
+{
+    cout << "full update - ";
+    lo.timeIs(at(7));
+    assert(panel.refreshes().size() == 1);
+    auto const &full{panel.refreshes().back()};
+    report(full);
+    assert(!full.partial && full.window.width() == WIDTH && full.window.height() == HEIGHT);
+    assert(full.bytes >= FRAMEBUFFERSIZE);
+    // the driver leaves the LUTs in OTP, so this is the panel's own slow waveform
+    assert(!panel.lutFromRegisters() && full.busyUs == panel.refreshUs());
+    assert(same(panel.glass(), expected(7)));
+    cout << "passed\n\r";
+
+    cout << "same minute again - ";
+    lo.timeIs(at(7));
+    assert(panel.refreshes().size() == 1);
+    cout << "passed\n\r";
+
+    // two minutes in a row that show the clock face, so only the digits move
+    int minute{0};
+    while (lo.qs.quoteAt(at(minute)).first || lo.qs.quoteAt(at(minute + 1)).first)
+    {
+        minute++;
+        assert(minute + 1 < MINUTES_PER_DAY);
+    }
+    lo.timeIs(at(minute));
+    auto const refreshes{panel.refreshes().size()};
+    lo.timeIs(at(minute + 1));
+    cout << "clock tick at " << minute + 1 << " - ";
+    assert(panel.refreshes().size() == refreshes + 1);
+    auto const &tick{panel.refreshes().back()};
+    report(tick);
+    assert(tick.partial);
+    assert(tick.bytes < FRAMEBUFFERSIZE / 4);
+    assert(same(panel.glass(), expected(minute + 1)));
+    cout << "passed\n\r";
+}
+
+/// @brief A saved trace replays into a fresh panel with the same result
+void traceTest(uc8151Emulator const &panel)
+{
+    cout << "trace round trip - ";
+    stringstream saved;
+    assert(panel.writeTrace(saved));
+    auto const [ok, commands]{uc8151Emulator::readTrace(saved)};
+    assert(ok && commands.size() == panel.trace().size());
+    for (size_t i{0}; i < commands.size(); i++)
+    {
+        assert(commands[i].reg == panel.trace()[i].reg && commands[i].data == panel.trace()[i].data);
+    }
+    uc8151Emulator again;
+    again.replay(commands);
+    assert(same(again.glass(), panel.glass()));
+    assert(again.refreshes().size() == panel.refreshes().size());
+    stringstream bad("12 zz 00\n");
+    assert(!uc8151Emulator::readTrace(bad).first);
+    stringstream badData("12 04 12zz\n");
+    assert(!uc8151Emulator::readTrace(badData).first);
+    stringstream signedData("12 04 +1\n");
+    assert(!uc8151Emulator::readTrace(signedData).first);
+    cout << commands.size() << " commands - passed\n\r";
+}
+
+/// @brief With LUT_REG the waveform time comes from the LUT frame counts and the PLL rate
+void lutTimingTest()
+{
+    cout << "register LUT timing - ";
+    uc8151Emulator panel;
+    vector<uint8_t> const turbo{0x00, 0x01, 0x01, 0x02, 0x00, 0x01,
+                                0x00, 0x02, 0x02, 0x00, 0x00, 0x02,
+                                0x00, 0x02, 0x02, 0x03, 0x00, 0x02};
+    panel.replay({{0, PSR, {RES_128x296 | LUT_REG | FORMAT_BW | BOOSTER_ON | RESET_NONE | SHIFT_RIGHT}},
+                  {0, LUT_VCOM, turbo},
+                  {0, PLL, {HZ_200}},
+                  {0, DRF, {}}});
+    assert(panel.lutFromRegisters() && panel.frameRate() == 200);
+    // (1 + 1 + 2) x 1 + (2 + 2) x 2 + (2 + 2 + 3) x 2 = 26 frames at 200Hz
+    assert(panel.refreshes().size() == 1 && panel.refreshes().back().busyUs == 130'000);
+    auto const before{panel.nowUs()};
+    assert(panel.busy() && !panel.busy());
+    assert(panel.nowUs() - before == 130'000);
+    cout << "passed\n\r";
+}
+
+/// @brief A non-blocking update returns once the frame has started out over "DMA", the
+/// interrupts stream the rest and poll() - as the main loop calls it when woken - finishes
+/// the refresh. Frames drawn meanwhile follow with the latest one
+void asyncTest()
+{
+    cout << "non-blocking update - ";
+    auto transport{make_unique<uc8151Emulator>()};
+    auto &panel{*transport};
+    auto driver{make_unique<UC8151>(std::move(transport))};
+    auto &uc8151{*driver};
+    LayoutServer lo(std::move(driver));
+    uc8151.setBlocking(false);
+    int completions{0};
+    uc8151.onComplete([&]()
+                      { completions++; });
+
+    auto const start{panel.nowUs()};
+    lo.timeIs(at(7));
+    // only the command bytes have gone - the frame is streaming and nothing has refreshed
+    assert(uc8151.status() == UpdateStatus::sending);
+    assert(panel.nowUs() - start < 100 && panel.refreshes().empty());
+    panel.advance(5'000);
+    // the columns have all gone but DRF waits for poll()
+    assert(uc8151.status() == UpdateStatus::sending && panel.refreshes().empty());
+    uc8151.poll();
+    assert(uc8151.status() == UpdateStatus::refreshing && panel.refreshes().size() == 1);
+    auto const &first{panel.refreshes().back()};
+    report(first);
+
+    // two frames drawn during the refresh - only the last is sent, after it
+    lo.timeIs(at(8));
+    lo.timeIs(at(9));
+    assert(panel.refreshes().size() == 1 && completions == 0);
+    assert(same(panel.glass(), expected(7)));
+    panel.advance(first.busyUs);
+    assert(completions == 0);
+    uc8151.poll();
+    assert(completions == 1 && uc8151.status() != UpdateStatus::idle);
+    while (uc8151.status() != UpdateStatus::idle)
+    {
+        panel.advance(1'000);
+        uc8151.poll();
+    }
+    assert(completions == 2 && panel.refreshes().size() == 2);
+    assert(same(panel.glass(), expected(9)));
+    assert(panel.collisions() == 0);
+
+    // polled without interrupts it gets to the same place
+    uc8151.setBlocking(true);
+    lo.timeIs(at(7));
+    assert(uc8151.status() == UpdateStatus::idle && completions == 3);
+    assert(same(panel.glass(), expected(7)));
+    assert(panel.collisions() == 0);
+    cout << "passed\n\r";
+}
+
+/// @brief TSC reads back the temperature the panel was given
+void temperatureTest()
+{
+    cout << "temperature read - ";
+    uc8151Emulator panel;
+    panel.setTemperature(-5);
+    uint8_t const tsc{TSC};
+    uint8_t reading[2]{0xFF, 0xFF};
+    panel.select(true);
+    panel.dataMode(false);
+    panel.write({&tsc, 1});
+    panel.dataMode(true);
+    panel.read(reading);
+    panel.select(false);
+    assert(static_cast<int8_t>(reading[0]) == -5 && reading[1] == 0);
+    cout << "passed\n\r";
+}
+
+/// @brief The waveform follows temperature, the size of the change and the ghosting budget
+void policyTest()
+{
+    cout << "refresh policy - ";
+    constexpr size_t panelPixels{size_t{WIDTH} * HEIGHT};
+    RefreshPolicy policy;
+    // nothing is known about the panel at first
+    assert(policy.choose(25, 10) == Waveform::clean);
+    policy.refreshed(Waveform::clean);
+    assert(policy.choose(25, 10) == Waveform::turbo);
+    assert(policy.choose(25, panelPixels / 2) == Waveform::fast);
+    assert(policy.choose(15, 10) == Waveform::medium);
+    assert(policy.choose(5, 10) == Waveform::clean);
+    // a big change once half the fast allowance is gone gets the clean early
+    for (uint_t i{0}; i < (RefreshPolicy::maxFastUpdates + 1) / 2; i++)
+    {
+        policy.refreshed(policy.choose(25, 10));
+    }
+    assert(policy.choose(25, 10) == Waveform::turbo);
+    assert(policy.choose(25, panelPixels / 2) == Waveform::clean);
+    // and never more than the allowance of fast ones in a row
+    while (policy.choose(25, 10) != Waveform::clean)
+    {
+        policy.refreshed(Waveform::turbo);
+    }
+    assert(policy.fastUpdates() == RefreshPolicy::maxFastUpdates);
+    policy.refreshed(Waveform::clean);
+    assert(policy.fastUpdates() == 0);
+    cout << "passed\n\r";
+}
+
+/// @brief Two hours of minutes through the policy - the LUTs only go over when the
+/// waveform changes, the fast run between clean refreshes is bounded and the average
+/// refresh is a fraction of the clean one. A cold panel only ever gets the clean waveform
+void adaptiveTest(int8_t celsius)
+{
+    cout << "adaptive refresh at " << +celsius << "C - ";
+    auto transport{make_unique<uc8151Emulator>()};
+    auto &panel{*transport};
+    panel.setTemperature(celsius);
+    LayoutServer lo(make_unique<UC8151>(std::move(transport)));
+    auto const otpUs{panel.refreshUs()};
+    size_t const bootUploads{panel.trace().size()};
+    for (int minute{8 * 60}; minute < 10 * 60; minute++)
+    {
+        lo.timeIs(at(minute));
+    }
+    uint64_t total{0};
+    uint_t run{0};
+    uint_t longest{0};
+    for (auto const &refresh : panel.refreshes())
+    {
+        total += refresh.busyUs;
+        run = refresh.busyUs == otpUs ? 0 : run + 1;
+        longest = max(longest, run);
+    }
+    // a waveform change is a PSR followed by an upload (or just PLL for the OTP one)
+    size_t switches{0};
+    size_t uploads{0};
+    for (size_t i{bootUploads}; i < panel.trace().size(); i++)
+    {
+        switches += panel.trace()[i].reg == PSR;
+        uploads += panel.trace()[i].reg == LUT_VCOM;
+    }
+    auto const average{total / panel.refreshes().size()};
+    cout << panel.refreshes().size() << " refreshes, " << switches << " waveform changes, average "
+         << average / 1000 << "ms - ";
+    assert(uploads <= switches);
+    assert(longest <= RefreshPolicy::maxFastUpdates);
+    if (celsius < RefreshPolicy::coldBelow)
+    {
+        assert(switches == 0 && average == otpUs);
+    }
+    else
+    {
+        assert(switches > 0 && average < otpUs / 3);
+    }
+    cout << "passed\n\r";
+}
+
+int main()
+{
+    auto transport{make_unique<uc8151Emulator>()};
+    auto &panel{*transport};
+    LayoutServer lo(make_unique<UC8151>(std::move(transport)));
+    initTest(panel);
+    updateTest(lo, panel);
+    traceTest(panel);
+    lutTimingTest();
+    temperatureTest();
+    asyncTest();
+    policyTest();
+    adaptiveTest(22);
+    adaptiveTest(4);
+    return 0;
+}